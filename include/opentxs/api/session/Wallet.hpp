@@ -240,6 +240,25 @@ public:
     virtual auto NymNameByIndex(const std::size_t index, String& name) const
         -> bool = 0;
 
+    /**   Obtain smart pointers to several instantiated nyms.
+     *
+     *    Every nym which can not be located in local storage is queried from
+     *    remote locations at the same time, and the timeout applies to the
+     *    batch as a whole rather than to each nym.
+     *
+     *    \param[in] ids the identifiers of the nyms to be returned
+     *    \param[in] timeout The caller can set a non-zero value here if it's
+     *                       willing to wait for network lookups. The default
+     *                       value of 0 will return immediately.
+     *    \returns One smart pointer per requested identifier, in the same
+     *             order. A smart pointer will not be initialized if the
+     *             corresponding nym was not found in time or is invalid.
+     */
+    virtual auto Nyms(
+        const UnallocatedVector<identifier::Nym>& ids,
+        const std::chrono::milliseconds& timeout = 0ms) const
+        -> UnallocatedVector<Nym_p> = 0;
+
     /**   Load a peer reply object
      *
      *    \param[in] nym    the identifier of the nym who owns the object
@@ -7,6 +7,7 @@
 
 #include "opentxs/Version.hpp"  // IWYU pragma: associated
 
+#include <array>
 #include <cstddef>
 #include <functional>
 #include <string_view>
@@ -148,6 +149,13 @@ public:
     ~Amount();
 
 private:
-    Imp* imp_;
+    static constexpr auto imp_size_ = std::size_t{48};
+    static constexpr auto imp_align_ = std::size_t{16};
+
+    // NOTE Imp is constructed in place so Amount does not allocate
+    alignas(imp_align_) std::array<std::byte, imp_size_> imp_;
+
+    auto imp() const noexcept -> const Imp&;
+    auto imp() noexcept -> Imp&;
 };
 }  // namespace opentxs
@@ -27,6 +27,11 @@ namespace asio
 {
 class Endpoint;
 }  // namespace asio
+
+namespace zeromq
+{
+class Frame;
+}  // namespace zeromq
 }  // namespace network
 // }  // namespace v1
 }  // namespace opentxs
@@ -91,6 +96,23 @@ public:
      *   \returns false if the asio context is shutting down
      */
     auto Transmit(const ReadView notify, const ReadView data) noexcept -> bool;
+    /**  Asynchronously deliver a message to a remote peer without copying it
+     *
+     *   The frames are appended to the write queue of this socket and sent
+     *   in order, possibly in a single gathered write along with other queued
+     *   messages.
+     *
+     *   @param notify  the connection id which will be notified of the
+     *                  resolution of the transmit attempt
+     *   @param header  the first part of the message
+     *   @param payload the remainder of the message
+     *
+     *   \returns false if the asio context is shutting down
+     */
+    auto Transmit(
+        const ReadView notify,
+        zeromq::Frame&& header,
+        zeromq::Frame&& payload) noexcept -> bool;
 
     OPENTXS_NO_EXPORT Socket(std::function<void*()>&& builder) noexcept;
     Socket() noexcept = delete;
@@ -7,14 +7,20 @@
 #include "1_Internal.hpp"    // IWYU pragma: associated
 #include "api/Periodic.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
-#include <tuple>
+#include <exception>
+#include <optional>
 #include <utility>
 
+#include "internal/api/network/Asio.hpp"
 #include "internal/util/Flag.hpp"
+#include "internal/util/LogMacros.hpp"
 #include "internal/util/Mutex.hpp"
+#include "opentxs/api/network/Asio.hpp"
 #include "opentxs/util/Container.hpp"
+#include "opentxs/util/Log.hpp"
 #include "util/Thread.hpp"
 
 namespace opentxs::api::imp
@@ -23,7 +29,12 @@ Periodic::Periodic(Flag& running)
     : running_(running)
     , next_id_(0)
     , periodic_lock_()
+    , periodic_wake_()
     , periodic_task_list_()
+    , periodic_queue_()
+    , periodic_in_flight_(0)
+    , periodic_asio_(nullptr)
+    , periodic_shutdown_(false)
     , periodic_(&Periodic::thread, this)
 {
 }
@@ -31,22 +42,126 @@ Periodic::Periodic(Flag& running)
 auto Periodic::Cancel(const int task) const -> bool
 {
     Lock lock(periodic_lock_);
-    const auto output = periodic_task_list_.erase(task);
+    auto it = periodic_task_list_.find(task);
+
+    if (periodic_task_list_.end() == it) { return false; }
+
+    const auto& item = it->second;
+
+    if (false == item.running_) { periodic_queue_.erase({item.next_, task}); }
 
-    return 1 == output;
+    periodic_task_list_.erase(it);
+
+    return true;
+}
+
+auto Periodic::dispatch(const int id, TaskItem& item, const Time now)
+    const noexcept -> void
+{
+    OT_ASSERT(nullptr != periodic_asio_);
+
+    const auto lateness =
+        std::chrono::duration_cast<Duration>(now - item.next_);
+    item.running_ = true;
+    item.last_ = now;
+    auto& stats = item.stats_;
+    stats.last_lateness_ = lateness;
+    stats.max_lateness_ = std::max(stats.max_lateness_, lateness);
+    ++periodic_in_flight_;
+    const auto posted = periodic_asio_->Internal().Post(
+        ThreadPool::General,
+        [this, id, task = item.task_] { run(id, task); },
+        "Periodic");
+
+    if (false == posted) {
+        LogError()(OT_PRETTY_CLASS())("failed to dispatch task ")(id).Flush();
+        --periodic_in_flight_;
+        item.running_ = false;
+        queue(id, item);
+    }
+}
+
+auto Periodic::finish(const int id, const Duration duration) const noexcept
+    -> void
+{
+    {
+        Lock lock(periodic_lock_);
+        --periodic_in_flight_;
+
+        if (auto it = periodic_task_list_.find(id);
+            periodic_task_list_.end() != it) {
+            auto& item = it->second;
+            auto& stats = item.stats_;
+            item.running_ = false;
+            ++stats.runs_;
+            stats.last_duration_ = duration;
+            stats.max_duration_ = std::max(stats.max_duration_, duration);
+            LogTrace()(OT_PRETTY_CLASS())("task ")(id)(" started ")(
+                stats.last_lateness_)(" late and finished in ")(duration)
+                .Flush();
+
+            if (duration > item.interval_) {
+                LogDetail()(OT_PRETTY_CLASS())("task ")(id)(" ran for ")(
+                    duration)(" which exceeds its interval of ")(
+                    std::chrono::duration_cast<Duration>(item.interval_))
+                    .Flush();
+            }
+
+            // NOTE the next deadline is measured from when this run started
+            // so a task which runs longer than its interval becomes due
+            // immediately, but it never has more than one run outstanding
+            queue(id, item);
+        }
+    }
+
+    periodic_wake_.notify_all();
+}
+
+auto Periodic::queue(const int id, TaskItem& item) const noexcept -> void
+{
+    item.next_ = item.last_ + item.interval_;
+    periodic_queue_.emplace(item.next_, id);
 }
 
 auto Periodic::Reschedule(const int task, const std::chrono::seconds& interval)
     const -> bool
 {
-    Lock lock(periodic_lock_);
-    auto it = periodic_task_list_.find(task);
+    {
+        Lock lock(periodic_lock_);
+        auto it = periodic_task_list_.find(task);
 
-    if (periodic_task_list_.end() == it) { return false; }
+        if (periodic_task_list_.end() == it) { return false; }
+
+        auto& item = it->second;
+        item.interval_ = interval;
 
-    std::get<1>(it->second) = interval;
+        if (false == item.running_) {
+            periodic_queue_.erase({item.next_, task});
+            queue(task, item);
+        }
+    }
 
-    return false;
+    periodic_wake_.notify_all();
+
+    return true;
+}
+
+auto Periodic::run(const int id, const PeriodicTask& task) const noexcept
+    -> void
+{
+    const auto begin = std::chrono::steady_clock::now();
+
+    try {
+        task();
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())("task ")(id)(" failed: ")(e.what())
+            .Flush();
+    }
+
+    finish(
+        id,
+        std::chrono::duration_cast<Duration>(
+            std::chrono::steady_clock::now() - begin));
 }
 
 auto Periodic::Schedule(
@@ -55,38 +170,91 @@ auto Periodic::Schedule(
     const std::chrono::seconds& last) const -> int
 {
     const auto id = ++next_id_;
-    Lock lock(periodic_lock_);
-    periodic_task_list_.emplace(
-        id, TaskItem{Clock::from_time_t(last.count()), interval, task});
+
+    {
+        Lock lock(periodic_lock_);
+        auto [it, added] = periodic_task_list_.try_emplace(id);
+
+        OT_ASSERT(added);
+
+        auto& item = it->second;
+        item.task_ = task;
+        item.interval_ = interval;
+        // NOTE a task which is already overdue, including the default case of
+        // immediate execution, is due now rather than at its nominal deadline
+        item.last_ =
+            std::max(Clock::from_time_t(last.count()), Clock::now() - interval);
+        queue(id, item);
+    }
+
+    periodic_wake_.notify_all();
 
     return id;
 }
 
+auto Periodic::Stats(const int task) const noexcept
+    -> std::optional<Statistics>
+{
+    Lock lock(periodic_lock_);
+
+    if (auto it = periodic_task_list_.find(task);
+        periodic_task_list_.end() != it) {
+
+        return it->second.stats_;
+    }
+
+    return std::nullopt;
+}
+
 void Periodic::Shutdown()
 {
+    {
+        Lock lock(periodic_lock_);
+        periodic_shutdown_ = true;
+    }
+
+    periodic_wake_.notify_all();
+
     if (periodic_.joinable()) { periodic_.join(); }
+
+    Lock lock(periodic_lock_);
+    periodic_wake_.wait(lock, [this] { return 0u == periodic_in_flight_; });
+}
+
+void Periodic::Start(const api::network::Asio& asio)
+{
+    {
+        Lock lock(periodic_lock_);
+        periodic_asio_ = &asio;
+    }
+
+    periodic_wake_.notify_all();
 }
 
 void Periodic::thread()
 {
     SetThisThreadsName("Periodic");
+    Lock lock(periodic_lock_);
+
+    while (running_ && (false == periodic_shutdown_)) {
+        if ((nullptr == periodic_asio_) || periodic_queue_.empty()) {
+            periodic_wake_.wait(lock);
+
+            continue;
+        }
 
-    while (running_) {
         const auto now = Clock::now();
-        Lock lock(periodic_lock_);
+        const auto next = periodic_queue_.begin();
+        const auto [deadline, id] = *next;
 
-        for (auto& [key, value] : periodic_task_list_) {
-            auto& [last, interval, task] = value;
+        if (deadline > now) {
+            periodic_wake_.wait_until(lock, deadline);
 
-            if ((now - last) > interval) {
-                last = now;
-                std::thread taskThread{task};
-                taskThread.detach();
-            }
+            continue;
         }
 
-        lock.unlock();
-        Sleep(100ms);
+        periodic_queue_.erase(next);
+        dispatch(id, periodic_task_list_.at(id), now);
     }
 }
 
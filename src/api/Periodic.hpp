@@ -7,11 +7,13 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstddef>
 #include <functional>
 #include <mutex>
+#include <optional>
 #include <thread>
-#include <thread>
-#include <tuple>
+#include <utility>
 
 #include "opentxs/api/Periodic.hpp"
 #include "opentxs/util/Container.hpp"
@@ -22,6 +24,14 @@ namespace opentxs  // NOLINT
 {
 // inline namespace v1
 // {
+namespace api
+{
+namespace network
+{
+class Asio;
+}  // namespace network
+}  // namespace api
+
 class Flag;
 // }  // namespace v1
 }  // namespace opentxs
@@ -29,9 +39,24 @@ class Flag;
 
 namespace opentxs::api::imp
 {
+// NOTE tasks are kept in a queue ordered by deadline. A single scheduler
+// thread sleeps until the earliest deadline, or until the queue changes, and
+// dispatches due tasks to ThreadPool::General. A task is removed from the
+// queue while it runs and is queued again once it finishes, so no task ever
+// runs concurrently with itself.
 class Periodic : virtual public api::Periodic
 {
 public:
+    using Duration = std::chrono::nanoseconds;
+
+    struct Statistics {
+        std::size_t runs_{};
+        Duration last_duration_{};
+        Duration max_duration_{};
+        Duration last_lateness_{};
+        Duration max_lateness_{};
+    };
+
     auto Cancel(const int task) const -> bool final;
     auto Reschedule(const int task, const std::chrono::seconds& interval) const
         -> bool final;
@@ -39,6 +64,8 @@ public:
         const std::chrono::seconds& interval,
         const PeriodicTask& task,
         const std::chrono::seconds& last) const -> int final;
+    // NOTE returns nothing if the task does not exist
+    auto Stats(const int task) const noexcept -> std::optional<Statistics>;
 
     Periodic() = delete;
     Periodic(const Periodic&) = delete;
@@ -51,20 +78,41 @@ public:
 protected:
     Flag& running_;
 
+    // NOTE tasks which become due before this is called remain queued
+    void Start(const api::network::Asio& asio);
     void Shutdown();
 
     Periodic(Flag& running);
 
 private:
-    /** Last performed, Interval, Task */
-    using TaskItem = std::tuple<Time, std::chrono::seconds, PeriodicTask>;
+    using Queue = UnallocatedSet<std::pair<Time, int>>;
+
+    struct TaskItem {
+        PeriodicTask task_{};
+        std::chrono::seconds interval_{};
+        Time last_{};
+        Time next_{};
+        bool running_{};
+        Statistics stats_{};
+    };
+
     using TaskList = UnallocatedMap<int, TaskItem>;
 
     mutable std::atomic<int> next_id_;
     mutable std::mutex periodic_lock_;
+    mutable std::condition_variable periodic_wake_;
     mutable TaskList periodic_task_list_;
+    mutable Queue periodic_queue_;
+    mutable std::size_t periodic_in_flight_;
+    const api::network::Asio* periodic_asio_;
+    bool periodic_shutdown_;
     std::thread periodic_;
 
+    auto dispatch(const int id, TaskItem& item, const Time now) const noexcept
+        -> void;
+    auto finish(const int id, const Duration duration) const noexcept -> void;
+    auto queue(const int id, TaskItem& item) const noexcept -> void;
+    auto run(const int id, const PeriodicTask& task) const noexcept -> void;
     void thread();
 };
 }  // namespace opentxs::api::imp
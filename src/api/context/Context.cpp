@@ -243,6 +243,7 @@ auto Context::Init_Asio() -> void
     OT_ASSERT(asio_);
 
     asio_->Init();
+    Periodic::Start(*asio_);
 }
 
 auto Context::Init_Crypto() -> void
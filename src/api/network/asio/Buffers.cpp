@@ -8,37 +8,161 @@
 #include "api/network/asio/Buffers.hpp"  // IWYU pragma: associated
 
 #include <boost/asio.hpp>
+#include <boost/lockfree/stack.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
-#include <mutex>
 #include <utility>
 
-#include "internal/util/Mutex.hpp"
-#include "opentxs/util/Bytes.hpp"
-#include "opentxs/util/Container.hpp"
+#include "internal/util/P0330.hpp"
+#include "util/ByteLiterals.hpp"
 
 namespace opentxs::api::network::asio
 {
+struct Buffers::Block {
+    const std::size_t class_;
+    const std::size_t capacity_;
+    // NOTE not value initialized since asio overwrites the contents
+    std::unique_ptr<std::byte[]> data_;
+
+    Block(std::size_t sizeClass, std::size_t capacity) noexcept
+        : class_(sizeClass)
+        , capacity_(capacity)
+        , data_(new std::byte[capacity])
+    {
+    }
+};
+
+// NOTE buffers are obtained on the thread requesting a read and returned on
+// the io_context thread which completes it, so recycled buffers are kept in
+// lock-free stacks shared by all threads rather than in per thread caches
 struct Buffers::Imp {
-    auto clear(Index id) noexcept -> void
+    auto Stats() const noexcept -> Statistics
     {
-        auto lock = Lock{lock_};
-        buffers_.erase(id);
+        auto out = Statistics{};
+        out.hits_ = hits_.load();
+        out.misses_ = misses_.load();
+        out.outstanding_ = outstanding_.load();
+        out.peak_outstanding_ = peak_.load();
+
+        return out;
+    }
+
+    auto clear(Index block) noexcept -> void
+    {
+        if (nullptr == block) { return; }
+
+        outstanding_.fetch_sub(block->capacity_);
+        const auto sizeClass = block->class_;
+
+        if (pooled_ > sizeClass) {
+            auto& list = free_[sizeClass];
+
+            if (list.count_.fetch_add(1) < retain(sizeClass)) {
+                if (list.blocks_.push(block)) { return; }
+            }
+
+            list.count_.fetch_sub(1);
+        }
+
+        delete block;
     }
     auto get(const std::size_t bytes) noexcept -> std::pair<Index, AsioBuffer>
     {
-        auto lock = Lock{lock_};
-        auto id = ++counter_;
-        auto& buffer = buffers_[id];
-        buffer.resize(bytes, std::byte{0x0});
+        const auto sizeClass = size_class(bytes);
+        auto* block = [&]() -> Block* {
+            if (pooled_ > sizeClass) {
+                auto& list = free_[sizeClass];
+                auto* out = static_cast<Block*>(nullptr);
+
+                if (list.blocks_.pop(out)) {
+                    list.count_.fetch_sub(1);
+                    hits_.fetch_add(1, std::memory_order_relaxed);
+
+                    return out;
+                }
+            }
+
+            misses_.fetch_add(1, std::memory_order_relaxed);
+
+            return new Block{sizeClass, capacity(sizeClass, bytes)};
+        }();
+        update_peak(outstanding_.fetch_add(block->capacity_) +
+                    block->capacity_);
+
+        return {block, boost::asio::buffer(block->data_.get(), bytes)};
+    }
+
+    Imp() noexcept
+        : free_()
+        , hits_(0)
+        , misses_(0)
+        , outstanding_(0)
+        , peak_(0)
+    {
+    }
 
-        return {id, boost::asio::buffer(buffer.data(), buffer.size())};
+    ~Imp()
+    {
+        for (auto& list : free_) {
+            list.blocks_.consume_all([](auto* block) { delete block; });
+        }
     }
 
 private:
-    mutable std::mutex lock_{};
-    Index counter_{-1};
-    UnallocatedMap<Index, Space> buffers_{};
+    struct FreeList {
+        boost::lockfree::stack<Block*> blocks_{64};
+        std::atomic<std::size_t> count_{};
+    };
+
+    // NOTE size classes are powers of two from 2^min_class_ to 2^max_class_
+    // bytes. Larger requests are allocated exactly and never recycled.
+    static constexpr auto min_class_ = 6_uz;
+    static constexpr auto max_class_ = 24_uz;
+    static constexpr auto pooled_ = max_class_ - min_class_ + 1_uz;
+    // NOTE limits the memory retained by each free list
+    static constexpr auto retain_bytes_ = std::size_t{16_mib};
+
+    std::array<FreeList, pooled_> free_;
+    std::atomic<std::uint64_t> hits_;
+    std::atomic<std::uint64_t> misses_;
+    std::atomic<std::size_t> outstanding_;
+    std::atomic<std::size_t> peak_;
+
+    static auto capacity(std::size_t sizeClass, std::size_t bytes) noexcept
+        -> std::size_t
+    {
+        if (pooled_ > sizeClass) {
+
+            return 1_uz << (sizeClass + min_class_);
+        } else {
+
+            return bytes;
+        }
+    }
+    static auto retain(std::size_t sizeClass) noexcept -> std::size_t
+    {
+        return std::max(retain_bytes_ >> (sizeClass + min_class_), 1_uz);
+    }
+    static auto size_class(std::size_t bytes) noexcept -> std::size_t
+    {
+        auto out = 0_uz;
+
+        while ((pooled_ > out) && (capacity(out, bytes) < bytes)) { ++out; }
+
+        return out;
+    }
+
+    auto update_peak(std::size_t value) noexcept -> void
+    {
+        auto peak = peak_.load();
+
+        while ((peak < value) && (!peak_.compare_exchange_weak(peak, value))) {
+        }
+    }
 };
 
 Buffers::Buffers() noexcept
@@ -48,6 +172,8 @@ Buffers::Buffers() noexcept
 
 auto Buffers::clear(Index id) noexcept -> void { imp_->clear(id); }
 
+auto Buffers::Stats() const noexcept -> Statistics { return imp_->Stats(); }
+
 auto Buffers::get(const std::size_t bytes) noexcept
     -> std::pair<Index, AsioBuffer>
 {
@@ -19,7 +19,21 @@ public:
     using AsioBuffer = decltype(boost::asio::buffer(
         std::declval<void*>(),
         std::declval<std::size_t>()));
-    using Index = std::int64_t;
+    struct Block;
+    using Index = Block*;
+
+    struct Statistics {
+        // Number of requests satisfied by a recycled buffer
+        std::uint64_t hits_{};
+        // Number of requests which required a new allocation
+        std::uint64_t misses_{};
+        // Capacity of all buffers currently in use
+        std::size_t outstanding_{};
+        // Highest observed value of outstanding_
+        std::size_t peak_outstanding_{};
+    };
+
+    auto Stats() const noexcept -> Statistics;
 
     auto clear(Index id) noexcept -> void;
     auto get(const std::size_t bytes) noexcept -> std::pair<Index, AsioBuffer>;
@@ -35,6 +35,7 @@
 #include "internal/api/network/Asio.hpp"
 #include "internal/network/asio/HTTP.hpp"
 #include "internal/network/asio/HTTPS.hpp"
+#include "internal/network/zeromq/message/Factory.hpp"
 #include "internal/network/zeromq/socket/Factory.hpp"
 #include "internal/network/zeromq/socket/Raw.hpp"
 #include "internal/util/LogMacros.hpp"
@@ -430,37 +431,64 @@ auto Asio::Imp::Receive(
     if (0 == id.size()) { return false; }
 
     const auto& endpoint = socket->endpoint_;
-    auto bufData = buffers_.get(bytes);
     auto connection = std::make_shared<Space>(space(id));
     auto address = std::make_shared<UnallocatedCString>(endpoint.str());
-    boost::asio::async_read(
-        socket->socket_, bufData.second, [=](const auto& e, auto size) {
-            [[maybe_unused]] const auto& lifetimeControl = socket;
-            data_socket_->Send([&] {
+
+    if (direct_receive_ <= bytes) {
+        // NOTE asio reads directly into the frame which will be delivered to
+        // the connection so the payload is never copied or zero filled
+        auto frame = std::make_shared<zmq::Frame>();
+        const auto view = frame->WriteInto()(bytes);
+        boost::asio::async_read(
+            socket->socket_,
+            boost::asio::buffer(view.data(), view.size()),
+            [=](const auto& e, auto) {
+                [[maybe_unused]] const auto& lifetimeControl = socket;
+                receive(*connection, *address, type, e, std::move(*frame));
+            });
+    } else {
+        auto bufData = buffers_.get(bytes);
+        boost::asio::async_read(
+            socket->socket_, bufData.second, [=](const auto& e, auto) {
+                [[maybe_unused]] const auto& lifetimeControl = socket;
                 const auto& [index, buffer] = bufData;
-                auto work =
-                    opentxs::network::zeromq::tagged_reply_to_connection(
-                        reader(*connection),
-                        e ? value(WorkType::AsioDisconnect) : type);
-
-                if (e) {
-                    LogVerbose()(OT_PRETTY_CLASS())("asio receive error: ")(
-                        e.message())
-                        .Flush();
-                    work.AddFrame(*address);
-                    work.AddFrame(e.message());
-                } else {
-                    work.AddFrame(buffer.data(), buffer.size());
-                }
+                receive(
+                    *connection,
+                    *address,
+                    type,
+                    e,
+                    factory::ZMQFrame(buffer.data(), buffer.size()));
+                buffers_.clear(index);
+            });
+    }
 
-                OT_ASSERT(1 < work.Body().size());
+    return true;
+}
 
-                return work;
-            }());
-            buffers_.clear(bufData.first);
-        });
+auto Asio::Imp::receive(
+    const Space& connection,
+    const UnallocatedCString& address,
+    const OTZMQWorkType type,
+    const boost::system::error_code& e,
+    zmq::Frame&& payload) noexcept -> void
+{
+    data_socket_->Send([&] {
+        auto work = opentxs::network::zeromq::tagged_reply_to_connection(
+            reader(connection), e ? value(WorkType::AsioDisconnect) : type);
+
+        if (e) {
+            LogVerbose()(OT_PRETTY_CLASS())("asio receive error: ")(e.message())
+                .Flush();
+            work.AddFrame(address);
+            work.AddFrame(e.message());
+        } else {
+            work.AddFrame(std::move(payload));
+        }
 
-    return true;
+        OT_ASSERT(1 < work.Body().size());
+
+        return work;
+    }());
 }
 
 auto Asio::Imp::Resolve(std::string_view server, std::uint16_t port)
@@ -651,6 +679,12 @@ auto Asio::Imp::Shutdown() noexcept -> void
         thread_pools_.clear();
         data_socket_->Close();
     }
+
+    const auto stats = buffers_.Stats();
+    LogVerbose()(OT_PRETTY_CLASS())("receive buffer pool hits: ")(stats.hits_)(
+        ", misses: ")(stats.misses_)(", peak outstanding bytes: ")(
+        stats.peak_outstanding_)
+        .Flush();
 }
 
 auto Asio::Imp::state_machine() noexcept -> bool
@@ -754,6 +788,16 @@ auto Asio::Imp::Transmit(
     const ReadView id,
     const ReadView bytes,
     Socket socket) noexcept -> bool
+{
+    return Transmit(
+        id, factory::ZMQFrame(bytes.data(), bytes.size()), {}, socket);
+}
+
+auto Asio::Imp::Transmit(
+    const ReadView id,
+    zmq::Frame&& header,
+    zmq::Frame&& payload,
+    Socket socket) noexcept -> bool
 {
     if (false == socket.operator bool()) { return false; }
 
@@ -763,39 +807,137 @@ auto Asio::Imp::Transmit(
 
     if (0 == id.size()) { return false; }
 
-    auto buf = std::make_shared<Space>(space(bytes));
-    auto connection = std::make_shared<Space>(space(id));
+    {
+        auto handle = socket->write_queue_.lock();
+        auto& queue = *handle;
+        queue.queue_.push_back(
+            {space(id), std::move(header), std::move(payload)});
 
-    return Post(
+        // NOTE a write is already in progress and will pick up this message
+        // when it completes
+        if (queue.writing_) { return true; }
+
+        queue.writing_ = true;
+    }
+
+    const auto posted = Post(
         ThreadPool::Network,
-        [=] {
-            boost::asio::async_write(
-                socket->socket_,
-                boost::asio::buffer(buf->data(), buf->size()),
-                [this, socket, connection, buf](auto& e, std::size_t sent) {
-                    [[maybe_unused]] const auto& lifetimeControl1 = buf;
-                    [[maybe_unused]] const auto& lifetimeControl2 = socket;
-                    data_socket_->Send([&] {
-                        auto work = opentxs::network::zeromq::
-                            tagged_reply_to_connection(
-                                reader(*connection),
-                                value(WorkType::AsioSendResult));
-                        work.AddFrame(sent);
-                        static constexpr auto trueValue = std::byte{0x01};
-                        static constexpr auto falseValue = std::byte{0x00};
-
-                        if (e) {
-                            work.AddFrame(falseValue);
-                            work.AddFrame(e.message());
-                        } else {
-                            work.AddFrame(trueValue);
-                        }
-
-                        return work;
-                    }());
-                });
-        },
+        [this, socket] { flush(socket); },
         "asio transmit");
+
+    if (false == posted) {
+        using namespace std::literals;
+        static constexpr auto error = "failed to schedule write"sv;
+        const auto discarded = discard(socket);
+        LogError()(OT_PRETTY_CLASS())(error)(", discarded ")(discarded)(
+            " queued messages")
+            .Flush();
+        // NOTE the queue may have held messages from other callers which
+        // expected a send result so the connection is told the write failed
+        send_result(id, 0_uz, error);
+    }
+
+    return posted;
+}
+
+auto Asio::Imp::discard(Socket socket) noexcept -> std::size_t
+{
+    auto handle = socket->write_queue_.lock();
+    auto& queue = *handle;
+    const auto count = queue.queue_.size();
+    queue.queue_.clear();
+    queue.writing_ = false;
+
+    return count;
+}
+
+auto Asio::Imp::flush(Socket socket) noexcept -> void
+{
+    using Outgoing = opentxs::network::asio::Socket::Imp::Outgoing;
+    auto messages = std::make_shared<UnallocatedVector<Outgoing>>();
+    {
+        auto handle = socket->write_queue_.lock();
+        auto& queue = handle->queue_;
+        auto bytes = 0_uz;
+
+        while ((false == queue.empty()) &&
+               (max_write_messages_ > messages->size()) &&
+               ((messages->empty()) || (max_write_bytes_ > bytes))) {
+            auto& next = messages->emplace_back(std::move(queue.front()));
+            queue.pop_front();
+            bytes += next.header_.size() + next.payload_.size();
+        }
+
+        if (messages->empty()) {
+            handle->writing_ = false;
+
+            return;
+        }
+    }
+
+    auto buffers = UnallocatedVector<boost::asio::const_buffer>{};
+    buffers.reserve(2_uz * messages->size());
+
+    for (const auto& message : *messages) {
+        for (const auto* frame : {&message.header_, &message.payload_}) {
+            if (0_uz < frame->size()) {
+                buffers.emplace_back(frame->data(), frame->size());
+            }
+        }
+    }
+
+    boost::asio::async_write(
+        socket->socket_,
+        buffers,
+        [this, socket, messages](auto& e, std::size_t sent) {
+            const auto error = e ? e.message() : UnallocatedCString{};
+            auto remaining = sent;
+
+            for (const auto& message : *messages) {
+                const auto size = message.header_.size() +
+                                  message.payload_.size();
+                const auto bytes = std::min(remaining, size);
+                remaining -= bytes;
+                send_result(reader(message.notify_), bytes, error);
+            }
+
+            if (e) {
+                // NOTE the connection can not be written to after an error
+                // and its owner has already been told the write failed, so
+                // anything still queued is discarded instead of flushed
+                const auto discarded = discard(socket);
+                LogVerbose()(OT_PRETTY_CLASS())("write failed: ")(error)(
+                    ", discarded ")(discarded)(" queued messages")
+                    .Flush();
+
+                return;
+            }
+
+            flush(socket);
+        });
+}
+
+auto Asio::Imp::send_result(
+    const ReadView connection,
+    const std::size_t bytes,
+    const std::string_view error) noexcept -> void
+{
+    static constexpr auto trueValue = std::byte{0x01};
+    static constexpr auto falseValue = std::byte{0x00};
+    data_socket_->Send([&] {
+        auto work = opentxs::network::zeromq::tagged_reply_to_connection(
+            connection, value(WorkType::AsioSendResult));
+        work.AddFrame(bytes);
+
+        if (error.empty()) {
+            work.AddFrame(trueValue);
+        } else {
+            work.AddFrame(falseValue);
+            work.AddFrame(error.data(), error.size());
+        }
+
+        return work;
+    }());
 }
 
 Asio::Imp::~Imp() { Shutdown(); }
@@ -95,6 +95,7 @@ class Raw;
 }  // namespace socket
 
 class Context;
+class Frame;
 class Message;
 }  // namespace zeromq
 }  // namespace network
@@ -151,6 +152,11 @@ struct Asio::Imp final : public api::network::internal::Asio,
         const ReadView id,
         const ReadView bytes,
         Socket socket) noexcept -> bool final;
+    auto Transmit(
+        const ReadView id,
+        zmq::Frame&& header,
+        zmq::Frame&& payload,
+        Socket socket) noexcept -> bool final;
 
     Imp(const zmq::Context& zmq) noexcept;
     Imp() = delete;
@@ -182,6 +188,13 @@ private:
         const unsigned http_version{};
     };
 
+    // NOTE reads of at least this many bytes are delivered in a frame which
+    // asio fills directly. Smaller reads use a buffer from buffers_.
+    static constexpr auto direct_receive_ = std::size_t{1024};
+    // NOTE limits how many queued messages are combined into a single write
+    static constexpr auto max_write_messages_ = std::size_t{64};
+    static constexpr auto max_write_bytes_ = std::size_t{16u * 1024u * 1024u};
+
     static auto sites() -> const Vector<Site>&;
 
     const zmq::Context& zmq_;
@@ -222,12 +235,25 @@ private:
     auto send_notification(const ReadView notify) const noexcept -> void;
 
     auto data_callback(zmq::Message&& in) noexcept -> void;
+    // NOTE returns the number of queued messages which were discarded
+    auto discard(Socket socket) noexcept -> std::size_t;
+    auto flush(Socket socket) noexcept -> void;
+    auto receive(
+        const Space& connection,
+        const UnallocatedCString& address,
+        const OTZMQWorkType type,
+        const boost::system::error_code& e,
+        zmq::Frame&& payload) noexcept -> void;
     auto retrieve_address_async(
         const struct Site& site,
         std::shared_ptr<std::promise<ByteArray>> promise) -> void;
     auto retrieve_address_async_ssl(
         const struct Site& site,
         std::shared_ptr<std::promise<ByteArray>> promise) -> void;
+    auto send_result(
+        const ReadView connection,
+        const std::size_t bytes,
+        const std::string_view error) noexcept -> void;
 
     auto state_machine() noexcept -> bool;
 };
@@ -351,6 +351,7 @@ auto BlockchainImp::Init(
         auto out = std::make_unique<Config>();
         auto& output = *out;
         output.profile_ = options.BlockchainProfile();
+        output.block_cache_bytes_ = options.BlockchainBlockCacheBytes();
 
         switch (output.profile_) {
             case BlockchainProfile::mobile:
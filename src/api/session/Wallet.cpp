@@ -21,7 +21,9 @@
 #include <algorithm>
 #include <atomic>
 #include <functional>
+#include <future>
 #include <iterator>
+#include <memory>
 #include <stdexcept>
 #include <string_view>
 #include <thread>
@@ -59,6 +61,7 @@
 #include "internal/serialization/protobuf/verify/UnitDefinition.hpp"
 #include "internal/util/Exclusive.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
 #include "internal/util/Shared.hpp"
 #include "opentxs/api/network/Network.hpp"
 #include "opentxs/api/session/Crypto.hpp"
@@ -140,6 +143,7 @@ Wallet::Wallet(const api::Session& api)
     , nymfile_lock_()
     , purse_lock_()
     , purse_map_()
+    , verified_nyms_()
     , account_publisher_(api_.Network().ZeroMQ().PublishSocket())
     , issuer_publisher_(api_.Network().ZeroMQ().PublishSocket())
     , nym_publisher_(api_.Network().ZeroMQ().PublishSocket())
@@ -787,6 +791,19 @@ auto Wallet::extract_unit(const contract::Unit& contract) const -> UnitType
     }
 }
 
+auto Wallet::credential_index(const identity::internal::Nym& nym) noexcept
+    -> Space
+{
+    auto out = Space{};
+
+    if (false == nym.SerializeCredentialIndex(
+                     writer(out), identity::internal::Nym::Mode::Abbreviated)) {
+        out.clear();
+    }
+
+    return out;
+}
+
 auto Wallet::context(
     const identifier::Nym& localNymID,
     const identifier::Nym& remoteNymID) const
@@ -1086,6 +1103,27 @@ auto Wallet::LocalNyms() const -> Set<identifier::Nym>
 auto Wallet::Nym(
     const identifier::Nym& id,
     const std::chrono::milliseconds& timeout) const -> Nym_p
+{
+    if (0ms >= timeout) { return nym(id, nullptr); }
+
+    auto wait = NymWait{};
+
+    if (auto out = nym(id, &wait); out) { return out; }
+
+    if (false == wait.future_.valid()) { return nullptr; }
+
+    auto out = Nym_p{};
+
+    if (std::future_status::ready == wait.future_.wait_for(timeout)) {
+        out = wait.future_.get();
+    }
+
+    nym_wait_done(id, wait);
+
+    return out;
+}
+
+auto Wallet::nym(const identifier::Nym& id, NymWait* wait) const -> Nym_p
 {
     if (blockchain::Type::Unknown != blockchain::Chain(api_, id)) {
         LogError()(OT_PRETTY_CLASS())(
@@ -1095,7 +1133,20 @@ auto Wallet::Nym(
         return nullptr;
     }
 
-    auto mapLock = Lock{nym_map_lock_};
+    {
+        auto mapLock = sLock{nym_map_lock_};
+
+        if (auto it = nym_map_.find(id); nym_map_.end() != it) {
+            auto pNym = it->second.second;
+            mapLock.unlock();
+
+            if (pNym && verify_nym(pNym)) { return pNym; }
+
+            return nullptr;
+        }
+    }
+
+    auto mapLock = eLock{nym_map_lock_};
     bool inMap = (nym_map_.find(id) != nym_map_.end());
     bool valid = false;
 
@@ -1109,36 +1160,23 @@ auto Wallet::Nym(
             pNym.reset(opentxs::Factory::Nym(api_, serialized, alias));
 
             if (pNym && pNym->CompareID(id)) {
-                valid = pNym->VerifyPseudonym();
+                valid = verify_nym(pNym);
                 pNym->SetAliasStartup(alias);
+
+                if (valid) { nym_arrived(pNym); }
             } else {
                 nym_map_.erase(id);
             }
-        } else {
+        } else if (nullptr == wait) {
             search_nym(id);
-
-            if (timeout > 0ms) {
-                mapLock.unlock();
-                auto start = std::chrono::high_resolution_clock::now();
-                auto end = start + timeout;
-                const auto interval = 100ms;
-
-                while (std::chrono::high_resolution_clock::now() < end) {
-                    std::this_thread::sleep_for(interval);
-                    mapLock.lock();
-                    bool found = (nym_map_.find(id) != nym_map_.end());
-                    mapLock.unlock();
-
-                    if (found) { break; }
-                }
-
-                return Nym(id);  // timeout of zero prevents infinite
-                                 // recursion
-            }
+        } else {
+            // NOTE the waiter must be registered before nym_map_lock_ is
+            // released so that it can not miss the arrival of the nym
+            *wait = nym_wait(id);
         }
     } else {
         auto& pNym = nym_map_[id].second;
-        if (pNym) { valid = pNym->VerifyPseudonym(); }
+        if (pNym) { valid = verify_nym(pNym); }
     }
 
     if (valid) { return nym_map_[id].second; }
@@ -1180,15 +1218,17 @@ auto Wallet::Nym(const proto::Nym& serialized) const -> Nym_p
             candidate.WriteCredentials();
             SaveCredentialIDs(candidate);
             auto mapNym = [&] {
-                auto mapLock = Lock{nym_map_lock_};
+                auto mapLock = eLock{nym_map_lock_};
                 auto& out = nym_map_[nymID].second;
                 // TODO update existing nym rather than destroying it
                 out.reset(pCandidate.release());
+                nym_verified(out);
 
                 return out;
             }();
 
             notify_new(nymID);
+            nym_arrived(mapNym);
 
             return std::move(mapNym);
         } else {
@@ -1250,7 +1290,7 @@ auto Wallet::Nym(
         nym.SetAlias(name);
 
         {
-            auto mapLock = Lock{nym_map_lock_};
+            auto mapLock = sLock{nym_map_lock_};
             auto it = nym_map_.find(id);
 
             if (nym_map_.end() != it) { return it->second.second; }
@@ -1273,9 +1313,10 @@ auto Wallet::Nym(
             }
 
             {
-                auto mapLock = Lock{nym_map_lock_};
+                auto mapLock = eLock{nym_map_lock_};
                 auto& pMapNym = nym_map_[id].second;
                 pMapNym = pNym;
+                nym_verified(pMapNym);
                 nym_created_publisher_->Send([&] {
                     auto work = opentxs::network::zeromq::tagged_message(
                         WorkType::NymCreated);
@@ -1285,6 +1326,8 @@ auto Wallet::Nym(
                 }());
             }
 
+            nym_arrived(pNym);
+
             return std::move(pNym);
         } else {
             LogError()(OT_PRETTY_CLASS())("Failed to save credentials").Flush();
@@ -1308,7 +1351,7 @@ auto Wallet::mutable_Nym(
         LogError()(OT_PRETTY_CLASS())("Nym ")(nym)(" not found.").Flush();
     }
 
-    auto mapLock = Lock{nym_map_lock_};
+    auto mapLock = sLock{nym_map_lock_};
     auto it = nym_map_.find(id);
 
     if (nym_map_.end() == it) { OT_FAIL; }
@@ -1402,6 +1445,81 @@ auto Wallet::notify_new(const identifier::Nym& id) const noexcept -> void
     notify_changed(id);
 }
 
+auto Wallet::nym_arrived(const Nym_p& nym) const noexcept -> void
+{
+    OT_ASSERT(nym);
+
+    auto handle = nym_waiters_.lock();
+    auto& map = handle->map_;
+
+    if (auto i = map.find(nym->ID()); map.end() != i) {
+        i->second.promise_.set_value(nym);
+        map.erase(i);
+    }
+}
+
+auto Wallet::nym_modified(const identifier::Nym& id) const noexcept -> void
+{
+    auto handle = verified_nyms_.lock();
+    auto& map = *handle;
+
+    if (auto i = map.find(id); map.end() != i) { i->second.current_ = false; }
+}
+
+auto Wallet::nym_verified(
+    const std::shared_ptr<identity::internal::Nym>& nym) const noexcept -> void
+{
+    OT_ASSERT(nym);
+
+    auto cached =
+        VerifiedNym{nym, nym->Revision(), credential_index(*nym), true};
+    verified_nyms_.lock()->insert_or_assign(nym->ID(), std::move(cached));
+}
+
+auto Wallet::nym_wait(const identifier::Nym& id) const noexcept -> NymWait
+{
+    auto out = NymWait{};
+    const auto search = [&] {
+        auto handle = nym_waiters_.lock();
+        auto& waiters = *handle;
+        auto [i, added] = waiters.map_.try_emplace(id);
+        auto& waiter = i->second;
+
+        if (added) {
+            waiter.key_ = ++waiters.next_key_;
+            waiter.future_ = waiter.promise_.get_future().share();
+        }
+
+        ++waiter.waiting_;
+        out.key_ = waiter.key_;
+        out.future_ = waiter.future_;
+
+        return added;
+    }();
+
+    // NOTE only the first waiter queries the network
+    if (search) { search_nym(id); }
+
+    return out;
+}
+
+auto Wallet::nym_wait_done(const identifier::Nym& id, const NymWait& wait)
+    const noexcept -> void
+{
+    auto handle = nym_waiters_.lock();
+    auto& map = handle->map_;
+
+    if (auto i = map.find(id); map.end() != i) {
+        auto& waiter = i->second;
+
+        // NOTE a different key means the entry this caller was waiting on was
+        // already fulfilled and a new one has since been created
+        if (waiter.key_ != wait.key_) { return; }
+
+        if (0_uz == --waiter.waiting_) { map.erase(i); }
+    }
+}
+
 auto Wallet::nymfile_lock(const identifier::Nym& nymID) const -> std::mutex&
 {
     Lock map_lock(nymfile_map_lock_);
@@ -1449,6 +1567,40 @@ auto Wallet::NymNameByIndex(const std::size_t index, String& name) const -> bool
     return false;
 }
 
+auto Wallet::Nyms(
+    const UnallocatedVector<identifier::Nym>& ids,
+    const std::chrono::milliseconds& timeout) const -> UnallocatedVector<Nym_p>
+{
+    auto out = UnallocatedVector<Nym_p>{};
+    auto waiting = UnallocatedVector<std::pair<std::size_t, NymWait>>{};
+    out.reserve(ids.size());
+    const auto wait = (0ms < timeout);
+
+    for (auto i = 0_uz; i < ids.size(); ++i) {
+        auto pending = NymWait{};
+        const auto& nym = out.emplace_back(
+            this->nym(ids[i], wait ? std::addressof(pending) : nullptr));
+
+        if ((false == bool(nym)) && pending.future_.valid()) {
+            waiting.emplace_back(i, std::move(pending));
+        }
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    for (const auto& [index, pending] : waiting) {
+        const auto& future = pending.future_;
+
+        if (std::future_status::ready == future.wait_until(deadline)) {
+            out[index] = future.get();
+        }
+
+        nym_wait_done(ids[index], pending);
+    }
+
+    return out;
+}
+
 auto Wallet::peer_lock(const UnallocatedCString& nymID) const -> std::mutex&
 {
     Lock map_lock(peer_map_lock_);
@@ -2611,6 +2763,7 @@ void Wallet::save(NymData* nymData, const Lock& lock) const
     OT_ASSERT(nullptr != nymData);
     OT_ASSERT(lock.owns_lock());
 
+    nym_modified(nymData->nym().ID());
     SaveCredentialIDs(nymData->nym());
     notify_changed(nymData->nym().ID());
 }
@@ -2731,7 +2884,7 @@ auto Wallet::SetNymAlias(
     const identifier::Nym& id,
     const UnallocatedCString& alias) const -> bool
 {
-    auto mapLock = Lock{nym_map_lock_};
+    auto mapLock = eLock{nym_map_lock_};
     auto& nym = nym_map_[id].second;
     nym->SetAlias(alias);
 
@@ -3422,5 +3575,64 @@ auto Wallet::SaveCredential(const proto::Credential& credential) const -> bool
     return api_.Storage().Store(credential);
 }
 
+auto Wallet::verify_nym(
+    const std::shared_ptr<identity::internal::Nym>& pNym) const noexcept
+    -> bool
+{
+    OT_ASSERT(pNym);
+
+    const auto& nym = *pNym;
+    const auto& id = nym.ID();
+    const auto revision = nym.Revision();
+
+    {
+        const auto handle = verified_nyms_.lock_shared();
+        const auto& map = *handle;
+
+        if (auto i = map.find(id); map.end() != i) {
+            const auto& cached = i->second;
+
+            if (cached.current_ && (cached.nym_.lock() == pNym) &&
+                (revision == cached.revision_)) {
+
+                return true;
+            }
+        }
+    }
+
+    auto index = credential_index(nym);
+
+    if (false == index.empty()) {
+        auto handle = verified_nyms_.lock();
+        auto& map = *handle;
+
+        if (auto i = map.find(id); map.end() != i) {
+            auto& cached = i->second;
+
+            // NOTE the nym was edited since it was last verified but neither
+            // its revision nor any of its credentials have changed
+            if ((cached.nym_.lock() == pNym) &&
+                (revision == cached.revision_) && (index == cached.index_)) {
+                cached.current_ = true;
+
+                return true;
+            }
+        }
+    }
+
+    if (false == nym.VerifyPseudonym()) {
+        verified_nyms_.lock()->erase(id);
+
+        return false;
+    }
+
+    // NOTE the revision which was read before verification is stored so a
+    // concurrent edit will cause the next lookup to verify the nym again
+    auto cached = VerifiedNym{pNym, revision, std::move(index), true};
+    verified_nyms_.lock()->insert_or_assign(id, std::move(cached));
+
+    return true;
+}
+
 Wallet::~Wallet() { handle_.Release(); }
 }  // namespace opentxs::api::session::imp
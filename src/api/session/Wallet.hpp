@@ -10,10 +10,13 @@
 
 #include <ContactEnums.pb.h>
 #include <cs_deferred_guarded.h>
+#include <cs_plain_guarded.h>
+#include <cs_shared_guarded.h>
 #include <chrono>
 #include <cstdint>
 #include <ctime>
 #include <functional>
+#include <future>
 #include <iosfwd>
 #include <memory>
 #include <mutex>
@@ -254,6 +257,10 @@ public:
     auto NymList() const -> ObjectList final;
     auto NymNameByIndex(const std::size_t index, String& name) const
         -> bool final;
+    auto Nyms(
+        const UnallocatedVector<identifier::Nym>& ids,
+        const std::chrono::milliseconds& timeout) const
+        -> UnallocatedVector<Nym_p> final;
     auto PeerReply(
         const identifier::Nym& nym,
         const identifier::Generic& reply,
@@ -493,6 +500,47 @@ private:
         opentxs::network::zeromq::socket::Raw,
         std::shared_mutex>;
 
+    // NOTE records the outcome of the most recent successful call to
+    // VerifyPseudonym for a nym instance. An entry is only trusted while it
+    // refers to the instance currently held in nym_map_ and that instance
+    // still has the same revision. The instance is tracked by weak_ptr so a
+    // replacement allocated at the address of a destroyed nym never matches.
+    // Entries which have been invalidated by an edit are revived without
+    // repeating the verification if neither the revision nor the credential
+    // index changed.
+    struct VerifiedNym {
+        std::weak_ptr<const identity::internal::Nym> nym_{};
+        std::uint64_t revision_{};
+        Space index_{};
+        bool current_{};
+    };
+
+    using VerifiedNymMap = UnallocatedMap<identifier::Nym, VerifiedNym>;
+    using GuardedVerifiedNyms =
+        libguarded::shared_guarded<VerifiedNymMap, std::shared_mutex>;
+
+    // NOTE every caller waiting for the same unknown nym shares one promise,
+    // which is fulfilled as soon as the nym is added to nym_map_. Entries are
+    // removed once they are fulfilled or once the last waiter gives up.
+    struct NymWaiter {
+        std::size_t key_{};
+        std::size_t waiting_{};
+        std::promise<Nym_p> promise_{};
+        std::shared_future<Nym_p> future_{};
+    };
+
+    struct NymWait {
+        std::size_t key_{};
+        std::shared_future<Nym_p> future_{};
+    };
+
+    struct NymWaiters {
+        std::size_t next_key_{};
+        UnallocatedMap<identifier::Nym, NymWaiter> map_{};
+    };
+
+    using GuardedNymWaiters = libguarded::plain_guarded<NymWaiters>;
+
     mutable AccountMap account_map_;
     mutable NymMap nym_map_;
     mutable ServerMap server_map_;
@@ -500,7 +548,7 @@ private:
     mutable IssuerMap issuer_map_;
     mutable std::mutex create_nym_lock_;
     mutable std::mutex account_map_lock_;
-    mutable std::mutex nym_map_lock_;
+    mutable std::shared_mutex nym_map_lock_;
     mutable std::mutex server_map_lock_;
     mutable std::mutex unit_map_lock_;
     mutable std::mutex issuer_map_lock_;
@@ -510,6 +558,8 @@ private:
     mutable UnallocatedMap<identifier::Generic, std::mutex> nymfile_lock_;
     mutable std::mutex purse_lock_;
     mutable PurseMap purse_map_;
+    mutable GuardedVerifiedNyms verified_nyms_;
+    mutable GuardedNymWaiters nym_waiters_;
     OTZMQPublishSocket account_publisher_;
     OTZMQPublishSocket issuer_publisher_;
     OTZMQPublishSocket nym_publisher_;
@@ -527,6 +577,8 @@ private:
     mutable GuardedSocket to_loopback_;
     opentxs::network::zeromq::internal::Thread* thread_;
 
+    static auto credential_index(const identity::internal::Nym& nym) noexcept
+        -> Space;
     static auto reverse_unit_map(const UnitNameMap& map) -> UnitNameReverse;
 
     auto account_alias(
@@ -569,6 +621,14 @@ private:
         [[maybe_unused]] const UnallocatedCString& name) const noexcept
     {
     }
+    auto nym(const identifier::Nym& id, NymWait* wait) const -> Nym_p;
+    auto nym_arrived(const Nym_p& nym) const noexcept -> void;
+    auto nym_modified(const identifier::Nym& id) const noexcept -> void;
+    auto nym_verified(const std::shared_ptr<identity::internal::Nym>& nym)
+        const noexcept -> void;
+    auto nym_wait(const identifier::Nym& id) const noexcept -> NymWait;
+    auto nym_wait_done(const identifier::Nym& id, const NymWait& wait)
+        const noexcept -> void;
     auto nymfile_lock(const identifier::Nym& nymID) const -> std::mutex&;
     auto peer_lock(const UnallocatedCString& nymID) const -> std::mutex&;
     auto process_p2p(opentxs::network::zeromq::Message&& msg) const noexcept
@@ -609,6 +669,8 @@ private:
     auto search_unit(const identifier::UnitDefinition& id) const noexcept
         -> void;
     virtual auto signer_nym(const identifier::Nym& id) const -> Nym_p = 0;
+    auto verify_nym(const std::shared_ptr<identity::internal::Nym>& nym)
+        const noexcept -> bool;
 
     /* Throws std::out_of_range for missing accounts */
     auto account(
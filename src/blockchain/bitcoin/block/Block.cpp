@@ -24,20 +24,30 @@
 
 #include "blockchain/bitcoin/block/BlockParser.hpp"
 #include "blockchain/block/Block.hpp"
+#include "internal/blockchain/bitcoin/block/Block.hpp"
 #include "internal/blockchain/bitcoin/block/Factory.hpp"
 #include "internal/blockchain/bitcoin/block/Transaction.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/P0330.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
+#include "opentxs/api/session/Crypto.hpp"
+#include "opentxs/api/session/Session.hpp"
 #include "opentxs/blockchain/Blockchain.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
 #include "opentxs/blockchain/bitcoin/block/Block.hpp"
 #include "opentxs/blockchain/bitcoin/block/Header.hpp"
+#include "opentxs/blockchain/bitcoin/block/Input.hpp"
+#include "opentxs/blockchain/bitcoin/block/Inputs.hpp"
+#include "opentxs/blockchain/bitcoin/block/Output.hpp"
+#include "opentxs/blockchain/bitcoin/block/Outputs.hpp"
+#include "opentxs/blockchain/bitcoin/block/Script.hpp"
 #include "opentxs/blockchain/bitcoin/block/Transaction.hpp"
 #include "opentxs/blockchain/block/Hash.hpp"
 #include "opentxs/blockchain/block/Header.hpp"
 #include "opentxs/blockchain/block/Types.hpp"
 #include "opentxs/core/ByteArray.hpp"  // IWYU pragma: keep
 #include "opentxs/core/Data.hpp"
+#include "opentxs/crypto/HashType.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Iterator.hpp"
 #include "opentxs/util/Log.hpp"
@@ -231,6 +241,116 @@ auto parse_normal_block(
 }
 }  // namespace opentxs::factory
 
+namespace opentxs::blockchain::bitcoin::block::internal
+{
+auto CheckWitnessCommitment(
+    const api::Session& api,
+    const bitcoin::block::Block& block) noexcept -> bool
+{
+    static constexpr auto header = std::array<std::byte, 6>{
+        std::byte{0x6a},
+        std::byte{0x24},
+        std::byte{0xaa},
+        std::byte{0x21},
+        std::byte{0xa9},
+        std::byte{0xed}};
+    static constexpr auto commitmentBytes = header.size() + 32_uz;
+
+    try {
+        const auto chain = block.Header().Type();
+
+        if (false == blockchain::HasSegwit(chain)) { return true; }
+
+        if (0_uz == block.size()) { return false; }
+
+        const auto& coinbase = block.at(0_uz);
+
+        if (false == bool(coinbase)) { return false; }
+
+        // NOTE if more than one output matches the commitment pattern the
+        // last one is authoritative
+        auto commitment = std::optional<Space>{};
+
+        for (const auto& output : coinbase->Outputs()) {
+            auto script = Space{};
+
+            if (false == output.Script().Serialize(writer(script))) {
+                continue;
+            }
+
+            const auto match =
+                (commitmentBytes <= script.size()) &&
+                (0 == std::memcmp(script.data(), header.data(), header.size()));
+
+            if (match) { commitment.emplace(std::move(script)); }
+        }
+
+        const auto hasWitness = std::any_of(
+            block.begin(), block.end(), [](const auto& tx) {
+                const auto& inputs = tx->Inputs();
+
+                return std::any_of(
+                    inputs.begin(), inputs.end(), [](const auto& input) {
+                        return false == input.Witness().empty();
+                    });
+            });
+
+        if (false == commitment.has_value()) { return false == hasWitness; }
+
+        const auto& reserved = [&]() -> const UnallocatedVector<Space>& {
+            const auto& inputs = coinbase->Inputs();
+
+            if (1_uz != inputs.size()) {
+                throw std::runtime_error{"invalid coinbase inputs"};
+            }
+
+            return inputs.at(0_uz).Witness();
+        }();
+
+        if ((1_uz != reserved.size()) || (32_uz != reserved.at(0).size())) {
+            return false;
+        }
+
+        auto wtxids = implementation::Block::TxidIndex{};
+        wtxids.reserve(block.size());
+        // NOTE the coinbase wtxid is defined as all zero bytes
+        wtxids.emplace_back(32_uz, std::byte{0x00});
+
+        for (auto i = 1_uz, stop = block.size(); i < stop; ++i) {
+            const auto bytes = block.at(i)->WTXID().Bytes();
+            const auto* it = reinterpret_cast<const std::byte*>(bytes.data());
+            wtxids.emplace_back(it, std::next(it, bytes.size()));
+        }
+
+        const auto root =
+            implementation::Block::calculate_merkle_value(api, chain, wtxids);
+        auto preimage = Space{};
+        preimage.reserve(64_uz);
+        const auto* r = reinterpret_cast<const std::byte*>(root.data());
+        preimage.insert(preimage.end(), r, std::next(r, root.size()));
+        preimage.insert(
+            preimage.end(), reserved.at(0).begin(), reserved.at(0).end());
+        auto expected = Space{};
+        const auto hashed = api.Crypto().Hash().Digest(
+            opentxs::crypto::HashType::Sha256D,
+            reader(preimage),
+            writer(expected));
+
+        if (false == hashed) { return false; }
+
+        return (32_uz == expected.size()) &&
+               (0 == std::memcmp(
+                         std::next(commitment->data(), header.size()),
+                         expected.data(),
+                         expected.size()));
+    } catch (const std::exception& e) {
+        LogError()(__func__)(": ")(e.what()).Flush();
+
+        return false;
+    }
+}
+}  // namespace opentxs::blockchain::bitcoin::block::internal
+
 namespace opentxs::blockchain::bitcoin::block::implementation
 {
 const std::size_t Block::header_bytes_{80};
@@ -9,7 +9,7 @@
 
 #include <GCS.pb.h>
 #include <boost/endian/buffers.hpp>
-#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/endian/conversion.hpp>
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
@@ -50,8 +50,11 @@
 #include "opentxs/util/Log.hpp"
 #include "util/Container.hpp"
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace be = boost::endian;
-namespace bmp = boost::multiprecision;
 
 namespace opentxs
 {
@@ -100,7 +103,7 @@ auto GCS(
 
         const auto count = static_cast<std::uint32_t>(effective.size());
         auto hashed =
-            gcs::HashedSetConstruct(api, key, count, fpRate, effective, alloc);
+            gcs::HashedSetConstruct(key, count, fpRate, effective, alloc);
         auto compressed = gcs::GolombEncode(bits, hashed, alloc);
 
         return std::make_unique<ReturnType>(
@@ -218,6 +221,41 @@ auto GCS(
     }
 }
 
+auto GCSFromStorage(
+    const api::Session& api,
+    const ReadView record,
+    const bool view,
+    alloc::Default alloc) noexcept -> blockchain::GCS
+{
+    using ReturnType = blockchain::implementation::GCS;
+    using Header = blockchain::internal::SerializedCfilter;
+
+    try {
+        if (false == blockchain::internal::IsSerializedCfilter(record)) {
+            throw std::runtime_error{"invalid serialized cfilter"};
+        }
+
+        auto header = Header{};
+        std::memcpy(&header, record.data(), sizeof(header));
+        const auto encoded = record.substr(sizeof(header));
+
+        return std::make_unique<ReturnType>(
+                   api,
+                   header.bits_.value(),
+                   header.fp_rate_.value(),
+                   header.count_.value(),
+                   reader(header.key_),
+                   encoded,
+                   view,
+                   alloc)
+            .release();
+    } catch (const std::exception& e) {
+        LogError()("opentxs::factory::")(__func__)(": ")(e.what()).Flush();
+
+        return std::make_unique<blockchain::GCS::Imp>(alloc).release();
+    }
+}
+
 auto GCS(
     const api::Session& api,
     const blockchain::cfilter::Type type,
@@ -256,7 +294,7 @@ auto GCS(
         const auto key =
             blockchain::internal::BlockHashToFilterKey(block.ID().Bytes());
         auto hashed = gcs::HashedSetConstruct(
-            api, key, count, params.second, elements, alloc);
+            key, count, params.second, elements, alloc);
         auto compressed = gcs::GolombEncode(params.first, hashed, alloc);
 
         return std::make_unique<ReturnType>(
@@ -282,6 +320,159 @@ namespace opentxs::gcs
 using BitReader = blockchain::internal::BitReader;
 using BitWriter = blockchain::internal::BitWriter;
 
+// Returns the high 64 bits of the 128 bit product of lhs and rhs
+static auto multiply_high(
+    const std::uint64_t lhs,
+    const std::uint64_t rhs) noexcept -> std::uint64_t
+{
+#if defined(__SIZEOF_INT128__)
+    using Wide = unsigned __int128;
+
+    return static_cast<std::uint64_t>((Wide{lhs} * Wide{rhs}) >> 64u);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return __umulh(lhs, rhs);
+#else
+    constexpr auto mask = std::uint64_t{0xffffffff};
+    const auto lhsLow = lhs & mask;
+    const auto lhsHigh = lhs >> 32u;
+    const auto rhsLow = rhs & mask;
+    const auto rhsHigh = rhs >> 32u;
+    const auto p0 = lhsLow * rhsLow;
+    const auto p1 = lhsLow * rhsHigh;
+    const auto p2 = lhsHigh * rhsLow;
+    const auto p3 = lhsHigh * rhsHigh;
+    const auto middle = (p0 >> 32u) + (p1 & mask) + (p2 & mask);
+
+    return p3 + (p1 >> 32u) + (p2 >> 32u) + (middle >> 32u);
+#endif
+}
+
+static auto count_leading_zeros(const std::uint64_t value) noexcept
+    -> std::size_t
+{
+    static constexpr auto width = std::size_t{64};
+
+    if (0u == value) { return width; }
+
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_clzll(value));
+#else
+    auto output = 0_uz;
+    auto mask = std::uint64_t{1} << (width - 1u);
+
+    while (0u == (value & mask)) {
+        ++output;
+        mask >>= 1u;
+    }
+
+    return output;
+#endif
+}
+
+// Reads a big endian bitstream 64 bits at a time. The next unread bit is
+// always the most significant bit of window_. Bits beyond the end of the
+// input read as zero, which is the same result BitReader produces for a
+// terminating unary code or a short remainder.
+class WordReader
+{
+public:
+    auto read(const std::size_t nbits) noexcept -> std::uint64_t
+    {
+        OT_ASSERT(nbits < 32u);
+
+        if (0u == nbits) { return 0u; }
+
+        refill();
+
+        if (available_ < nbits) {
+            // NOTE match BitReader behavior for truncated input
+            consume(available_);
+
+            return 0u;
+        }
+
+        const auto output = window_ >> (width_ - nbits);
+        consume(nbits);
+
+        return output;
+    }
+    auto unary() noexcept -> Delta
+    {
+        auto output = Delta{0};
+
+        while (true) {
+            refill();
+
+            if (0u == available_) { break; }
+
+            const auto ones =
+                std::min(count_leading_zeros(~window_), available_);
+            output += ones;
+
+            if (ones < available_) {
+                consume(ones + 1u);
+
+                break;
+            } else {
+                consume(ones);
+            }
+        }
+
+        return output;
+    }
+
+    WordReader(const ReadView data) noexcept
+        : data_(reinterpret_cast<const std::uint8_t*>(data.data()))
+        , remaining_(data.size())
+        , window_(0)
+        , available_(0)
+    {
+    }
+    WordReader() = delete;
+    WordReader(const WordReader&) = delete;
+    WordReader(WordReader&&) = delete;
+    auto operator=(const WordReader&) -> WordReader& = delete;
+    auto operator=(WordReader&&) -> WordReader& = delete;
+
+private:
+    static constexpr auto width_ = sizeof(std::uint64_t) * 8_uz;
+
+    const std::uint8_t* data_;
+    std::size_t remaining_;
+    std::uint64_t window_;
+    std::size_t available_;
+
+    auto consume(const std::size_t nbits) noexcept -> void
+    {
+        OT_ASSERT(nbits <= available_);
+
+        window_ = (width_ == nbits) ? 0u : (window_ << nbits);
+        available_ -= nbits;
+    }
+    auto refill() noexcept -> void
+    {
+        if (available_ >= (width_ - 8u)) { return; }
+
+        if (sizeof(std::uint64_t) <= remaining_) {
+            auto word = std::uint64_t{};
+            std::memcpy(&word, data_, sizeof(word));
+            window_ |= (be::big_to_native(word) >> available_);
+            const auto bytes = (width_ - 1u - available_) / 8u;
+            data_ += bytes;
+            remaining_ -= bytes;
+            available_ += bytes * 8u;
+        } else {
+            while ((available_ <= (width_ - 8u)) && (0u < remaining_)) {
+                const auto shift = width_ - 8u - available_;
+                window_ |= (std::uint64_t{*data_} << shift);
+                ++data_;
+                --remaining_;
+                available_ += 8u;
+            }
+        }
+    }
+};
+
 static auto golomb_decode(const std::uint8_t P, BitReader& stream) noexcept(
     false) -> Delta
 {
@@ -294,6 +485,15 @@ static auto golomb_decode(const std::uint8_t P, BitReader& stream) noexcept(
     return Delta{(quotient << P) + remainder};
 }
 
+static auto golomb_decode(const std::uint8_t P, WordReader& stream) noexcept
+    -> Delta
+{
+    const auto quotient = stream.unary();
+    const auto remainder = stream.read(P);
+
+    return Delta{(quotient << P) + remainder};
+}
+
 static auto golomb_encode(
     const std::uint8_t P,
     const Delta value,
@@ -316,6 +516,34 @@ auto GolombDecode(
     const std::uint8_t P,
     const Vector<std::byte>& encoded,
     alloc::Default alloc) noexcept(false) -> Elements
+{
+    return GolombDecode(N, P, reader(encoded), alloc);
+}
+
+auto GolombDecode(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const ReadView encoded,
+    alloc::Default alloc) noexcept(false) -> Elements
+{
+    auto output = Elements{alloc};
+    output.reserve(N);
+    auto stream = WordReader{encoded};
+    auto last = Element{0};
+
+    for (auto i = 0_uz; i < N; ++i) {
+        last += golomb_decode(P, stream);
+        output.emplace_back(last);
+    }
+
+    return output;
+}
+
+auto GolombDecodeScalar(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const Vector<std::byte>& encoded,
+    alloc::Default alloc) noexcept(false) -> Elements
 {
     auto output = Elements{alloc};
     auto stream = BitReader{encoded};
@@ -354,6 +582,39 @@ auto GolombEncode(
     return output;
 }
 
+auto GolombMatch(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const ReadView encoded,
+    const Elements& targets,
+    alloc::Default alloc) noexcept(false) -> Elements
+{
+    auto output = Elements{alloc};
+
+    if (targets.empty()) { return output; }
+
+    auto stream = WordReader{encoded};
+    auto target = targets.cbegin();
+    const auto end = targets.cend();
+    auto last = Element{0};
+
+    for (auto i = 0_uz; i < N; ++i) {
+        last += golomb_decode(P, stream);
+
+        while (*target < last) {
+            if (++target == end) { return output; }
+        }
+
+        if (*target == last) {
+            output.emplace_back(last);
+
+            if (++target == end) { return output; }
+        }
+    }
+
+    return output;
+}
+
 auto HashToRange(
     const api::Session& api,
     const ReadView key,
@@ -363,14 +624,36 @@ auto HashToRange(
     return HashToRange(range, Siphash(api, key, item));
 }
 
-auto HashToRange(const Range range, const Hash hash) noexcept(false) -> Element
+auto HashToRange(const Range range, const Hash hash) noexcept -> Element
 {
-    return ((bmp::uint128_t{hash} * bmp::uint128_t{range}) >> 64u)
-        .convert_to<Element>();
+    return multiply_high(hash, range);
+}
+
+auto HashToRange(
+    const Range range,
+    const Hash* in,
+    const std::size_t count,
+    Element* out) noexcept -> void
+{
+    static constexpr auto unroll = 4_uz;
+    const auto full = count - (count % unroll);
+    auto i = 0_uz;
+
+    for (; i < full; i += unroll) {
+        const auto h0 = in[i];
+        const auto h1 = in[i + 1u];
+        const auto h2 = in[i + 2u];
+        const auto h3 = in[i + 3u];
+        out[i] = multiply_high(h0, range);
+        out[i + 1u] = multiply_high(h1, range);
+        out[i + 2u] = multiply_high(h2, range);
+        out[i + 3u] = multiply_high(h3, range);
+    }
+
+    for (; i < count; ++i) { out[i] = multiply_high(in[i], range); }
 }
 
 auto HashedSetConstruct(
-    const api::Session& api,
     const ReadView key,
     const std::uint32_t N,
     const std::uint32_t M,
@@ -378,13 +661,9 @@ auto HashedSetConstruct(
     alloc::Default alloc) noexcept(false) -> Elements
 {
     auto output = Elements{alloc};
-    std::transform(
-        std::begin(items),
-        std::end(items),
-        std::back_inserter(output),
-        [&](const auto& item) {
-            return HashToRange(api, key, range(N, M), item);
-        });
+    output.resize(items.size());
+    Siphash(key, items, output.data());
+    HashToRange(range(N, M), output.data(), output.size(), output.data());
     std::sort(output.begin(), output.end());
 
     return output;
@@ -409,6 +688,47 @@ auto Siphash(
 }
 }  // namespace opentxs::gcs
 
+namespace opentxs::blockchain::internal
+{
+SerializedCfilter::SerializedCfilter(
+    const std::uint8_t bits,
+    const std::uint32_t fpRate,
+    const std::uint32_t count,
+    const ReadView key) noexcept(false)
+    : version_(current_version_)
+    , fp_rate_(fpRate)
+    , count_(count)
+    , bits_(bits)
+    , key_()
+{
+    static_assert(sizeof(SerializedCfilter) == 29u);
+
+    if (false == copy(key, writer(key_))) {
+        throw std::runtime_error(
+            "Invalid key size: " + std::to_string(key.size()));
+    }
+}
+
+SerializedCfilter::SerializedCfilter() noexcept
+    : version_()
+    , fp_rate_()
+    , count_()
+    , bits_()
+    , key_()
+{
+}
+
+auto IsSerializedCfilter(const ReadView bytes) noexcept -> bool
+{
+    if (sizeof(SerializedCfilter) > bytes.size()) { return false; }
+
+    auto header = SerializedCfilter{};
+    std::memcpy(&header, bytes.data(), sizeof(header));
+
+    return SerializedCfilter::current_version_ == header.version_.value();
+}
+}  // namespace opentxs::blockchain::internal
+
 namespace opentxs::blockchain::implementation
 {
 GCS::GCS(
@@ -419,6 +739,7 @@ GCS::GCS(
     const std::uint32_t count,
     std::optional<gcs::Elements>&& elements,
     Vector<std::byte>&& compressed,
+    const ReadView view,
     ReadView key,
     allocator_type alloc) noexcept(false)
     : Imp(alloc)
@@ -429,10 +750,16 @@ GCS::GCS(
     , count_(count)
     , key_()
     , compressed_(std::move(compressed), alloc)
+    , encoded_(compressed_.empty() ? view : reader(compressed_))
     , elements_(std::move(elements))
 {
     static_assert(16u == sizeof(key_));
 
+    if (32u <= bits_) {
+        throw std::runtime_error(
+            "Invalid bit count: " + std::to_string(bits_));
+    }
+
     if (false == copy(key, writer(const_cast<Key&>(key_)))) {
         throw std::runtime_error(
             "Invalid key size: " + std::to_string(key.size()));
@@ -447,19 +774,27 @@ GCS::GCS(
     const ReadView key,
     const ReadView encoded,
     allocator_type alloc) noexcept(false)
-    : GCS(
-          1,
+    : GCS(api, bits, fpRate, count, key, encoded, false, alloc)
+{
+}
+
+GCS::GCS(
+    const api::Session& api,
+    const std::uint8_t bits,
+    const std::uint32_t fpRate,
+    const std::uint32_t count,
+    const ReadView key,
+    const ReadView encoded,
+    const bool view,
+    allocator_type alloc) noexcept(false)
+    : GCS(1,
           api,
           bits,
           fpRate,
           count,
           std::nullopt,
-          [&] {
-              auto out = Vector<std::byte>{alloc};
-              copy(encoded, writer(out));
-
-              return out;
-          }(),
+          view ? Vector<std::byte>{alloc} : space(encoded, alloc),
+          view ? encoded : ReadView{},
           key,
           alloc)
 {
@@ -480,6 +815,7 @@ GCS::GCS(
           count,
           std::nullopt,
           std::move(encoded),
+          {},
           key,
           alloc)
 {
@@ -501,6 +837,7 @@ GCS::GCS(
           count,
           std::move(hashed),
           std::move(compressed),
+          {},
           key,
           alloc)
 {
@@ -522,7 +859,8 @@ GCS::GCS(const GCS& rhs, allocator_type alloc) noexcept
                   return std::nullopt;
               }
           }(),
-          Vector<std::byte>{rhs.compressed_, alloc},
+          space(rhs.encoded_, alloc),
+          {},
           reader(rhs.key_),
           alloc)
 {
@@ -530,14 +868,14 @@ GCS::GCS(const GCS& rhs, allocator_type alloc) noexcept
 
 auto GCS::Compressed(AllocateOutput out) const noexcept -> bool
 {
-    return copy(reader(compressed_), out);
+    return copy(encoded_, out);
 }
 
 auto GCS::decompress() const noexcept -> const gcs::Elements&
 {
     if (false == elements_.has_value()) {
         auto& set = elements_;
-        set = gcs::GolombDecode(count_, bits_, compressed_, alloc_);
+        set = gcs::GolombDecode(count_, bits_, encoded_, alloc_);
         std::sort(set.value().begin(), set.value().end());
     }
 
@@ -556,13 +894,13 @@ auto GCS::Encode(AllocateOutput cb) const noexcept -> bool
     const auto bytes = CompactSize{count_}.Encode();
     const auto max = std::numeric_limits<std::size_t>::max() - bytes.size();
 
-    if (max < compressed_.size()) {
+    if (max < encoded_.size()) {
         LogError()(OT_PRETTY_CLASS())("filter is too large to encode").Flush();
 
         return false;
     }
 
-    const auto target = bytes.size() + compressed_.size();
+    const auto target = bytes.size() + encoded_.size();
     auto out = cb(target);
 
     if (false == out.valid()) {
@@ -576,9 +914,9 @@ auto GCS::Encode(AllocateOutput cb) const noexcept -> bool
     std::memcpy(i, bytes.data(), bytes.size());
     std::advance(i, bytes.size());
 
-    if (0u < compressed_.size()) {
-        std::memcpy(i, compressed_.data(), compressed_.size());
-        std::advance(i, compressed_.size());
+    if (0u < encoded_.size()) {
+        std::memcpy(i, encoded_.data(), encoded_.size());
+        std::advance(i, encoded_.size());
     }
 
     return true;
@@ -610,13 +948,9 @@ auto GCS::hashed_set_construct(const gcs::Hashes& targets, allocator_type alloc)
     const noexcept -> gcs::Elements
 {
     auto out = gcs::Elements{alloc};
-    out.reserve(targets.size());
-    const auto range = Range();
-    std::transform(
-        targets.begin(),
-        targets.end(),
-        std::back_inserter(out),
-        [&](const auto& hash) { return gcs::HashToRange(range, hash); });
+    out.resize(targets.size());
+    gcs::HashToRange(Range(), targets.data(), targets.size(), out.data());
+    std::sort(out.begin(), out.end());
 
     return out;
 }
@@ -625,7 +959,7 @@ auto GCS::hashed_set_construct(const Targets& elements, allocator_type alloc)
     const noexcept -> gcs::Elements
 {
     return gcs::HashedSetConstruct(
-        api_, reader(key_), count_, false_positive_rate_, elements, alloc);
+        reader(key_), count_, false_positive_rate_, elements, alloc);
 }
 
 auto GCS::hash_to_range(const ReadView in) const noexcept -> gcs::Range
@@ -667,13 +1001,7 @@ auto GCS::Match(const Targets& targets, allocator_type alloc) const noexcept
     }
 
     dedup(hashed);
-    const auto& set = decompress();
-    std::set_intersection(
-        std::begin(hashed),
-        std::end(hashed),
-        std::begin(set),
-        std::end(set),
-        std::back_inserter(matches));
+    match(hashed, matches);
 
     for (const auto& match : matches) {
         auto& values = map.at(match);
@@ -708,13 +1036,7 @@ auto GCS::Match(const gcs::Hashes& prehashed) const noexcept -> PrehashedMatches
     }
 
     dedup(hashed);
-    const auto& set = decompress();
-    std::set_intersection(
-        std::begin(hashed),
-        std::end(hashed),
-        std::begin(set),
-        std::end(set),
-        std::back_inserter(matches));
+    match(hashed, matches);
 
     for (const auto& match : matches) {
         auto& values = map.at(match);
@@ -724,6 +1046,31 @@ auto GCS::Match(const gcs::Hashes& prehashed) const noexcept -> PrehashedMatches
     return output;
 }
 
+auto GCS::match(const gcs::Elements& targets, gcs::Elements& out)
+    const noexcept -> void
+{
+    if (elements_.has_value()) {
+        const auto& set = elements_.value();
+        std::set_intersection(
+            std::begin(targets),
+            std::end(targets),
+            std::begin(set),
+            std::end(set),
+            std::back_inserter(out));
+    } else {
+        try {
+            out = gcs::GolombMatch(
+                count_,
+                bits_,
+                encoded_,
+                targets,
+                out.get_allocator());
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+        }
+    }
+}
+
 auto GCS::Range() const noexcept -> gcs::Range
 {
     return range(count_, false_positive_rate_);
@@ -736,8 +1083,7 @@ auto GCS::Serialize(proto::GCS& output) const noexcept -> bool
     output.set_fprate(false_positive_rate_);
     output.set_key(reinterpret_cast<const char*>(key_.data()), key_.size());
     output.set_count(count_);
-    output.set_filter(
-        reinterpret_cast<const char*>(compressed_.data()), compressed_.size());
+    output.set_filter(encoded_.data(), encoded_.size());
 
     return true;
 }
@@ -751,6 +1097,38 @@ auto GCS::Serialize(AllocateOutput out) const noexcept -> bool
     return proto::write(proto, out);
 }
 
+auto GCS::SerializeCfilter(WritableView out) const noexcept -> bool
+{
+    if (false == out.valid(SerializedCfilterSize())) {
+        LogError()(OT_PRETTY_CLASS())("invalid output").Flush();
+
+        return false;
+    }
+
+    try {
+        const auto header = internal::SerializedCfilter{
+            bits_, false_positive_rate_, count_, reader(key_)};
+        auto* i = out.as<std::byte>();
+        std::memcpy(i, &header, sizeof(header));
+        std::advance(i, sizeof(header));
+
+        if (0u < encoded_.size()) {
+            std::memcpy(i, encoded_.data(), encoded_.size());
+        }
+
+        return true;
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+        return false;
+    }
+}
+
+auto GCS::SerializedCfilterSize() const noexcept -> std::size_t
+{
+    return sizeof(internal::SerializedCfilter) + encoded_.size();
+}
+
 auto GCS::Test(const Data& target) const noexcept -> bool
 {
     return Test(target.Bytes());
@@ -760,7 +1138,7 @@ auto GCS::Test(const ReadView target) const noexcept -> bool
 {
     auto buf = std::array<
         std::byte,
-        sizeof(target) + sizeof(ReadView) + sizeof(gcs::Element)>{};
+        sizeof(target) + sizeof(ReadView) + (2 * sizeof(gcs::Element))>{};
     auto alloc = alloc::BoostMonotonic{buf.data(), buf.size()};
     const auto input = [&] {
         auto out = Targets{&alloc};
@@ -772,19 +1150,10 @@ auto GCS::Test(const ReadView target) const noexcept -> bool
 
     OT_ASSERT(1 == set.size());
 
-    const auto& hash = set.front();
-
-    for (const auto& element : decompress()) {
-        if (element == hash) {
-
-            return true;
-        } else if (element > hash) {
-
-            return false;
-        }
-    }
+    auto matches = gcs::Elements{&alloc};
+    match(set, matches);
 
-    return false;
+    return false == matches.empty();
 }
 
 auto GCS::Test(const Vector<ByteArray>& targets) const noexcept -> bool
@@ -816,15 +1185,9 @@ auto GCS::Test(const gcs::Hashes& targets) const noexcept -> bool
 
 auto GCS::test(const gcs::Elements& targets) const noexcept -> bool
 {
-    const auto& set = decompress();
     auto alloc = alloc::BoostMonotonic{1024};
-    auto matches = Vector<gcs::Element>{&alloc};
-    std::set_intersection(
-        std::begin(targets),
-        std::end(targets),
-        std::begin(set),
-        std::end(set),
-        std::back_inserter(matches));
+    auto matches = gcs::Elements{&alloc};
+    match(targets, matches);
 
     return 0 < matches.size();
 }
@@ -99,6 +99,14 @@ public:
     {
         return {};
     }
+    auto SerializeCfilter(WritableView out) const noexcept -> bool override
+    {
+        return {};
+    }
+    auto SerializedCfilterSize() const noexcept -> std::size_t override
+    {
+        return {};
+    }
     virtual auto Test(const Data& target) const noexcept -> bool { return {}; }
     virtual auto Test(const ReadView target) const noexcept -> bool
     {
@@ -149,6 +157,8 @@ public:
     auto Range() const noexcept -> gcs::Range final;
     auto Serialize(proto::GCS& out) const noexcept -> bool final;
     auto Serialize(AllocateOutput out) const noexcept -> bool final;
+    auto SerializeCfilter(WritableView out) const noexcept -> bool final;
+    auto SerializedCfilterSize() const noexcept -> std::size_t final;
     auto Test(const Data& target) const noexcept -> bool final;
     auto Test(const ReadView target) const noexcept -> bool final;
     auto Test(const Vector<ByteArray>& targets) const noexcept -> bool final;
@@ -172,6 +182,18 @@ public:
         Vector<std::byte>&& compressed,
         allocator_type alloc)
     noexcept(false);
+    // NOTE the encoded set is not copied. The caller must ensure the memory
+    // referenced by encoded outlives this object and all copies of it
+    // which are not made via the copy constructor.
+    GCS(const api::Session& api,
+        const std::uint8_t bits,
+        const std::uint32_t fpRate,
+        const std::uint32_t count,
+        const ReadView key,
+        const ReadView encoded,
+        const bool view,
+        allocator_type alloc)
+    noexcept(false);
     GCS(const GCS& rhs, allocator_type alloc = {}) noexcept;
     GCS() = delete;
     GCS(GCS&&) = delete;
@@ -190,6 +212,7 @@ private:
     const std::uint32_t count_;
     const Key key_;
     const Vector<std::byte> compressed_;
+    const ReadView encoded_;
     mutable std::optional<gcs::Elements> elements_;
 
     static auto transform(
@@ -210,6 +233,8 @@ private:
         const noexcept -> gcs::Elements;
     auto hashed_set_construct(const Targets& elements, allocator_type alloc)
         const noexcept -> gcs::Elements;
+    auto match(const gcs::Elements& targets, gcs::Elements& out)
+        const noexcept -> void;
     auto test(const gcs::Elements& targetHashes) const noexcept -> bool;
     auto hash_to_range(const ReadView in) const noexcept -> gcs::Range;
 
@@ -228,6 +253,7 @@ private:
         const std::uint32_t count,
         std::optional<gcs::Elements>&& elements,
         Vector<std::byte>&& compressed,
+        const ReadView view,
         ReadView key,
         allocator_type alloc)
     noexcept(false);
@@ -0,0 +1,283 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "internal/blockchain/bitcoin/cfilter/GCS.hpp"  // IWYU pragma: associated
+
+#include <boost/endian/conversion.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include "internal/util/P0330.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace be = boost::endian;
+
+// SipHash-2-4 as specified in https://131002.net/siphash/siphash.pdf
+namespace opentxs::gcs::siphash
+{
+constexpr auto lanes_ = 4_uz;
+
+using Lane = std::array<std::uint64_t, lanes_>;
+
+constexpr auto rotl(const std::uint64_t x, const unsigned int b) noexcept
+    -> std::uint64_t
+{
+    return (x << b) | (x >> (64u - b));
+}
+
+inline auto load(const char* in) noexcept -> std::uint64_t
+{
+    auto out = std::uint64_t{};
+    std::memcpy(&out, in, sizeof(out));
+
+    return be::little_to_native(out);
+}
+
+inline auto tail(const ReadView in) noexcept -> std::uint64_t
+{
+    const auto left = in.size() & 7u;
+    const auto* ptr = in.data() + (in.size() - left);
+    auto out = static_cast<std::uint64_t>(in.size()) << 56u;
+
+    for (auto i = 0_uz; i < left; ++i) {
+        out |= std::uint64_t{static_cast<std::uint8_t>(ptr[i])} << (8u * i);
+    }
+
+    return out;
+}
+
+struct State {
+    std::uint64_t v0_;
+    std::uint64_t v1_;
+    std::uint64_t v2_;
+    std::uint64_t v3_;
+
+    auto compress(const std::uint64_t m) noexcept -> void
+    {
+        v3_ ^= m;
+        round();
+        round();
+        v0_ ^= m;
+    }
+    auto finalize() noexcept -> std::uint64_t
+    {
+        v2_ ^= 0xff;
+        round();
+        round();
+        round();
+        round();
+
+        return v0_ ^ v1_ ^ v2_ ^ v3_;
+    }
+    auto round() noexcept -> void
+    {
+        v0_ += v1_;
+        v1_ = rotl(v1_, 13u);
+        v1_ ^= v0_;
+        v0_ = rotl(v0_, 32u);
+        v2_ += v3_;
+        v3_ = rotl(v3_, 16u);
+        v3_ ^= v2_;
+        v0_ += v3_;
+        v3_ = rotl(v3_, 21u);
+        v3_ ^= v0_;
+        v2_ += v1_;
+        v1_ = rotl(v1_, 17u);
+        v1_ ^= v2_;
+        v2_ = rotl(v2_, 32u);
+    }
+
+    State(const std::uint64_t k0, const std::uint64_t k1) noexcept
+        : v0_(k0 ^ 0x736f6d6570736575ull)
+        , v1_(k1 ^ 0x646f72616e646f6dull)
+        , v2_(k0 ^ 0x6c7967656e657261ull)
+        , v3_(k1 ^ 0x7465646279746573ull)
+    {
+    }
+};
+
+// Hashes lanes_ messages in lockstep. Each SipRound is applied to all lanes
+// before the next one starts so the independent dependency chains overlap in
+// the pipeline, and compilers are free to vectorize the lane loops.
+struct Lanes {
+    Lane v0_;
+    Lane v1_;
+    Lane v2_;
+    Lane v3_;
+
+    auto compress(const Lane& m) noexcept -> void
+    {
+        for (auto l = 0_uz; l < lanes_; ++l) { v3_[l] ^= m[l]; }
+
+        round();
+        round();
+
+        for (auto l = 0_uz; l < lanes_; ++l) { v0_[l] ^= m[l]; }
+    }
+    auto finalize(std::uint64_t* out) noexcept -> void
+    {
+        for (auto l = 0_uz; l < lanes_; ++l) { v2_[l] ^= 0xff; }
+
+        round();
+        round();
+        round();
+        round();
+
+        for (auto l = 0_uz; l < lanes_; ++l) {
+            out[l] = v0_[l] ^ v1_[l] ^ v2_[l] ^ v3_[l];
+        }
+    }
+    auto round() noexcept -> void
+    {
+        for (auto l = 0_uz; l < lanes_; ++l) {
+            v0_[l] += v1_[l];
+            v1_[l] = rotl(v1_[l], 13u);
+            v1_[l] ^= v0_[l];
+            v0_[l] = rotl(v0_[l], 32u);
+            v2_[l] += v3_[l];
+            v3_[l] = rotl(v3_[l], 16u);
+            v3_[l] ^= v2_[l];
+            v0_[l] += v3_[l];
+            v3_[l] = rotl(v3_[l], 21u);
+            v3_[l] ^= v0_[l];
+            v2_[l] += v1_[l];
+            v1_[l] = rotl(v1_[l], 17u);
+            v1_[l] ^= v2_[l];
+            v2_[l] = rotl(v2_[l], 32u);
+        }
+    }
+
+    Lanes(const std::uint64_t k0, const std::uint64_t k1) noexcept
+        : v0_()
+        , v1_()
+        , v2_()
+        , v3_()
+    {
+        const auto init = State{k0, k1};
+        v0_.fill(init.v0_);
+        v1_.fill(init.v1_);
+        v2_.fill(init.v2_);
+        v3_.fill(init.v3_);
+    }
+};
+
+auto siphash(
+    const std::uint64_t k0,
+    const std::uint64_t k1,
+    const ReadView in) noexcept -> std::uint64_t
+{
+    auto state = State{k0, k1};
+    const auto blocks = in.size() / 8u;
+
+    for (auto b = 0_uz; b < blocks; ++b) {
+        state.compress(load(in.data() + (8u * b)));
+    }
+
+    state.compress(tail(in));
+
+    return state.finalize();
+}
+
+auto siphash(
+    const std::uint64_t k0,
+    const std::uint64_t k1,
+    const ReadView* in,
+    std::uint64_t* out) noexcept -> void
+{
+    auto state = Lanes{k0, k1};
+    const auto blocks = [&] {
+        auto output = std::numeric_limits<std::size_t>::max();
+
+        for (auto l = 0_uz; l < lanes_; ++l) {
+            output = std::min(output, in[l].size() / 8u);
+        }
+
+        return output;
+    }();
+    auto m = Lane{};
+
+    for (auto b = 0_uz; b < blocks; ++b) {
+        for (auto l = 0_uz; l < lanes_; ++l) {
+            m[l] = load(in[l].data() + (8u * b));
+        }
+
+        state.compress(m);
+    }
+
+    // NOTE messages which are longer than the shortest message in the group
+    // are finished one lane at a time
+    for (auto l = 0_uz; l < lanes_; ++l) {
+        auto lane = State{k0, k1};
+        lane.v0_ = state.v0_[l];
+        lane.v1_ = state.v1_[l];
+        lane.v2_ = state.v2_[l];
+        lane.v3_ = state.v3_[l];
+        const auto& item = in[l];
+        const auto total = item.size() / 8u;
+
+        for (auto b = blocks; b < total; ++b) {
+            lane.compress(load(item.data() + (8u * b)));
+        }
+
+        state.v0_[l] = lane.v0_;
+        state.v1_[l] = lane.v1_;
+        state.v2_[l] = lane.v2_;
+        state.v3_[l] = lane.v3_;
+        m[l] = tail(item);
+    }
+
+    state.compress(m);
+    state.finalize(out);
+}
+}  // namespace opentxs::gcs::siphash
+
+namespace opentxs::gcs
+{
+auto Siphash(
+    const ReadView key,
+    const blockchain::GCS::Targets& items,
+    Hash* out) noexcept(false) -> void
+{
+    if (16u != key.size()) { throw std::runtime_error("Invalid key"); }
+
+    if ((nullptr == out) && (false == items.empty())) {
+        throw std::runtime_error("Invalid output");
+    }
+
+    using siphash::lanes_;
+    const auto k0 = siphash::load(key.data());
+    const auto k1 = siphash::load(key.data() + 8u);
+    const auto count = items.size();
+    const auto full = count - (count % lanes_);
+    auto i = 0_uz;
+
+    for (; i < full; i += lanes_) {
+        siphash::siphash(k0, k1, items.data() + i, out + i);
+    }
+
+    for (; i < count; ++i) { out[i] = siphash::siphash(k0, k1, items[i]); }
+}
+
+auto Siphash(
+    const ReadView key,
+    const blockchain::GCS::Targets& items,
+    alloc::Default alloc) noexcept(false) -> Hashes
+{
+    auto output = Hashes{alloc};
+    output.resize(items.size());
+    Siphash(key, items, output.data());
+
+    return output;
+}
+}  // namespace opentxs::gcs
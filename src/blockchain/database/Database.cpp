@@ -109,7 +109,7 @@ Database::Database(
                 {database::KeyOutputs, MDB_DUPSORT},
                 {database::GenerationOutputs, MDB_DUPSORT | MDB_DUPFIXED},
             },
-            0};
+            common.EnvironmentFlags()};
         init_db(lmdb);
 
         return lmdb;
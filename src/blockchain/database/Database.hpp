@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iosfwd>
 #include <memory>
 #include <mutex>
@@ -184,10 +185,11 @@ public:
     {
         return wallet_.AdvanceTo(pos);
     }
-    auto ApplyUpdate(const node::UpdateTransaction& update) noexcept
-        -> bool final
+    auto ApplyUpdate(
+        const node::UpdateTransaction& update,
+        const std::function<void()>& committed) noexcept -> bool final
     {
-        return headers_.ApplyUpdate(update);
+        return headers_.ApplyUpdate(update, committed);
     }
     // Throws std::out_of_range if no block at that position
     auto BestBlock(const block::Height position) const noexcept(false)
@@ -11,6 +11,7 @@
 #include <BlockchainBlockLocalData.pb.h>
 #include <algorithm>
 #include <cstring>
+#include <functional>
 #include <iterator>
 #include <memory>
 #include <stdexcept>
@@ -78,8 +79,9 @@ Headers::Headers(
     }
 }
 
-auto Headers::ApplyUpdate(const node::UpdateTransaction& update) noexcept
-    -> bool
+auto Headers::ApplyUpdate(
+    const node::UpdateTransaction& update,
+    const std::function<void()>& committed) noexcept -> bool
 {
     if (false == common_.StoreBlockHeaders(update.UpdatedHeaders())) {
         LogError()(OT_PRETTY_CLASS())("Failed to save block headers").Flush();
@@ -223,6 +225,8 @@ auto Headers::ApplyUpdate(const node::UpdateTransaction& update) noexcept
         return false;
     }
 
+    if (committed) { committed(); }
+
     const auto position = best(lock);
     const auto& [height, hash] = position;
     const auto bytes = hash.Bytes();
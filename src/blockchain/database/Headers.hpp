@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iosfwd>
 #include <memory>
 #include <mutex>
@@ -115,7 +116,9 @@ public:
     auto TryLoadHeader(const block::Hash& hash) const noexcept
         -> std::unique_ptr<block::Header>;
 
-    auto ApplyUpdate(const node::UpdateTransaction& update) noexcept -> bool;
+    auto ApplyUpdate(
+        const node::UpdateTransaction& update,
+        const std::function<void()>& committed) noexcept -> bool;
 
     Headers(
         const api::Session& api,
@@ -13,6 +13,7 @@
 #include <array>
 #include <cstddef>
 #include <cstring>
+#include <initializer_list>
 #include <mutex>
 #include <stdexcept>
 #include <tuple>
@@ -22,11 +23,14 @@
 #include "Proto.hpp"
 #include "Proto.tpp"
 #include "blockchain/database/common/Bulk.hpp"
+#include "blockchain/database/common/Database.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/bitcoin/cfilter/GCS.hpp"
 #include "internal/util/BoostPMR.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
 #include "internal/util/TSV.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/FilterType.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
 #include "opentxs/blockchain/block/Hash.hpp"
 #include "opentxs/util/Allocator.hpp"
@@ -46,6 +50,7 @@ BlockFilter::BlockFilter(
     , lmdb_(lmdb)
     , bulk_(bulk)
 {
+    upgrade();
 }
 
 auto BlockFilter::HaveFilter(const cfilter::Type type, const ReadView blockHash)
@@ -73,6 +78,21 @@ auto BlockFilter::HaveFilterHeader(
     }
 }
 
+auto BlockFilter::load(
+    const ReadView bytes,
+    const bool view,
+    alloc::Default alloc) const noexcept(false) -> GCS
+{
+    if (internal::IsSerializedCfilter(bytes)) {
+
+        return factory::GCSFromStorage(api_, bytes, view, alloc);
+    } else {
+        // NOTE this cfilter has not been upgraded yet
+
+        return factory::GCS(api_, proto::Factory<proto::GCS>(bytes), alloc);
+    }
+}
+
 auto BlockFilter::load_filter_index(
     const cfilter::Type type,
     const ReadView blockHash,
@@ -111,8 +131,7 @@ auto BlockFilter::LoadFilter(
             return out;
         }();
 
-        return factory::GCS(
-            api_, proto::Factory<proto::GCS>(bulk_.ReadView(index)), alloc);
+        return load(bulk_.ReadView(index), false, alloc);
     } catch (const std::exception& e) {
         LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
 
@@ -153,10 +172,10 @@ auto BlockFilter::LoadFilters(
 
     for (const auto& index : indices) {
         try {
-            output.emplace_back(factory::GCS(
-                api_,
-                proto::Factory<proto::GCS>(bulk_.ReadView(index)),
-                blocks.get_allocator()));
+            // NOTE the returned filters reference the memory mapped bulk
+            // storage directly instead of copying the encoded set
+            output.emplace_back(
+                load(bulk_.ReadView(index), true, blocks.get_allocator()));
         } catch (const std::exception& e) {
             LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
 
@@ -237,16 +256,7 @@ auto BlockFilter::store(
     const GCS& filter) const noexcept -> bool
 {
     try {
-        const auto proto = [&] {
-            auto out = proto::GCS{};
-
-            if (false == filter.Internal().Serialize(out)) {
-                throw std::runtime_error{"Failed to serialize gcs"};
-            }
-
-            return out;
-        }();
-        const auto bytes = proto.ByteSizeLong();
+        const auto bytes = filter.Internal().SerializedCfilterSize();
         const auto table = translate_filter(type);
         auto index = [&] {
             auto output = util::IndexData{};
@@ -255,7 +265,7 @@ auto BlockFilter::store(
 
                 std::memcpy(static_cast<void*>(&output), in.data(), in.size());
             };
-            lmdb_.Load(table, blockHash, cb);
+            lmdb_.Load(table, blockHash, cb, tx);
 
             return output;
         }();
@@ -279,7 +289,7 @@ auto BlockFilter::store(
                 "Failed to get write position for cfilter"};
         }
 
-        return proto::write(proto, preallocated(bytes, view.data()));
+        return filter.Internal().SerializeCfilter(std::move(view));
     } catch (const std::exception& e) {
         LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
 
@@ -291,48 +301,53 @@ auto BlockFilter::StoreFilterHeaders(
     const cfilter::Type type,
     const Vector<CFHeaderParams>& headers) const noexcept -> bool
 {
-    auto tx = lmdb_.TransactionRW();
-
-    for (const auto& [block, header, hash] : headers) {
-        auto proto = proto::BlockchainFilterHeader();
-        proto.set_version(1);
-        proto.set_header(header.data(), header.size());
-        proto.set_hash(hash.data(), hash.size());
-        auto bytes = space(proto.ByteSize());
-        proto.SerializeWithCachedSizesToArray(
-            reinterpret_cast<std::uint8_t*>(bytes.data()));
+    auto stored = lmdb_.Batch([&](auto& tx) {
+        for (const auto& [block, header, hash] : headers) {
+            auto proto = proto::BlockchainFilterHeader();
+            proto.set_version(1);
+            proto.set_header(header.data(), header.size());
+            proto.set_hash(hash.data(), hash.size());
+            auto bytes = space(proto.ByteSize());
+            proto.SerializeWithCachedSizesToArray(
+                reinterpret_cast<std::uint8_t*>(bytes.data()));
 
-        try {
-            const auto stored = lmdb_.Store(
-                translate_header(type), block.Bytes(), reader(bytes), tx);
+            try {
+                const auto result = lmdb_.Store(
+                    translate_header(type), block.Bytes(), reader(bytes), tx);
 
-            if (false == stored.first) { return false; }
-        } catch (const std::exception& e) {
-            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+                if (false == result.first) { return false; }
+            } catch (const std::exception& e) {
+                LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
 
-            return false;
+                return false;
+            }
         }
-    }
 
-    return tx.Finalize(true);
+        return true;
+    });
+
+    return stored.get();
 }
 
 auto BlockFilter::StoreFilters(
     const cfilter::Type type,
     const Vector<CFilterParams>& filters) const noexcept -> bool
 {
-    auto tx = lmdb_.TransactionRW();
-    auto lock = Lock{bulk_.Mutex()};
+    auto stored = lmdb_.Batch([&](auto& tx) {
+        auto lock = Lock{bulk_.Mutex()};
 
-    for (const auto& [block, cfilter] : filters) {
-        OT_ASSERT(cfilter.IsValid());
+        for (const auto& [block, cfilter] : filters) {
+            OT_ASSERT(cfilter.IsValid());
 
-        if (false == store(lock, tx, block.Bytes(), type, cfilter)) {
-            return false;
+            if (false == store(lock, tx, block.Bytes(), type, cfilter)) {
+                return false;
+            }
         }
-    }
 
-    return tx.Finalize(true);
+        return true;
+    });
+
+    return stored.get();
 }
 
 auto BlockFilter::StoreFilters(
@@ -348,7 +363,7 @@ auto BlockFilter::StoreFilters(
 
         using BlockHash = ReadView;
         using SerializedCfheader = Vector<std::byte>;
-        using SerializedCfilter = proto::GCS*;
+        using SerializedCfilter = const GCS*;
         using CFilterSize = std::size_t;
         using BulkIndex = util::IndexData;
         using StorageItem = std::tuple<
@@ -380,7 +395,7 @@ auto BlockFilter::StoreFilters(
                     out.emplace_back(
                         BlockHash{},
                         SerializedCfheader{&alloc},
-                        google::protobuf::Arena::Create<proto::GCS>(&arena),
+                        nullptr,
                         0,
                         BulkIndex{});
                 bHash = std::get<0>(*h).Bytes();
@@ -396,68 +411,72 @@ auto BlockFilter::StoreFilters(
                 }();
                 proto::write(*cfheaderProto, writer(cfHeader));
 
-                if (const auto& [b, filter] = *f;
-                    (false == filter.IsValid()) ||
-                    (false == filter.Internal().Serialize(*cfilter))) {
-                    throw std::runtime_error{"Failed to serialize gcs"};
+                if (const auto& [b, filter] = *f; filter.IsValid()) {
+                    cfilter = &filter;
+                } else {
+                    throw std::runtime_error{"Invalid gcs"};
                 }
 
-                bytes = cfilter->ByteSizeLong();
+                bytes = cfilter->Internal().SerializedCfilterSize();
             }
 
             return out;
         }();
         const auto hTable = translate_header(type);
         const auto fTable = translate_filter(type);
-        auto tx = lmdb_.TransactionRW();
-        auto lock = Lock{bulk_.Mutex()};
+        auto stored = lmdb_.Batch([&](auto& tx) {
+            auto lock = Lock{bulk_.Mutex()};
 
-        for (auto& i : data) {
-            const auto readIndex = [&](const auto in) {
-                auto& [block, header, filter, bytes, index] = i;
+            for (auto& i : data) {
+                const auto readIndex = [&](const auto in) {
+                    auto& [block, header, filter, bytes, index] = i;
 
-                if (sizeof(index) != in.size()) { return; }
+                    if (sizeof(index) != in.size()) { return; }
 
-                std::memcpy(static_cast<void*>(&index), in.data(), in.size());
-            };
-            auto writeIndex = [&](auto& tx) -> bool {
-                const auto& [block, header, filter, bytes, index] = i;
-                const auto result = lmdb_.Store(fTable, block, tsv(index), tx);
+                    std::memcpy(
+                        static_cast<void*>(&index), in.data(), in.size());
+                };
+                auto writeIndex = [&](auto& tx) -> bool {
+                    const auto& [block, header, filter, bytes, index] = i;
+                    const auto result =
+                        lmdb_.Store(fTable, block, tsv(index), tx);
 
-                if (false == result.first) {
-                    LogError()(OT_PRETTY_CLASS())(
-                        "Failed to update index for cfilter header")
-                        .Flush();
+                    if (false == result.first) {
+                        LogError()(OT_PRETTY_CLASS())(
+                            "Failed to update index for cfilter header")
+                            .Flush();
 
-                    return false;
-                }
+                        return false;
+                    }
 
-                return true;
-            };
-            auto& [block, header, filter, bytes, index] = i;
-            lmdb_.Load(fTable, block, readIndex);
-            auto view =
-                bulk_.WriteView(lock, tx, index, std::move(writeIndex), bytes);
-
-            if (false == view.valid(bytes)) {
-                throw std::runtime_error{
-                    "Failed to get write position for cfilter"};
-            }
+                    return true;
+                };
+                auto& [block, header, filter, bytes, index] = i;
+                lmdb_.Load(fTable, block, readIndex, tx);
+                auto view = bulk_.WriteView(
+                    lock, tx, index, std::move(writeIndex), bytes);
 
-            if (!proto::write(*filter, preallocated(bytes, view.data()))) {
-                throw std::runtime_error{"Failed to get write cfilter"};
-            }
+                if (false == view.valid(bytes)) {
+                    throw std::runtime_error{
+                        "Failed to get write position for cfilter"};
+                }
+
+                if (!filter->Internal().SerializeCfilter(std::move(view))) {
+                    throw std::runtime_error{"Failed to get write cfilter"};
+                }
 
-            const auto stored = lmdb_.Store(hTable, block, reader(header), tx);
+                const auto result =
+                    lmdb_.Store(hTable, block, reader(header), tx);
 
-            if (false == stored.first) {
-                throw std::runtime_error{"Failed to get write cfheader"};
+                if (false == result.first) {
+                    throw std::runtime_error{"Failed to get write cfheader"};
+                }
             }
-        }
 
-        lock.unlock();
+            return true;
+        });
 
-        return tx.Finalize(true);
+        return stored.get();
     } catch (const std::exception& e) {
         LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
 
@@ -465,6 +484,105 @@ auto BlockFilter::StoreFilters(
     }
 }
 
+auto BlockFilter::upgrade() noexcept -> void
+{
+    const auto key = Database::Key::CfilterStorageVersion;
+    const auto version = [&] {
+        auto out = std::size_t{0};
+        lmdb_.Load(Table::Config, tsv(key), [&out](const auto in) {
+            if (sizeof(out) != in.size()) { return; }
+
+            std::memcpy(&out, in.data(), in.size());
+        });
+
+        return out;
+    }();
+
+    if (cfilter_storage_version_ <= version) { return; }
+
+    LogConsole()("Upgrading cfilter storage format").Flush();
+    using Record = std::pair<Space, util::IndexData>;
+    static constexpr auto batch = 1000_uz;
+
+    for (const auto type :
+         {cfilter::Type::Basic_BIP158,
+          cfilter::Type::Basic_BCHVariant,
+          cfilter::Type::ES}) {
+        const auto table = translate_filter(type);
+        const auto records = [&] {
+            auto out = UnallocatedVector<Record>{};
+            lmdb_.Read(
+                table,
+                [&](const auto key, const auto value) {
+                    auto& [hash, index] =
+                        out.emplace_back(space(key), util::IndexData{});
+
+                    if (sizeof(index) == value.size()) {
+                        std::memcpy(
+                            static_cast<void*>(&index),
+                            value.data(),
+                            value.size());
+                    } else {
+                        out.pop_back();
+                    }
+
+                    return true;
+                },
+                storage::lmdb::LMDB::Dir::Forward);
+
+            return out;
+        }();
+        auto i = records.cbegin();
+
+        while (records.cend() != i) {
+            auto tx = lmdb_.TransactionRW();
+            auto lock = Lock{bulk_.Mutex()};
+
+            for (auto n = 0_uz; (n < batch) && (records.cend() != i);
+                 ++n, ++i) {
+                const auto& [hash, index] = *i;
+
+                try {
+                    const auto bytes = bulk_.ReadView(lock, index);
+
+                    if (internal::IsSerializedCfilter(bytes)) { continue; }
+
+                    const auto filter = factory::GCS(
+                        api_, proto::Factory<proto::GCS>(bytes), {});
+
+                    if (false == filter.IsValid()) {
+                        throw std::runtime_error{"invalid cfilter"};
+                    }
+
+                    if (false == store(lock, tx, reader(hash), type, filter)) {
+                        throw std::runtime_error{"failed to store cfilter"};
+                    }
+                } catch (const std::exception& e) {
+                    LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+                }
+            }
+
+            lock.unlock();
+
+            if (false == tx.Finalize(true)) {
+                LogError()(OT_PRETTY_CLASS())("failed to upgrade cfilters")
+                    .Flush();
+
+                return;
+            }
+        }
+    }
+
+    const auto stored = lmdb_.Store(
+        Table::Config, tsv(key), tsv(cfilter_storage_version_));
+
+    if (false == stored.first) {
+        LogError()(OT_PRETTY_CLASS())(
+            "failed to update cfilter storage version")
+            .Flush();
+    }
+}
+
 auto BlockFilter::translate_filter(const cfilter::Type type) noexcept(false)
     -> Table
 {
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 
@@ -109,6 +110,9 @@ private:
     static const std::uint32_t blockchain_filter_headers_version_{1};
     static const std::uint32_t blockchain_filter_version_{1};
     static const std::uint32_t blockchain_filters_version_{1};
+    // NOTE version 1 stores cfilters as internal::SerializedCfilter records,
+    // version 0 stored them as protobuf
+    static constexpr auto cfilter_storage_version_ = std::size_t{1};
 
     const api::Session& api_;
     storage::lmdb::LMDB& lmdb_;
@@ -119,6 +123,8 @@ private:
     static auto translate_header(const cfilter::Type type) noexcept(false)
         -> Table;
 
+    auto load(const ReadView bytes, const bool view, alloc::Default alloc)
+        const noexcept(false) -> GCS;
     auto load_filter_index(
         const cfilter::Type type,
         const ReadView blockHash,
@@ -134,5 +140,6 @@ private:
         const ReadView blockHash,
         const cfilter::Type type,
         const GCS& filter) const noexcept -> bool;
+    auto upgrade() noexcept -> void;
 };
 }  // namespace opentxs::blockchain::database::common
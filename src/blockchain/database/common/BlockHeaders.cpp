@@ -67,12 +67,13 @@ auto BlockHeader::Load(const opentxs::blockchain::block::Hash& hash) const
 auto BlockHeader::Store(
     const opentxs::blockchain::block::Header& header) const noexcept -> bool
 {
-    auto tx = lmdb_.TransactionRW();
-    auto lock = Lock{bulk_.Mutex()};
+    auto stored = lmdb_.Batch([&](auto& tx) {
+        auto lock = Lock{bulk_.Mutex()};
 
-    if (false == store(lock, false, tx, header)) { return false; }
+        return store(lock, false, tx, header);
+    });
 
-    if (tx.Finalize(true)) { return true; }
+    if (stored.get()) { return true; }
 
     LogError()(OT_PRETTY_CLASS())("Database update error").Flush();
 
@@ -81,19 +82,22 @@ auto BlockHeader::Store(
 
 auto BlockHeader::Store(const UpdatedHeader& headers) const noexcept -> bool
 {
-    auto tx = lmdb_.TransactionRW();
-    auto lock = Lock{bulk_.Mutex()};
+    auto stored = lmdb_.Batch([&](auto& tx) {
+        auto lock = Lock{bulk_.Mutex()};
 
-    for (const auto& [hash, pair] : headers) {
-        const auto& [header, newBlock] = pair;
+        for (const auto& [hash, pair] : headers) {
+            const auto& [header, newBlock] = pair;
 
-        if (newBlock) {
+            if (newBlock) {
 
-            if (false == store(lock, true, tx, *header)) { return false; }
+                if (false == store(lock, true, tx, *header)) { return false; }
+            }
         }
-    }
 
-    if (tx.Finalize(true)) { return true; }
+        return true;
+    });
+
+    if (stored.get()) { return true; }
 
     LogError()(OT_PRETTY_CLASS())("Database update error").Flush();
 
@@ -128,7 +132,7 @@ auto BlockHeader::store(
 
                 std::memcpy(static_cast<void*>(&output), in.data(), in.size());
             };
-            lmdb_.Load(table_, hash.Bytes(), cb);
+            lmdb_.Load(table_, hash.Bytes(), cb, pTx);
 
             return output;
         }();
@@ -8,6 +8,7 @@
 #include "blockchain/database/common/Blocks.hpp"  // IWYU pragma: associated
 
 #include <cstring>
+#include <exception>
 #include <mutex>
 #include <shared_mutex>
 #include <type_traits>
@@ -33,6 +34,31 @@ struct Blocks::Imp {
     mutable std::mutex lock_;
     mutable UnallocatedMap<Hash, std::shared_mutex> block_locks_;
 
+    auto Compact(std::size_t& budget) const noexcept -> std::size_t
+    {
+        // NOTE a block which is being read or written is skipped rather than
+        // waited on since a BlockWriter accesses its view after the locks
+        // protecting the index have been released. lock_ is only held for
+        // one relocation at a time so that loads and stores are not blocked
+        // for the duration of the pass.
+        const auto guard = [this](const auto key, const auto& relocate) {
+            try {
+                auto lock = Lock{lock_};
+                auto& mutex = block_locks_[Hash{key}];
+                auto blockLock = eLock{mutex, std::try_to_lock};
+
+                if (false == blockLock.owns_lock()) { return false; }
+
+                return relocate();
+            } catch (const std::exception& e) {
+                LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+                return false;
+            }
+        };
+
+        return bulk_.Compact(table_, guard, budget);
+    }
     auto Exists(const Hash& block) const noexcept -> bool
     {
         return lmdb_.Exists(table_, block.Bytes());
@@ -133,6 +159,11 @@ Blocks::Blocks(storage::lmdb::LMDB& lmdb, Bulk& bulk) noexcept
 {
 }
 
+auto Blocks::Compact(std::size_t& budget) const noexcept -> std::size_t
+{
+    return imp_->Compact(budget);
+}
+
 auto Blocks::Exists(const Hash& block) const noexcept -> bool
 {
     return imp_->Exists(block);
@@ -53,6 +53,7 @@ class Blocks
 public:
     using Hash = opentxs::blockchain::block::Hash;
 
+    auto Compact(std::size_t& budget) const noexcept -> std::size_t;
     auto Exists(const Hash& block) const noexcept -> bool;
     auto Load(const Hash& block) const noexcept -> BlockReader;
     auto Store(const Hash& block, const std::size_t bytes) const noexcept
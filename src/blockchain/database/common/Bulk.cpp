@@ -7,16 +7,103 @@
 #include "1_Internal.hpp"                       // IWYU pragma: associated
 #include "blockchain/database/common/Bulk.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
+#include <cstring>
 #include <mutex>
 #include <utility>
 
 #include "blockchain/database/common/Database.hpp"
 #include "internal/blockchain/database/common/Common.hpp"
+#include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
+#include "internal/util/TSV.hpp"
+#include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
+#include "opentxs/util/Log.hpp"
 #include "util/MappedFileStorage.hpp"
 
 namespace opentxs::blockchain::database::common
 {
 struct Bulk::Imp final : private util::MappedFileStorage {
+    auto Compact(const int table, const Guard& guard, std::size_t& budget)
+        const noexcept -> std::size_t
+    {
+        using Candidate = std::pair<util::IndexData, Space>;
+        auto candidates = UnallocatedVector<Candidate>{};
+        lmdb_.Read(
+            table,
+            [&](const auto key, const auto value) {
+                auto index = util::IndexData{};
+
+                if (sizeof(index) != value.size()) { return true; }
+
+                std::memcpy(
+                    static_cast<void*>(&index), value.data(), value.size());
+                auto lock = Lock{lock_};
+
+                if (should_relocate(index)) {
+                    candidates.emplace_back(index, space(key));
+                }
+
+                return true;
+            },
+            storage::lmdb::LMDB::Dir::Forward);
+        // NOTE moving the highest items first is what allows the end of the
+        // storage to be truncated the next time it is opened
+        std::sort(
+            candidates.begin(),
+            candidates.end(),
+            [](const auto& lhs, const auto& rhs) {
+                return lhs.first.position_ > rhs.first.position_;
+            });
+        auto output = 0_uz;
+
+        for (const auto& candidate : candidates) {
+            if (0_uz == budget) { break; }
+
+            const auto& expected = candidate.first;
+            const auto key = reader(candidate.second);
+
+            const auto job = [&, this]() -> bool {
+                auto tx = lmdb_.TransactionRW();
+                auto lock = Lock{lock_};
+                auto index = util::IndexData{};
+                lmdb_.Load(
+                    table,
+                    key,
+                    [&index](const auto in) {
+                        if (sizeof(index) != in.size()) { return; }
+
+                        std::memcpy(
+                            static_cast<void*>(&index), in.data(), in.size());
+                    },
+                    tx);
+
+                if ((index.position_ != expected.position_) ||
+                    (index.size_ != expected.size_)) {
+                    // NOTE the item was modified since the scan
+
+                    return false;
+                }
+
+                auto cb = [&](auto& tx) {
+                    return lmdb_.Store(table, key, tsv(index), tx)
+                        .first;
+                };
+
+                return relocate(tx, index, std::move(cb));
+            };
+            const auto moved = guard ? guard(key, job) : job();
+
+            if (moved) {
+                const auto bytes = static_cast<std::size_t>(expected.size_);
+                budget -= std::min(budget, bytes);
+                ++output;
+            }
+        }
+
+        return output;
+    }
     auto Mutex() const noexcept -> std::mutex& { return lock_; }
     auto ReadView(const Lock&, const util::IndexData& index) const noexcept
         -> opentxs::ReadView
@@ -40,7 +127,8 @@ struct Bulk::Imp final : private util::MappedFileStorage {
               path,
               "blk",
               Table::Config,
-              static_cast<std::size_t>(Database::Key::NextBlockAddress))
+              static_cast<std::size_t>(Database::Key::NextBlockAddress),
+              Table::BulkFreeSpace)
         , lock_()
     {
     }
@@ -56,6 +144,12 @@ Bulk::Bulk(
 {
 }
 
+auto Bulk::Compact(const int table, const Guard& guard, std::size_t& budget)
+    const noexcept -> std::size_t
+{
+    return imp_->Compact(table, guard, budget);
+}
+
 auto Bulk::Mutex() const noexcept -> std::mutex& { return imp_->Mutex(); }
 
 auto Bulk::ReadView(const util::IndexData& index) const noexcept
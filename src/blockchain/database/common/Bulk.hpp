@@ -44,7 +44,12 @@ class Bulk
 public:
     using UpdateCallback =
         std::function<bool(storage::lmdb::LMDB::Transaction&)>;
+    using Relocate = std::function<bool()>;
+    using Guard =
+        std::function<bool(const opentxs::ReadView key, const Relocate& job)>;
 
+    auto Compact(const int table, const Guard& guard, std::size_t& budget)
+        const noexcept -> std::size_t;
     auto Mutex() const noexcept -> std::mutex&;
     auto ReadView(const util::IndexData& index) const noexcept
         -> opentxs::ReadView;
@@ -22,6 +22,8 @@ extern "C" {
 #include <fstream>  // IWYU pragma: keep
 #include <iosfwd>
 #include <iterator>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <type_traits>
@@ -37,11 +39,16 @@ extern "C" {
 #include "blockchain/database/common/Wallet.hpp"
 #include "internal/api/Legacy.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/Mutex.hpp"
+#include "internal/util/P0330.hpp"
 #include "internal/util/TSV.hpp"
+#include "opentxs/api/Settings.hpp"
+#include "opentxs/api/session/Session.hpp"
 #include "opentxs/blockchain/bitcoin/block/Transaction.hpp"  // IWYU pragma: keep
 #include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"  // IWYU pragma: keep
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
+#include "util/ByteLiterals.hpp"
 #include "util/LMDB.hpp"
 
 constexpr auto false_byte_ = std::byte{0x0};
@@ -54,6 +61,13 @@ namespace opentxs::blockchain::database::common
 struct Database::Imp {
     using SiphashKey = Space;
 
+    struct Compaction {
+        std::mutex lock_{};
+        bool running_{true};
+    };
+
+    static constexpr auto compaction_budget_ = 64_mib;
+    static constexpr auto compaction_interval_ = std::chrono::minutes{10};
     static const storage::lmdb::TableNames table_names_;
 
     const api::Session& api_;
@@ -61,6 +75,7 @@ struct Database::Imp {
     const fs::path blockchain_path_;
     const fs::path common_path_;
     const fs::path blocks_path_;
+    const storage::lmdb::Flags lmdb_flags_;
     storage::lmdb::LMDB lmdb_;
     Bulk bulk_;
     const SiphashKey siphash_key_;
@@ -71,6 +86,8 @@ struct Database::Imp {
     Sync sync_;
     Wallet wallet_;
     Configuration config_;
+    const std::shared_ptr<Compaction> compaction_;
+    int compaction_task_;
 
     static auto block_storage_enabled() noexcept -> bool
     {
@@ -148,6 +165,31 @@ struct Database::Imp {
 
         return output;
     }
+    static auto lmdb_flags(const api::Session& api) noexcept
+        -> storage::lmdb::Flags
+    {
+        const auto& config = api.Config();
+        const auto section = String::Factory("blockchain");
+        auto changed{false};
+        const auto check = [&](const char* key) {
+            auto output{false};
+            auto isNew{false};
+            config.CheckSet_bool(
+                section, String::Factory(key), false, output, isNew);
+            changed |= isNew;
+
+            return output;
+        };
+        const auto options = storage::lmdb::EnvironmentOptions{
+            check("lmdb_nosync"),
+            check("lmdb_nometasync"),
+            check("lmdb_writemap"),
+            check("lmdb_nordahead")};
+
+        if (changed) { config.Save(); }
+
+        return options.Flags();
+    }
     static auto siphash_key(storage::lmdb::LMDB& db) noexcept -> SiphashKey
     {
         auto configured = siphash_key_configured(db);
@@ -189,6 +231,28 @@ struct Database::Imp {
     {
         return init_folder(legacy_, blockchain_path_, dir);
     }
+    auto Compact() const noexcept -> void
+    {
+        auto budget = static_cast<std::size_t>(compaction_budget_);
+        auto moved = blocks_.Compact(budget);
+
+        for (const auto table :
+             {Table::HeaderIndex,
+              Table::FilterIndexBasic,
+              Table::FilterIndexBCH,
+              Table::FilterIndexES,
+              Table::TransactionIndex}) {
+            moved += bulk_.Compact(table, {}, budget);
+        }
+
+        moved += sync_.Compact(budget);
+
+        if (0_uz < moved) {
+            LogVerbose()(OT_PRETTY_CLASS())("relocated ")(moved)(
+                " records into free space")
+                .Flush();
+        }
+    }
 
     Imp(const api::Session& api,
         const api::crypto::Blockchain& blockchain,
@@ -200,6 +264,7 @@ struct Database::Imp {
         , blockchain_path_(init_storage_path(legacy, dataFolder))
         , common_path_(init_folder(legacy, blockchain_path_, "common"))
         , blocks_path_(init_folder(legacy, common_path_, "blocks"))
+        , lmdb_flags_(lmdb_flags(api_))
         , lmdb_(
               table_names_,
               common_path_,
@@ -224,6 +289,8 @@ struct Database::Imp {
                       {Table::FilterIndexBCH, 0},
                       {Table::FilterIndexES, 0},
                       {Table::TransactionIndex, 0},
+                      {Table::BulkFreeSpace, MDB_INTEGERKEY},
+                      {Table::SyncFreeSpace, MDB_INTEGERKEY},
                   };
 
                   for (const auto& [table, name] : SyncTables()) {
@@ -232,7 +299,7 @@ struct Database::Imp {
 
                   return output;
               }(),
-              0,
+              lmdb_flags_,
               [&] {
                   auto deleted = UnallocatedVector<Table>{};
                   deleted.emplace_back(Table::BlockHeadersDeleted);
@@ -251,11 +318,37 @@ struct Database::Imp {
         , sync_(api_, lmdb_, blocks_path_)
         , wallet_(api_, blockchain, lmdb_, bulk_)
         , config_(api_, lmdb_)
+        , compaction_(std::make_shared<Compaction>())
+        , compaction_task_(-1)
     {
         OT_ASSERT(crypto_shorthash_KEYBYTES == siphash_key_.size());
 
         static_assert(
             sizeof(opentxs::blockchain::PatternID) == crypto_shorthash_BYTES);
+
+        // NOTE periodic tasks run on detached threads which may outlive this
+        // object so the task must check whether it is still valid
+        const auto now = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::now().time_since_epoch());
+        compaction_task_ = api_.Schedule(
+            compaction_interval_,
+            [this, weak = std::weak_ptr<Compaction>{compaction_}] {
+                auto state = weak.lock();
+
+                if (false == bool(state)) { return; }
+
+                auto lock = Lock{state->lock_, std::try_to_lock};
+
+                if (lock.owns_lock() && state->running_) { Compact(); }
+            },
+            now);
+    }
+
+    ~Imp()
+    {
+        api_.Cancel(compaction_task_);
+        auto lock = Lock{compaction_->lock_};
+        compaction_->running_ = false;
     }
 };
 
@@ -284,6 +377,8 @@ const storage::lmdb::TableNames Database::Imp::table_names_ = [] {
         {Table::FilterIndexBCH, "block_filters_bch_2"},
         {Table::FilterIndexES, "block_filters_opentxs_2"},
         {Table::TransactionIndex, "transactions"},
+        {Table::BulkFreeSpace, "blocks_free_space"},
+        {Table::SyncFreeSpace, "sync_free_space"},
     };
 
     for (const auto& [table, name] : SyncTables()) {
@@ -363,6 +458,11 @@ auto Database::Disable(const Chain type) const noexcept -> bool
     return imp_.lmdb_.Store(Enabled, key, reader(value)).first;
 }
 
+auto Database::EnvironmentFlags() const noexcept -> storage::lmdb::Flags
+{
+    return imp_.lmdb_flags_;
+}
+
 auto Database::Enable(const Chain type, std::string_view seednode)
     const noexcept -> bool
 {
@@ -108,6 +108,7 @@ public:
         SiphashKey = 2,
         NextSyncAddress = 3,
         SyncServerEndpoint = 4,
+        CfilterStorageVersion = 5,
     };
 
     using BlockHash = opentxs::blockchain::block::Hash;
@@ -133,6 +134,8 @@ public:
         const noexcept -> BlockWriter;
     auto DeleteSyncServer(std::string_view endpoint) const noexcept -> bool;
     auto Disable(const Chain type) const noexcept -> bool;
+    // Flags for LMDB environments which contain blockchain data
+    auto EnvironmentFlags() const noexcept -> storage::lmdb::Flags;
     auto Enable(const Chain type, std::string_view seednode) const noexcept
         -> bool;
     auto Find(
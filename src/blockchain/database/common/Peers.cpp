@@ -220,154 +220,159 @@ auto Peers::insert(
     const Lock& lock,
     UnallocatedVector<Address_p> peers) noexcept -> bool
 {
-    auto parentTxn = lmdb_.TransactionRW();
+    auto stored = lmdb_.Batch([&](auto& parentTxn) {
+        for (auto& pAddress : peers) {
+            if (false == bool(pAddress)) {
+                LogError()(OT_PRETTY_CLASS())("Invalid peer").Flush();
 
-    for (auto& pAddress : peers) {
-        if (false == bool(pAddress)) {
-            LogError()(OT_PRETTY_CLASS())("Invalid peer").Flush();
+                return false;
+            }
 
-            return false;
-        }
+            auto& address = *pAddress;
+            const auto id = address.ID().asBase58(api_.Crypto());
+            auto deleteServices = address.PreviousServices();
 
-        auto& address = *pAddress;
-        const auto id = address.ID().asBase58(api_.Crypto());
-        auto deleteServices = address.PreviousServices();
+            for (const auto& service : address.Services()) {
+                deleteServices.erase(service);
+            }
 
-        for (const auto& service : address.Services()) {
-            deleteServices.erase(service);
-        }
+            // write to database
+            {
+                auto result = lmdb_.Store(
+                    Table::PeerDetails,
+                    id,
+                    [&] {
+                        auto proto =
+                            opentxs::blockchain::p2p::Address::SerializedType{};
+                        address.Serialize(proto);
 
-        // write to database
-        {
-            auto result = lmdb_.Store(
-                Table::PeerDetails,
-                id,
-                [&] {
-                    auto proto =
-                        opentxs::blockchain::p2p::Address::SerializedType{};
-                    address.Serialize(proto);
+                        return proto::ToString(proto);
+                    }(),
+                    parentTxn);
 
-                    return proto::ToString(proto);
-                }(),
-                parentTxn);
+                if (false == result.first) {
+                    LogError()(OT_PRETTY_CLASS())("Failed to save peer address")
+                        .Flush();
 
-            if (false == result.first) {
-                LogError()(OT_PRETTY_CLASS())("Failed to save peer address")
-                    .Flush();
+                    return false;
+                }
 
-                return false;
-            }
+                result = lmdb_.Store(
+                    Table::PeerChainIndex,
+                    static_cast<std::size_t>(address.Chain()),
+                    id,
+                    parentTxn);
 
-            result = lmdb_.Store(
-                Table::PeerChainIndex,
-                static_cast<std::size_t>(address.Chain()),
-                id,
-                parentTxn);
+                if (false == result.first) {
+                    LogError()(OT_PRETTY_CLASS())(
+                        "Failed to save peer chain index")
+                        .Flush();
 
-            if (false == result.first) {
-                LogError()(OT_PRETTY_CLASS())("Failed to save peer chain index")
-                    .Flush();
+                    return false;
+                }
 
-                return false;
-            }
+                result = lmdb_.Store(
+                    Table::PeerProtocolIndex,
+                    static_cast<std::size_t>(address.Style()),
+                    id,
+                    parentTxn);
 
-            result = lmdb_.Store(
-                Table::PeerProtocolIndex,
-                static_cast<std::size_t>(address.Style()),
-                id,
-                parentTxn);
+                if (false == result.first) {
+                    LogError()(OT_PRETTY_CLASS())(
+                        "Failed to save peer protocol index")
+                        .Flush();
 
-            if (false == result.first) {
-                LogError()(OT_PRETTY_CLASS())(
-                    "Failed to save peer protocol index")
-                    .Flush();
+                    return false;
+                }
 
-                return false;
-            }
+                for (const auto& service : address.Services()) {
+                    result = lmdb_.Store(
+                        Table::PeerServiceIndex,
+                        static_cast<std::size_t>(service),
+                        id,
+                        parentTxn);
+
+                    if (false == result.first) {
+                        LogError()(OT_PRETTY_CLASS())(
+                            "Failed to save peer service index")
+                            .Flush();
+
+                        return false;
+                    }
+                }
+
+                for (const auto& service : deleteServices) {
+                    result.first = lmdb_.Delete(
+                        Table::PeerServiceIndex,
+                        static_cast<std::size_t>(service),
+                        id,
+                        parentTxn);
+                }
 
-            for (const auto& service : address.Services()) {
                 result = lmdb_.Store(
-                    Table::PeerServiceIndex,
-                    static_cast<std::size_t>(service),
+                    Table::PeerNetworkIndex,
+                    static_cast<std::size_t>(address.Type()),
                     id,
                     parentTxn);
 
                 if (false == result.first) {
                     LogError()(OT_PRETTY_CLASS())(
-                        "Failed to save peer service index")
+                        "Failed to save peer network index")
                         .Flush();
 
                     return false;
                 }
-            }
 
-            for (const auto& service : deleteServices) {
-                result.first = lmdb_.Delete(
-                    Table::PeerServiceIndex,
-                    static_cast<std::size_t>(service),
+                result = lmdb_.Store(
+                    Table::PeerConnectedIndex,
+                    static_cast<std::size_t>(
+                        Clock::to_time_t(address.LastConnected())),
                     id,
                     parentTxn);
-            }
 
-            result = lmdb_.Store(
-                Table::PeerNetworkIndex,
-                static_cast<std::size_t>(address.Type()),
-                id,
-                parentTxn);
+                if (false == result.first) {
+                    LogError()(OT_PRETTY_CLASS())(
+                        "Failed to save peer network index")
+                        .Flush();
 
-            if (false == result.first) {
-                LogError()(OT_PRETTY_CLASS())(
-                    "Failed to save peer network index")
-                    .Flush();
+                    return false;
+                }
 
-                return false;
+                lmdb_.Delete(
+                    Table::PeerConnectedIndex,
+                    static_cast<std::size_t>(
+                        Clock::to_time_t(address.PreviousLastConnected())),
+                    id,
+                    parentTxn);
             }
+        }
 
-            result = lmdb_.Store(
-                Table::PeerConnectedIndex,
-                static_cast<std::size_t>(
-                    Clock::to_time_t(address.LastConnected())),
-                id,
-                parentTxn);
-
-            if (false == result.first) {
-                LogError()(OT_PRETTY_CLASS())(
-                    "Failed to save peer network index")
-                    .Flush();
-
-                return false;
-            }
+        return true;
+    });
 
-            lmdb_.Delete(
-                Table::PeerConnectedIndex,
-                static_cast<std::size_t>(
-                    Clock::to_time_t(address.PreviousLastConnected())),
-                id,
-                parentTxn);
-        }
+    if (false == stored.get()) {
+        LogError()(OT_PRETTY_CLASS())("Database error").Flush();
 
-        // Update in-memory indices to match database
-        {
-            chains_[address.Chain()].emplace(id);
-            protocols_[address.Style()].emplace(id);
-            networks_[address.Type()].emplace(id);
+        return false;
+    }
 
-            for (const auto& service : address.Services()) {
-                services_[service].emplace(id);
-            }
+    // NOTE the in-memory indices are only updated once the batch has been
+    // committed
+    for (const auto& pAddress : peers) {
+        const auto& address = *pAddress;
+        const auto id = address.ID().asBase58(api_.Crypto());
+        const auto services = address.Services();
+        chains_[address.Chain()].emplace(id);
+        protocols_[address.Style()].emplace(id);
+        networks_[address.Type()].emplace(id);
 
-            for (const auto& service : deleteServices) {
-                services_[service].erase(id);
-            }
+        for (const auto& service : services) { services_[service].emplace(id); }
 
-            connected_[id] = address.LastConnected();
+        for (const auto& service : address.PreviousServices()) {
+            if (0u == services.count(service)) { services_[service].erase(id); }
         }
-    }
-
-    if (false == parentTxn.Finalize(true)) {
-        LogError()(OT_PRETTY_CLASS())("Database error").Flush();
 
-        return false;
+        connected_[id] = address.LastConnected();
     }
 
     return true;
@@ -17,6 +17,7 @@
 #include <memory>
 #include <stdexcept>
 #include <string_view>
+#include <tuple>
 #include <utility>
 
 #include "opentxs/core/ByteArray.hpp"
@@ -118,6 +119,69 @@ struct Sync::Imp final : private util::MappedFileStorage {
         return haveOne;
     }
 
+    auto Compact(std::size_t& budget) const noexcept -> std::size_t
+    {
+        using Candidate = std::tuple<int, std::size_t, Data>;
+        auto lock = ExclusiveLock{lock_};
+        auto candidates = UnallocatedVector<Candidate>{};
+
+        for (const auto& [table, name] : SyncTables()) {
+            lmdb_.Read(
+                table,
+                [&](const auto key, const auto value) {
+                    try {
+                        if (sizeof(std::size_t) != key.size()) {
+                            throw std::runtime_error("Invalid key");
+                        }
+
+                        auto dbKey = 0_uz;
+                        std::memcpy(&dbKey, key.data(), key.size());
+                        const auto data = Data{value};
+
+                        if (should_relocate(data.index_)) {
+                            candidates.emplace_back(table, dbKey, data);
+                        }
+                    } catch (const std::exception& e) {
+                        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+                    }
+
+                    return true;
+                },
+                LMDB::Dir::Forward);
+        }
+
+        std::sort(
+            candidates.begin(),
+            candidates.end(),
+            [](const auto& lhs, const auto& rhs) {
+                return std::get<2>(lhs).index_.position_ >
+                       std::get<2>(rhs).index_.position_;
+            });
+        auto output = 0_uz;
+
+        for (auto& candidate : candidates) {
+            if (0_uz == budget) { break; }
+
+            const auto table = std::get<0>(candidate);
+            const auto dbKey = std::get<1>(candidate);
+            auto& data = std::get<2>(candidate);
+            const auto bytes = static_cast<std::size_t>(data.index_.size_);
+            auto txn = lmdb_.TransactionRW();
+            auto cb = [&](auto& tx) {
+                return lmdb_.Store(table, dbKey, data, tx).first;
+            };
+
+            if (false == relocate(txn, data.index_, std::move(cb))) {
+                continue;
+            }
+
+            budget -= std::min(budget, bytes);
+            ++output;
+        }
+
+        return output;
+    }
+
     auto Reorg(const Chain chain, const Height height) const noexcept -> bool
     {
         auto lock = ExclusiveLock{lock_};
@@ -251,7 +315,8 @@ struct Sync::Imp final : private util::MappedFileStorage {
               path,
               "sync",
               Table::Config,
-              static_cast<std::size_t>(Database::Key::NextSyncAddress))
+              static_cast<std::size_t>(Database::Key::NextSyncAddress),
+              Table::SyncFreeSpace)
         , api_(api)
         , tip_table_(Table::SyncTips)
         , lock_()
@@ -403,8 +468,20 @@ private:
         const auto table = ChainToSyncTable(chain);
 
         for (auto key = Height{height + 1}; key <= tip; ++key) {
-            if (false ==
-                lmdb_.Delete(table, static_cast<std::size_t>(key), txn)) {
+            const auto dbKey = static_cast<std::size_t>(key);
+            lmdb_.Load(
+                table,
+                tsv(dbKey),
+                [&](const auto in) {
+                    try {
+                        release(txn, Data{in}.index_);
+                    } catch (const std::exception& e) {
+                        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+                    }
+                },
+                txn);
+
+            if (false == lmdb_.Delete(table, dbKey, txn)) {
                 LogError()(OT_PRETTY_CLASS())("Delete error").Flush();
 
                 return false;
@@ -441,6 +518,11 @@ Sync::Sync(
 {
 }
 
+auto Sync::Compact(std::size_t& budget) const noexcept -> std::size_t
+{
+    return imp_->Compact(budget);
+}
+
 auto Sync::Load(const Chain chain, const Height height, Message& output)
     const noexcept -> bool
 {
@@ -7,6 +7,7 @@
 
 #include <boost/thread/thread.hpp>
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <filesystem>
@@ -67,6 +68,8 @@ public:
     using Height = opentxs::blockchain::block::Height;
     using Message = opentxs::network::p2p::Data;
 
+    // Move records into free space nearer the start of storage
+    auto Compact(std::size_t& budget) const noexcept -> std::size_t;
     auto Load(const Chain chain, const Height height, Message& output)
         const noexcept -> bool;
     // Delete all entries with a height greater than specified
@@ -14,9 +14,81 @@
 #include "internal/util/P0330.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
 #include "opentxs/util/Types.hpp"
+#include "util/ByteLiterals.hpp"
 
 namespace opentxs::blockchain::node::internal
 {
+BlockCacheMetrics::BlockCacheMetrics(const BlockCacheMetrics& rhs) noexcept
+    : hits_(rhs.hits_.load())
+    , misses_(rhs.misses_.load())
+    , evictions_(rhs.evictions_.load())
+    , blocks_(rhs.blocks_.load())
+    , bytes_(rhs.bytes_.load())
+{
+}
+
+auto BlockCacheMetrics::operator=(const BlockCacheMetrics& rhs) noexcept
+    -> BlockCacheMetrics&
+{
+    if (this != &rhs) {
+        hits_.store(rhs.hits_.load());
+        misses_.store(rhs.misses_.load());
+        evictions_.store(rhs.evictions_.load());
+        blocks_.store(rhs.blocks_.load());
+        bytes_.store(rhs.bytes_.load());
+    }
+
+    return *this;
+}
+
+auto Config::BlockCacheLimit() const noexcept -> std::size_t
+{
+    if (0_uz < block_cache_bytes_) { return block_cache_bytes_; }
+
+    switch (profile_) {
+        case BlockchainProfile::mobile: {
+
+            return 32_mib;
+        }
+        case BlockchainProfile::desktop:
+        case BlockchainProfile::desktop_native: {
+
+            return 256_mib;
+        }
+        case BlockchainProfile::server: {
+
+            return 1_gib;
+        }
+        default: {
+
+            OT_FAIL;
+        }
+    }
+}
+
+auto Config::MempoolLimit() const noexcept -> std::size_t
+{
+    switch (profile_) {
+        case BlockchainProfile::mobile: {
+
+            return 8_mib;
+        }
+        case BlockchainProfile::desktop:
+        case BlockchainProfile::desktop_native: {
+
+            return 64_mib;
+        }
+        case BlockchainProfile::server: {
+
+            return 300_mib;
+        }
+        default: {
+
+            OT_FAIL;
+        }
+    }
+}
+
 auto Config::PeerTarget(const blockchain::Type chain) const noexcept
     -> std::size_t
 {
@@ -60,6 +132,15 @@ auto Config::Print(alloc::Default alloc) const noexcept -> CString
     output << "  * provide sync server: " << print_bool(provide_sync_server_)
            << '\n';
     output << "  * disable wallet: " << print_bool(disable_wallet_) << '\n';
+    output << "  * block cache limit: " << BlockCacheLimit() << " bytes\n";
+    output << "  * block cache usage: " << block_cache_.blocks_.load()
+           << " blocks, " << block_cache_.bytes_.load() << " bytes\n";
+    output << "  * block cache hits: " << block_cache_.hits_.load() << '\n';
+    output << "  * block cache misses: " << block_cache_.misses_.load()
+           << '\n';
+    output << "  * block cache evictions: " << block_cache_.evictions_.load()
+           << '\n';
+    output << "  * mempool limit: " << MempoolLimit() << " bytes\n";
 
     return CString{alloc}.append(output.str());
 }
@@ -0,0 +1,296 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                     // IWYU pragma: associated
+#include "1_Internal.hpp"                   // IWYU pragma: associated
+#include "blockchain/node/HeaderCache.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "blockchain/node/UpdateTransaction.hpp"
+#include "internal/blockchain/block/Header.hpp"
+#include "internal/blockchain/database/Header.hpp"
+#include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
+#include "opentxs/blockchain/block/Header.hpp"
+
+namespace opentxs::blockchain::node
+{
+HeaderCache::HeaderCache(
+    const database::Header& database,
+    BestBlockFunction bestBlock,
+    const std::size_t capacity) noexcept
+    : db_(database)
+    , best_block_(std::move(bestBlock))
+    , capacity_(std::max(capacity, 1_uz))
+    , data_()
+{
+    OT_ASSERT(best_block_);
+}
+
+auto HeaderCache::Apply(const UpdateTransaction& update) noexcept -> void
+{
+    auto handle = data_.lock();
+    auto& data = *handle;
+
+    if (auto& cached = data.disconnected_; cached.has_value()) {
+        for (const auto& segment : update.Disconnected()) {
+            cached->emplace(segment);
+        }
+
+        for (const auto& [parent, child] : update.Connected()) {
+            auto [first, last] = cached->equal_range(parent);
+
+            for (auto it{first}; it != last;) {
+                if (it->second == child) {
+                    it = cached->erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+    }
+
+    if (auto& cached = data.siblings_; cached.has_value()) {
+        for (const auto& hash : update.SiblingsToAdd()) {
+            cached->emplace(hash);
+        }
+
+        for (const auto& hash : update.SiblingsToDelete()) {
+            cached->erase(hash);
+        }
+    }
+
+    for (const auto& [hash, value] : update.UpdatedHeaders()) {
+        const auto& [pHeader, isNew] = value;
+
+        OT_ASSERT(pHeader);
+
+        const auto& header = *pHeader;
+
+        if (auto* node = get(data, hash); nullptr != node) {
+            node->header_ = header.clone();
+        } else {
+            // NOTE a header which did not exist in the database prior to this
+            // update can only have children which are connected by this
+            // update, unless the header is itself disconnected
+            const auto complete =
+                isNew && (false == header.Internal().IsDisconnected());
+            insert(data, header.clone(), complete);
+        }
+    }
+
+    // NOTE UpdatedHeaders is ordered by hash rather than by height so children
+    // may only be linked once every new header has been inserted
+    for (const auto& [hash, value] : update.UpdatedHeaders()) {
+        const auto& [pHeader, isNew] = value;
+
+        if (false == isNew) { continue; }
+
+        if (auto* parent = get(data, pHeader->ParentHash());
+            nullptr != parent) {
+            parent->children_.emplace(hash);
+        }
+    }
+
+    for (const auto& [parent, child] : update.Connected()) {
+        if (auto* node = get(data, parent); nullptr != node) {
+            node->children_.emplace(child);
+        }
+    }
+
+    if (const auto& best = update.BestChain(); false == best.empty()) {
+        data.best_ = best.crbegin()->second;
+    }
+}
+
+auto HeaderCache::BestBlock(const block::Height height) const noexcept(false)
+    -> block::Hash
+{
+    if (auto hash = best_block_(height); hash.has_value()) {
+
+        return std::move(hash.value());
+    }
+
+    return db_.BestBlock(height);
+}
+
+auto HeaderCache::CurrentBest() const noexcept -> std::unique_ptr<block::Header>
+{
+    const auto best = data_.lock()->best_;
+
+    if (best.has_value()) {
+        if (auto out = TryLoadHeader(best.value()); out) { return out; }
+    }
+
+    auto out = db_.CurrentBest();
+
+    if (out) {
+        auto handle = data_.lock();
+        auto& data = *handle;
+        data.best_ = out->Hash();
+
+        if (nullptr == get(data, out->Hash())) {
+            insert(data, out->clone(), false);
+        }
+    }
+
+    return out;
+}
+
+auto HeaderCache::CurrentCheckpoint() const noexcept -> block::Position
+{
+    return db_.CurrentCheckpoint();
+}
+
+auto HeaderCache::DisconnectedHashes() const noexcept
+    -> database::DisconnectedList
+{
+    {
+        const auto handle = data_.lock();
+        const auto& cached = handle->disconnected_;
+
+        if (cached.has_value()) { return cached.value(); }
+    }
+
+    auto out = db_.DisconnectedHashes();
+    data_.lock()->disconnected_ = out;
+
+    return out;
+}
+
+auto HeaderCache::get(Data& data, const block::Hash& hash) const noexcept
+    -> Node*
+{
+    auto i = data.nodes_.find(hash);
+
+    if (data.nodes_.end() == i) { return nullptr; }
+
+    auto& node = i->second;
+    data.recent_.splice(data.recent_.begin(), data.recent_, node.recent_);
+
+    return &node;
+}
+
+auto HeaderCache::HaveCheckpoint() const noexcept -> bool
+{
+    return db_.HaveCheckpoint();
+}
+
+auto HeaderCache::HeaderExists(
+    const block::Hash& hash,
+    const block::Hash& parent) const noexcept -> bool
+{
+    {
+        auto handle = data_.lock();
+        auto& data = *handle;
+
+        if (nullptr != get(data, hash)) { return true; }
+
+        const auto* node = get(data, parent);
+
+        if ((nullptr != node) && node->complete_) {
+
+            return 0_uz < node->children_.count(hash);
+        }
+    }
+
+    return db_.HeaderExists(hash);
+}
+
+auto HeaderCache::insert(
+    Data& data,
+    std::unique_ptr<block::Header> header,
+    const bool complete) const noexcept -> Node&
+{
+    OT_ASSERT(header);
+
+    auto& recent = data.recent_;
+    const auto& hash = recent.emplace_front(header->Hash());
+    auto& node = data.nodes_[hash];
+
+    OT_ASSERT(false == bool(node.header_));
+
+    node.header_ = std::move(header);
+    node.complete_ = complete;
+    node.recent_ = recent.begin();
+
+    while (data.nodes_.size() > capacity_) {
+        data.nodes_.erase(recent.back());
+        recent.pop_back();
+    }
+
+    return node;
+}
+
+auto HeaderCache::LoadHeader(const block::Hash& hash) const noexcept(false)
+    -> std::unique_ptr<block::Header>
+{
+    auto out = TryLoadHeader(hash);
+
+    if (false == bool(out)) {
+        throw std::out_of_range("Block header not found");
+    }
+
+    return out;
+}
+
+auto HeaderCache::Reset() noexcept -> void
+{
+    auto handle = data_.lock();
+    auto& data = *handle;
+    data.nodes_.clear();
+    data.recent_.clear();
+    data.best_.reset();
+    data.disconnected_.reset();
+    data.siblings_.reset();
+}
+
+auto HeaderCache::SiblingHashes() const noexcept -> database::Hashes
+{
+    {
+        const auto handle = data_.lock();
+        const auto& cached = handle->siblings_;
+
+        if (cached.has_value()) { return cached.value(); }
+    }
+
+    auto out = db_.SiblingHashes();
+    data_.lock()->siblings_ = out;
+
+    return out;
+}
+
+auto HeaderCache::TryLoadHeader(const block::Hash& hash) const noexcept
+    -> std::unique_ptr<block::Header>
+{
+    {
+        auto handle = data_.lock();
+
+        if (const auto* node = get(*handle, hash); nullptr != node) {
+
+            return node->header_->clone();
+        }
+    }
+
+    auto out = db_.TryLoadHeader(hash);
+
+    if (out) {
+        auto handle = data_.lock();
+        auto& data = *handle;
+
+        // NOTE never replace an entry here since it may have been written by a
+        // concurrent call to Apply and therefore be newer than the database
+        // state which was just read
+        if (nullptr == get(data, hash)) { insert(data, out->clone(), false); }
+    }
+
+    return out;
+}
+
+HeaderCache::~HeaderCache() = default;
+}  // namespace opentxs::blockchain::node
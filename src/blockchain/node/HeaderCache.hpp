@@ -0,0 +1,135 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cs_plain_guarded.h>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+
+#include "internal/blockchain/database/Types.hpp"
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/blockchain/block/Position.hpp"
+#include "opentxs/blockchain/block/Types.hpp"
+#include "opentxs/util/Container.hpp"
+
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace blockchain
+{
+namespace block
+{
+class Header;
+}  // namespace block
+
+namespace database
+{
+class Header;
+}  // namespace database
+
+namespace node
+{
+class UpdateTransaction;
+}  // namespace node
+}  // namespace blockchain
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
+namespace opentxs::blockchain::node
+{
+// NOTE read-through cache which sits in front of database::Header.
+//
+// It holds a bounded graph of recently used headers, including the metadata
+// (cumulative work, state) they were committed with, plus the complete sibling
+// and disconnected sets. Headers which were first committed while the cache
+// was running also track their children, so for a header whose parent is one
+// of those the cache can prove the header is unknown without a database read.
+//
+// The owner must call Apply after every committed update and Reset after any
+// failed update, and must serialize those calls with CurrentBest,
+// DisconnectedHashes, and SiblingHashes. Header lookups are safe from any
+// thread.
+class HeaderCache
+{
+public:
+    using BestBlockFunction =
+        std::function<std::optional<block::Hash>(const block::Height)>;
+
+    static constexpr auto default_capacity_ = std::size_t{16384};
+
+    // Throws std::out_of_range if no block at that position
+    auto BestBlock(const block::Height height) const noexcept(false)
+        -> block::Hash;
+    auto CurrentBest() const noexcept -> std::unique_ptr<block::Header>;
+    auto CurrentCheckpoint() const noexcept -> block::Position;
+    auto DisconnectedHashes() const noexcept -> database::DisconnectedList;
+    auto HaveCheckpoint() const noexcept -> bool;
+    auto HeaderExists(const block::Hash& hash, const block::Hash& parent)
+        const noexcept -> bool;
+    // Throws std::out_of_range if the header does not exist
+    auto LoadHeader(const block::Hash& hash) const noexcept(false)
+        -> std::unique_ptr<block::Header>;
+    auto SiblingHashes() const noexcept -> database::Hashes;
+    // Returns null pointer if the header does not exist
+    auto TryLoadHeader(const block::Hash& hash) const noexcept
+        -> std::unique_ptr<block::Header>;
+
+    // NOTE must not read from the database since it is called while the
+    // database is still locked by the update which is being applied
+    auto Apply(const UpdateTransaction& update) noexcept -> void;
+    auto Reset() noexcept -> void;
+
+    HeaderCache(
+        const database::Header& database,
+        BestBlockFunction bestBlock,
+        const std::size_t capacity = default_capacity_) noexcept;
+    HeaderCache() = delete;
+    HeaderCache(const HeaderCache&) = delete;
+    HeaderCache(HeaderCache&&) = delete;
+    auto operator=(const HeaderCache&) -> HeaderCache& = delete;
+    auto operator=(HeaderCache&&) -> HeaderCache& = delete;
+
+    ~HeaderCache();
+
+private:
+    using Recent = UnallocatedList<block::Hash>;
+
+    struct Node {
+        std::unique_ptr<block::Header> header_{};
+        UnallocatedSet<block::Hash> children_{};
+        // NOTE true if children_ contains every child known to the database
+        bool complete_{};
+        Recent::iterator recent_{};
+    };
+
+    struct Data {
+        UnallocatedUnorderedMap<block::Hash, Node> nodes_{};
+        // NOTE most recently used first
+        Recent recent_{};
+        std::optional<block::Hash> best_{};
+        std::optional<database::DisconnectedList> disconnected_{};
+        std::optional<database::Hashes> siblings_{};
+    };
+
+    using Guarded = libguarded::plain_guarded<Data>;
+
+    const database::Header& db_;
+    const BestBlockFunction best_block_;
+    const std::size_t capacity_;
+    mutable Guarded data_;
+
+    auto get(Data& data, const block::Hash& hash) const noexcept -> Node*;
+    auto insert(
+        Data& data,
+        std::unique_ptr<block::Header> header,
+        const bool complete) const noexcept -> Node&;
+};
+}  // namespace opentxs::blockchain::node
@@ -11,6 +11,8 @@
 #include <atomic>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <optional>
 #include <stdexcept>
 #include <type_traits>
 
@@ -54,6 +56,129 @@ auto HeaderOracle(
 
 namespace opentxs::blockchain::node::implementation
 {
+HeaderOracle::BestChainIndex::BestChainIndex() noexcept
+    : current_(std::make_shared<const Snapshot>())
+    , high_water_(0_uz)
+{
+}
+
+auto HeaderOracle::BestChainIndex::Get() const noexcept
+    -> std::shared_ptr<const Snapshot>
+{
+    return std::atomic_load(&current_);
+}
+
+auto HeaderOracle::BestChainIndex::Load(
+    const database::Header& database) noexcept -> void
+{
+    auto next = Snapshot{};
+    auto copied = UnallocatedSet<std::size_t>{};
+    const auto best = database.CurrentBest();
+
+    OT_ASSERT(best);
+
+    const auto tip = best->Position().height_;
+
+    // NOTE this reads one record per height so it is only used at startup and
+    // after an update which could not be applied incrementally
+    try {
+        for (auto height = block::Height{0}; height <= tip; ++height) {
+            set(next, copied, height, database.BestBlock(height));
+        }
+    } catch (const std::exception& e) {
+        LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+    }
+
+    // NOTE a full reload never shares chunks with previous snapshots
+    high_water_ = 0_uz;
+    Publish(std::move(next));
+}
+
+auto HeaderOracle::BestChainIndex::Prepare(
+    const UpdateTransaction& update) const noexcept -> std::optional<Snapshot>
+{
+    auto next = Snapshot{*Get()};
+    auto copied = UnallocatedSet<std::size_t>{};
+
+    if (update.HaveReorg()) {
+        const auto parent = update.ReorgParent().height_;
+
+        if ((0 > parent) || (next.size_ <= static_cast<std::size_t>(parent))) {
+
+            return std::nullopt;
+        }
+
+        next.size_ = static_cast<std::size_t>(parent) + 1_uz;
+    }
+
+    for (const auto& [height, hash] : update.BestChain()) {
+        if ((0 > height) || (static_cast<std::size_t>(height) > next.size_)) {
+
+            return std::nullopt;
+        }
+
+        set(next, copied, height, hash);
+    }
+
+    return next;
+}
+
+auto HeaderOracle::BestChainIndex::Publish(Snapshot&& next) noexcept -> void
+{
+    high_water_ = std::max(high_water_, next.size_);
+    std::atomic_store(
+        &current_, std::make_shared<const Snapshot>(std::move(next)));
+}
+
+auto HeaderOracle::BestChainIndex::set(
+    Snapshot& next,
+    UnallocatedSet<std::size_t>& copied,
+    const block::Height height,
+    const block::Hash& hash) const noexcept -> void
+{
+    const auto index = static_cast<std::size_t>(height);
+    const auto chunk = index / chunk_size_;
+    auto& chunks = next.chunks_;
+
+    while (chunks.size() <= chunk) {
+        chunks.emplace_back(std::make_shared<Chunk>());
+        copied.emplace(chunks.size() - 1_uz);
+    }
+
+    // NOTE slots below the high water mark may be visible to readers of an
+    // older snapshot so the chunk containing them must be copied first
+    if ((index < high_water_) && (0_uz == copied.count(chunk))) {
+        chunks[chunk] = std::make_shared<Chunk>(*chunks[chunk]);
+        copied.emplace(chunk);
+    }
+
+    (*chunks[chunk])[index % chunk_size_] = hash;
+    next.size_ = std::max(next.size_, index + 1_uz);
+}
+
+auto HeaderOracle::BestChainIndex::Snapshot::Hash(
+    const block::Height height) const noexcept -> const block::Hash*
+{
+    if ((0 > height) || (static_cast<std::size_t>(height) >= size_)) {
+
+        return nullptr;
+    }
+
+    const auto index = static_cast<std::size_t>(height);
+
+    return std::addressof((*chunks_[index / chunk_size_])[index % chunk_size_]);
+}
+
+auto HeaderOracle::BestChainIndex::Snapshot::Tip() const noexcept
+    -> block::Position
+{
+    if (0_uz == size_) { return {}; }
+
+    const auto height = static_cast<block::Height>(size_ - 1_uz);
+
+    return block::Position{height, *Hash(height)};
+}
+
 HeaderOracle::HeaderOracle(
     const api::Session& api,
     database::Header& database,
@@ -63,9 +188,24 @@ HeaderOracle::HeaderOracle(
     , database_(database)
     , chain_(type)
     , lock_()
+    , best_()
+    , cache_(
+          database_,
+          [this](const auto height) -> std::optional<block::Hash> {
+              const auto chain = best_.Get();
+
+              if (const auto* hash = chain->Hash(height); nullptr != hash) {
+
+                  return *hash;
+              } else {
+
+                  return std::nullopt;
+              }
+          })
 {
     auto lock = Lock{lock_};
-    const auto best = best_chain(lock);
+    best_.Load(database_);
+    const auto best = best_.Get()->Tip();
 
     OT_ASSERT(0 <= best.height_);
 }
@@ -75,16 +215,15 @@ auto HeaderOracle::Ancestors(
     const block::Position& target,
     const std::size_t limit) const noexcept(false) -> Positions
 {
-    auto lock = Lock{lock_};
+    const auto chain = best_.Get();
     const auto check =
         std::max<block::Height>(std::min(start.height_, target.height_), 0);
-    const auto fast = is_in_best_chain(lock, target.hash_).first &&
-                      is_in_best_chain(lock, start.hash_).first &&
+    const auto fast = is_in_best_chain(*chain, target.hash_).first &&
+                      is_in_best_chain(*chain, start.hash_).first &&
                       (start.height_ < target.height_);
 
     if (fast) {
-        auto output = best_chain(lock, start, limit);
-        lock.unlock();
+        auto output = best_chain(*chain, start, limit);
 
         while ((1 < output.size()) &&
                (output.back().height_ > target.height_)) {
@@ -98,14 +237,14 @@ auto HeaderOracle::Ancestors(
     }
 
     auto cache = UnallocatedDeque<block::Position>{};
-    auto current = database_.LoadHeader(target.hash_);
-    auto sibling = database_.LoadHeader(start.hash_);
+    auto current = cache_.LoadHeader(target.hash_);
+    auto sibling = cache_.LoadHeader(start.hash_);
 
     while (sibling->Height() > current->Height()) {
-        sibling = database_.TryLoadHeader(sibling->ParentHash());
+        sibling = cache_.TryLoadHeader(sibling->ParentHash());
 
         if (false == bool(sibling)) {
-            sibling = database_.TryLoadHeader(GenesisBlockHash(chain_));
+            sibling = cache_.TryLoadHeader(GenesisBlockHash(chain_));
 
             OT_ASSERT(sibling);
 
@@ -121,16 +260,16 @@ auto HeaderOracle::Ancestors(
         if (current->Position() == sibling->Position()) {
             break;
         } else if (current->Height() == sibling->Height()) {
-            sibling = database_.TryLoadHeader(sibling->ParentHash());
+            sibling = cache_.TryLoadHeader(sibling->ParentHash());
 
             if (false == bool(sibling)) {
-                sibling = database_.TryLoadHeader(GenesisBlockHash(chain_));
+                sibling = cache_.TryLoadHeader(GenesisBlockHash(chain_));
 
                 OT_ASSERT(sibling);
             }
         }
 
-        current = database_.TryLoadHeader(current->ParentHash());
+        current = cache_.TryLoadHeader(current->ParentHash());
 
         if (false == bool(current)) { break; }
     }
@@ -150,7 +289,7 @@ auto HeaderOracle::AddCheckpoint(
     const block::Hash& requiredHash) noexcept -> bool
 {
     auto lock = Lock{lock_};
-    auto update = UpdateTransaction{api_, database_};
+    auto update = UpdateTransaction{api_, cache_};
 
     if (update.EffectiveCheckpoint()) {
         LogError()(OT_PRETTY_CLASS())("Checkpoint already exists").Flush();
@@ -168,7 +307,7 @@ auto HeaderOracle::AddCheckpoint(
 
     if (apply_checkpoint(lock, position, update)) {
 
-        return database_.ApplyUpdate(update);
+        return apply_update(lock, update);
     } else {
 
         return false;
@@ -190,7 +329,7 @@ auto HeaderOracle::AddHeaders(
     if (0 == headers.size()) { return false; }
 
     auto lock = Lock{lock_};
-    auto update = UpdateTransaction{api_, database_};
+    auto update = UpdateTransaction{api_, cache_};
 
     for (auto& header : headers) {
         if (false == bool(header)) {
@@ -205,7 +344,7 @@ auto HeaderOracle::AddHeaders(
         }
     }
 
-    return database_.ApplyUpdate(update);
+    return apply_update(lock, update);
 }
 
 auto HeaderOracle::add_header(
@@ -213,7 +352,7 @@ auto HeaderOracle::add_header(
     UpdateTransaction& update,
     std::unique_ptr<block::Header> pHeader) noexcept -> bool
 {
-    if (update.EffectiveHeaderExists(pHeader->Hash())) {
+    if (update.EffectiveHeaderExists(*pHeader)) {
         LogVerbose()(OT_PRETTY_CLASS())("Header already processed").Flush();
 
         return true;
@@ -311,40 +450,53 @@ auto HeaderOracle::apply_checkpoint(
     }
 }
 
-auto HeaderOracle::best_chain(const Lock& lock) const noexcept
-    -> block::Position
+auto HeaderOracle::apply_update(
+    const Lock& lock,
+    UpdateTransaction& update) noexcept -> bool
 {
-    return database_.CurrentBest()->Position();
+    auto next = best_.Prepare(update);
+    const auto committed = [&] {
+        if (next.has_value()) { best_.Publish(std::move(next.value())); }
+
+        cache_.Apply(update);
+    };
+    const auto applied = database_.ApplyUpdate(update, committed);
+
+    if (false == applied) {
+        // NOTE the database may have been partially updated
+        cache_.Reset();
+        best_.Load(database_);
+    } else if (false == next.has_value()) {
+        best_.Load(database_);
+    }
+
+    return applied;
 }
 
 auto HeaderOracle::BestChain() const noexcept -> block::Position
 {
-    auto lock = Lock{lock_};
-
-    return best_chain(lock);
+    return best_.Get()->Tip();
 }
 
 auto HeaderOracle::BestChain(
     const block::Position& tip,
     const std::size_t limit) const noexcept(false) -> Positions
 {
-    auto lock = Lock{lock_};
-
-    return best_chain(lock, tip, limit);
+    return best_chain(*best_.Get(), tip, limit);
 }
 
 auto HeaderOracle::best_chain(
-    const Lock& lock,
+    const Chain& chain,
     const block::Position& tip,
     const std::size_t limit) const noexcept -> Positions
 {
-    const auto [youngest, best] = common_parent(lock, tip);
+    const auto [youngest, best] = common_parent(chain, tip);
     static const auto blank = block::Hash{};
     auto height = std::max<block::Height>(youngest.height_, 0);
     auto output = Positions{};
 
     // TODO allocator
-    for (auto& hash : best_hashes(lock, height, blank, 0, alloc::System())) {
+    for (auto& hash : best_hashes(chain, height, blank, 0, alloc::System())) {
         output.emplace_back(height++, std::move(hash));
 
         if ((0u < limit) && (output.size() == limit)) { break; }
@@ -358,17 +510,17 @@ auto HeaderOracle::best_chain(
 auto HeaderOracle::BestHash(const block::Height height) const noexcept
     -> block::Hash
 {
-    auto lock = Lock{lock_};
-
-    return best_hash(lock, height);
+    return best_hash(*best_.Get(), height);
 }
 
-auto HeaderOracle::best_hash(const Lock& lock, const block::Height height)
+auto HeaderOracle::best_hash(const Chain& chain, const block::Height height)
     const noexcept -> block::Hash
 {
-    try {
-        return database_.BestBlock(height);
-    } catch (...) {
+    if (const auto* hash = chain.Hash(height); nullptr != hash) {
+
+        return *hash;
+    } else {
+
         return blank_hash();
     }
 }
@@ -377,11 +529,11 @@ auto HeaderOracle::BestHash(
     const block::Height height,
     const block::Position& check) const noexcept -> block::Hash
 {
-    auto lock = Lock{lock_};
+    const auto chain = best_.Get();
 
-    if (is_in_best_chain(lock, check)) {
+    if (is_in_best_chain(*chain, check)) {
 
-        return database_.BestBlock(height);
+        return best_hash(*chain, height);
     } else {
 
         return blank_hash();
@@ -395,9 +547,7 @@ auto HeaderOracle::BestHashes(
 {
     static const auto blank = block::Hash{};
 
-    auto lock = Lock{lock_};
-
-    return best_hashes(lock, start, blank, limit, alloc);
+    return best_hashes(*best_.Get(), start, blank, limit, alloc);
 }
 
 auto HeaderOracle::BestHashes(
@@ -406,9 +556,7 @@ auto HeaderOracle::BestHashes(
     const std::size_t limit,
     alloc::Default alloc) const noexcept -> Hashes
 {
-    auto lock = Lock{lock_};
-
-    return best_hashes(lock, start, stop, limit, alloc);
+    return best_hashes(*best_.Get(), start, stop, limit, alloc);
 }
 
 auto HeaderOracle::BestHashes(
@@ -417,11 +565,11 @@ auto HeaderOracle::BestHashes(
     const std::size_t limit,
     alloc::Default alloc) const noexcept -> Hashes
 {
-    auto lock = Lock{lock_};
+    const auto chain = best_.Get();
     auto start = 0_uz;
 
     for (const auto& hash : previous) {
-        const auto [best, height] = is_in_best_chain(lock, hash);
+        const auto [best, height] = is_in_best_chain(*chain, hash);
 
         if (best) {
             start = height;
@@ -429,11 +577,11 @@ auto HeaderOracle::BestHashes(
         }
     }
 
-    return best_hashes(lock, start, stop, limit, alloc);
+    return best_hashes(*chain, start, stop, limit, alloc);
 }
 
 auto HeaderOracle::best_hashes(
-    const Lock& lock,
+    const Chain& chain,
     const block::Height start,
     const block::Hash& stop,
     const std::size_t limit,
@@ -442,7 +590,7 @@ auto HeaderOracle::best_hashes(
     auto output = Hashes{alloc};
     const auto limitIsZero = (0 == limit);
     auto current{start};
-    const auto tip = best_chain(lock);
+    const auto tip = chain.Tip();
     const auto last = [&] {
         if (limitIsZero) {
 
@@ -456,15 +604,17 @@ auto HeaderOracle::best_hashes(
         }
     }();
 
+    if (current <= last) {
+        output.reserve(static_cast<std::size_t>(last - current + 1));
+    }
+
     while (current <= last) {
-        auto hash = database_.BestBlock(current++);
+        const auto* hash = chain.Hash(current++);
 
-        // TODO this check shouldn't be necessary but BestBlock doesn't
-        // throw the exception documented in its declaration.
-        if (hash.IsNull()) { break; }
+        if (nullptr == hash) { break; }
 
-        const auto stopHere = stop.IsNull() ? false : (stop == hash);
-        output.emplace_back(std::move(hash));
+        const auto stopHere = stop.IsNull() ? false : (stop == *hash);
+        output.emplace_back(*hash);
 
         if (stopHere) { break; }
     }
@@ -491,17 +641,16 @@ auto HeaderOracle::blank_position() const noexcept -> const block::Position&
 auto HeaderOracle::CalculateReorg(const block::Position& tip) const
     noexcept(false) -> Positions
 {
-    auto lock = Lock{lock_};
-
-    return calculate_reorg(lock, tip);
+    return calculate_reorg(*best_.Get(), tip);
 }
 
-auto HeaderOracle::calculate_reorg(const Lock& lock, const block::Position& tip)
-    const noexcept(false) -> Positions
+auto HeaderOracle::calculate_reorg(
+    const Chain& chain,
+    const block::Position& tip) const noexcept(false) -> Positions
 {
     auto output = Positions{};
 
-    if (is_in_best_chain(lock, tip)) { return output; }
+    if (is_in_best_chain(chain, tip)) { return output; }
 
     output.emplace_back(tip);
 
@@ -512,7 +661,7 @@ auto HeaderOracle::calculate_reorg(const Lock& lock, const block::Position& tip)
         }
 
         const auto& child = *output.crbegin();
-        const auto pHeader = database_.TryLoadHeader(child.hash_);
+        const auto pHeader = cache_.TryLoadHeader(child.hash_);
 
         if (false == bool(pHeader)) {
             throw std::runtime_error("Failed to load block header");
@@ -526,7 +675,7 @@ auto HeaderOracle::calculate_reorg(const Lock& lock, const block::Position& tip)
 
         auto parent = block::Position{height - 1, header.ParentHash()};
 
-        if (is_in_best_chain(lock, parent)) { break; }
+        if (is_in_best_chain(chain, parent)) { break; }
 
         output.emplace_back(std::move(parent));
     }
@@ -619,19 +768,17 @@ auto HeaderOracle::choose_candidate(
 auto HeaderOracle::CommonParent(const block::Position& position) const noexcept
     -> std::pair<block::Position, block::Position>
 {
-    auto lock = Lock{lock_};
-
-    return common_parent(lock, position);
+    return common_parent(*best_.Get(), position);
 }
 
 auto HeaderOracle::common_parent(
-    const Lock& lock,
+    const Chain& chain,
     const block::Position& position) const noexcept
     -> std::pair<block::Position, block::Position>
 {
-    const auto& database = database_;
+    const auto& database = cache_;
     std::pair<block::Position, block::Position> output{
-        {0, GenesisBlockHash(chain_)}, best_chain(lock)};
+        {0, GenesisBlockHash(chain_)}, chain.Tip()};
     auto& [parent, best] = output;
     auto test{position};
     auto pHeader = database.TryLoadHeader(test.hash_);
@@ -639,7 +786,7 @@ auto HeaderOracle::common_parent(
     if (false == bool(pHeader)) { return output; }
 
     while (0 < test.height_) {
-        if (is_in_best_chain(lock, test.hash_).first) {
+        if (is_in_best_chain(chain, test.hash_).first) {
             parent = test;
 
             return output;
@@ -711,7 +858,7 @@ auto HeaderOracle::connect_to_parent(
 auto HeaderOracle::DeleteCheckpoint() noexcept -> bool
 {
     auto lock = Lock{lock_};
-    auto update = UpdateTransaction{api_, database_};
+    auto update = UpdateTransaction{api_, cache_};
 
     if (false == update.EffectiveCheckpoint()) {
         LogError()(OT_PRETTY_CLASS())("No checkpoint").Flush();
@@ -724,7 +871,7 @@ auto HeaderOracle::DeleteCheckpoint() noexcept -> bool
 
     if (apply_checkpoint(lock, position, update)) {
 
-        return database_.ApplyUpdate(update);
+        return apply_update(lock, update);
     } else {
 
         return false;
@@ -780,15 +927,13 @@ auto HeaderOracle::GetCheckpoint() const noexcept -> block::Position
 auto HeaderOracle::GetPosition(const block::Height height) const noexcept
     -> block::Position
 {
-    auto lock = Lock{lock_};
-
-    return get_position(lock, height);
+    return get_position(*best_.Get(), height);
 }
 
-auto HeaderOracle::get_position(const Lock& lock, const block::Height height)
+auto HeaderOracle::get_position(const Chain& chain, const block::Height height)
     const noexcept -> block::Position
 {
-    auto hash = best_hash(lock, height);
+    auto hash = best_hash(chain, height);
 
     if (hash == blank_hash()) {
 
@@ -879,17 +1024,13 @@ auto HeaderOracle::initialize_candidate(
 
 auto HeaderOracle::IsInBestChain(const block::Hash& hash) const noexcept -> bool
 {
-    auto lock = Lock{lock_};
-
-    return is_in_best_chain(lock, hash).first;
+    return is_in_best_chain(*best_.Get(), hash).first;
 }
 
 auto HeaderOracle::IsInBestChain(const block::Position& position) const noexcept
     -> bool
 {
-    auto lock = Lock{lock_};
-
-    return is_in_best_chain(lock, position.height_, position.hash_);
+    return is_in_best_chain(*best_.Get(), position.height_, position.hash_);
 }
 
 auto HeaderOracle::is_disconnected(
@@ -912,37 +1053,33 @@ auto HeaderOracle::is_disconnected(
     }
 }
 
-auto HeaderOracle::is_in_best_chain(const Lock& lock, const block::Hash& hash)
+auto HeaderOracle::is_in_best_chain(const Chain& chain, const block::Hash& hash)
     const noexcept -> std::pair<bool, block::Height>
 {
-    const auto pHeader = database_.TryLoadHeader(hash);
+    const auto pHeader = cache_.TryLoadHeader(hash);
 
     if (false == bool(pHeader)) { return {false, -1}; }
 
     const auto& header = *pHeader;
 
-    return {is_in_best_chain(lock, header.Height(), hash), header.Height()};
+    return {is_in_best_chain(chain, header.Height(), hash), header.Height()};
 }
 
 auto HeaderOracle::is_in_best_chain(
-    const Lock& lock,
+    const Chain& chain,
     const block::Position& position) const noexcept -> bool
 {
-    return is_in_best_chain(lock, position.height_, position.hash_);
+    return is_in_best_chain(chain, position.height_, position.hash_);
 }
 
 auto HeaderOracle::is_in_best_chain(
-    const Lock& lock,
+    const Chain& chain,
     const block::Height height,
     const block::Hash& hash) const noexcept -> bool
 {
-    try {
-        return hash == database_.BestBlock(height);
-
-    } catch (...) {
+    const auto* best = chain.Hash(height);
 
-        return false;
-    }
+    return (nullptr != best) && (hash == *best);
 }
 
 auto HeaderOracle::LoadBitcoinHeader(const block::Hash& hash) const noexcept
@@ -954,7 +1091,7 @@ auto HeaderOracle::LoadBitcoinHeader(const block::Hash& hash) const noexcept
 auto HeaderOracle::LoadHeader(const block::Hash& hash) const noexcept
     -> std::unique_ptr<block::Header>
 {
-    return database_.TryLoadHeader(hash);
+    return cache_.TryLoadHeader(hash);
 }
 
 auto HeaderOracle::ProcessSyncData(
@@ -963,7 +1100,8 @@ auto HeaderOracle::ProcessSyncData(
     const network::p2p::Data& data) noexcept -> std::size_t
 {
     auto output = 0_uz;
-    auto update = UpdateTransaction{api_, database_};
+    auto lock = Lock{lock_};
+    auto update = UpdateTransaction{api_, cache_};
 
     try {
         const auto& blocks = data.Blocks();
@@ -972,7 +1110,6 @@ auto HeaderOracle::ProcessSyncData(
             std::runtime_error{"No blocks in sync data"};
         }
 
-        auto lock = Lock{lock_};
         auto previous = [&]() -> block::Hash {
             const auto& first = blocks.front();
             const auto height = first.Height();
@@ -981,7 +1118,8 @@ auto HeaderOracle::ProcessSyncData(
 
                 return block::Hash{};
             } else {
-                const auto rc = prior.Assign(database_.BestBlock(height - 1));
+                const auto rc =
+                    prior.Assign(best_hash(*best_.Get(), height - 1));
 
                 OT_ASSERT(rc);
 
@@ -1005,7 +1143,7 @@ auto HeaderOracle::ProcessSyncData(
 
             auto hash = block::Hash{header.Hash()};
 
-            if (false == is_in_best_chain(lock, hash).first) {
+            if (false == is_in_best_chain(*best_.Get(), hash).first) {
                 if (false == add_header(lock, update, std::move(pHeader))) {
                     throw std::runtime_error{"Failed to process header"};
                 }
@@ -1019,7 +1157,7 @@ auto HeaderOracle::ProcessSyncData(
         LogVerbose()(OT_PRETTY_CLASS())(e.what()).Flush();
     }
 
-    if ((0u < output) && database_.ApplyUpdate(update)) {
+    if ((0u < output) && apply_update(lock, update)) {
         OT_ASSERT(output == hashes.size());
 
         return output;
@@ -1068,7 +1206,7 @@ auto HeaderOracle::Siblings() const noexcept -> UnallocatedSet<block::Hash>
 {
     auto lock = Lock{lock_};
 
-    return database_.SiblingHashes();
+    return cache_.SiblingHashes();
 }
 
 auto HeaderOracle::SubmitBlock(const ReadView in) noexcept -> void
@@ -10,9 +10,11 @@
 #include <iosfwd>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <tuple>
 #include <utility>
 
+#include "blockchain/node/HeaderCache.hpp"
 #include "internal/blockchain/node/HeaderOracle.hpp"
 #include "internal/util/Mutex.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
@@ -115,7 +117,7 @@ public:
     auto CalculateReorg(const Lock& lock, const block::Position& tip) const
         noexcept(false) -> Positions final
     {
-        return calculate_reorg(lock, tip);
+        return calculate_reorg(*best_.Get(), tip);
     }
     auto CommonParent(const block::Position& position) const noexcept
         -> std::pair<block::Position, block::Position> final;
@@ -127,7 +129,7 @@ public:
     auto GetPosition(const Lock& lock, const block::Height height)
         const noexcept -> block::Position final
     {
-        return get_position(lock, height);
+        return get_position(*best_.Get(), height);
     }
     auto Internal() const noexcept -> const internal::HeaderOracle& final
     {
@@ -177,44 +179,90 @@ private:
         UnallocatedDeque<block::Position> chain_{};
     };
 
+    // NOTE in-memory copy of the best chain hashes indexed by height. Readers
+    // obtain an immutable snapshot without taking lock_. Hashes are stored in
+    // fixed size chunks shared between successive snapshots, so publishing a
+    // new tip only copies the chunk directory plus any chunks modified by a
+    // reorg. All modifications must be made while holding lock_.
+    class BestChainIndex
+    {
+    public:
+        static constexpr auto chunk_size_ = std::size_t{4096};
+
+        using Chunk = std::array<block::Hash, chunk_size_>;
+        using Chunks = UnallocatedVector<std::shared_ptr<Chunk>>;
+
+        struct Snapshot {
+            Chunks chunks_{};
+            std::size_t size_{};
+
+            auto Hash(const block::Height height) const noexcept
+                -> const block::Hash*;
+            auto Tip() const noexcept -> block::Position;
+        };
+
+        auto Get() const noexcept -> std::shared_ptr<const Snapshot>;
+        // NOTE returns nullopt if the update does not describe a contiguous
+        // best chain, in which case the index must be reloaded
+        auto Prepare(const UpdateTransaction& update) const noexcept
+            -> std::optional<Snapshot>;
+
+        auto Load(const database::Header& database) noexcept -> void;
+        auto Publish(Snapshot&& next) noexcept -> void;
+
+        BestChainIndex() noexcept;
+
+    private:
+        std::shared_ptr<const Snapshot> current_;
+        std::size_t high_water_;
+
+        auto set(
+            Snapshot& next,
+            UnallocatedSet<std::size_t>& copied,
+            const block::Height height,
+            const block::Hash& hash) const noexcept -> void;
+    };
+
     using Candidates = UnallocatedVector<Candidate>;
+    using Chain = BestChainIndex::Snapshot;
 
     const api::Session& api_;
     database::Header& database_;
     const blockchain::Type chain_;
     mutable std::mutex lock_;
+    BestChainIndex best_;
+    HeaderCache cache_;
 
     static auto evaluate_candidate(
         const block::Header& current,
         const block::Header& candidate) noexcept -> bool;
 
-    auto best_chain(const Lock& lock) const noexcept -> block::Position;
     auto best_chain(
-        const Lock& lock,
+        const Chain& chain,
         const block::Position& tip,
         const std::size_t limit) const noexcept -> Positions;
-    auto best_hash(const Lock& lock, const block::Height height) const noexcept
-        -> block::Hash;
+    auto best_hash(const Chain& chain, const block::Height height)
+        const noexcept -> block::Hash;
     auto best_hashes(
-        const Lock& lock,
+        const Chain& chain,
         const block::Height start,
         const block::Hash& stop,
         const std::size_t limit,
         alloc::Default alloc) const noexcept -> Hashes;
     auto blank_hash() const noexcept -> const block::Hash&;
     auto blank_position() const noexcept -> const block::Position&;
-    auto calculate_reorg(const Lock& lock, const block::Position& tip) const
+    auto calculate_reorg(const Chain& chain, const block::Position& tip) const
         noexcept(false) -> Positions;
-    auto common_parent(const Lock& lock, const block::Position& position)
+    auto common_parent(const Chain& chain, const block::Position& position)
         const noexcept -> std::pair<block::Position, block::Position>;
-    auto get_position(const Lock& lock, const block::Height height)
+    auto get_position(const Chain& chain, const block::Height height)
         const noexcept -> block::Position;
-    auto is_in_best_chain(const Lock& lock, const block::Hash& hash)
+    auto is_in_best_chain(const Chain& chain, const block::Hash& hash)
         const noexcept -> std::pair<bool, block::Height>;
-    auto is_in_best_chain(const Lock& lock, const block::Position& position)
+    auto is_in_best_chain(const Chain& chain, const block::Position& position)
         const noexcept -> bool;
     auto is_in_best_chain(
-        const Lock& lock,
+        const Chain& chain,
         const block::Height height,
         const block::Hash& hash) const noexcept -> bool;
 
@@ -222,6 +270,8 @@ private:
         const Lock& lock,
         UpdateTransaction& update,
         std::unique_ptr<block::Header> header) noexcept -> bool;
+    auto apply_update(const Lock& lock, UpdateTransaction& update) noexcept
+        -> bool;
     auto apply_checkpoint(
         const Lock& lock,
         const block::Height height,
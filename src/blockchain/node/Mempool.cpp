@@ -8,19 +8,34 @@
 #include "blockchain/node/Mempool.hpp"  // IWYU pragma: associated
 
 #include <robin_hood.h>
+#include <algorithm>
 #include <chrono>
+#include <iterator>
 #include <queue>
 #include <shared_mutex>
 #include <string_view>
 #include <utility>
 
+#include "blockchain/node/MempoolPolicy.hpp"
+#include "internal/blockchain/bitcoin/block/Input.hpp"
+#include "internal/blockchain/bitcoin/block/Output.hpp"
+#include "internal/blockchain/bitcoin/block/Transaction.hpp"
 #include "internal/blockchain/database/Wallet.hpp"
+#include "internal/core/Amount.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/Mutex.hpp"
+#include "internal/util/P0330.hpp"
 #include "opentxs/api/crypto/Blockchain.hpp"
+#include "opentxs/blockchain/bitcoin/block/Input.hpp"
+#include "opentxs/blockchain/bitcoin/block/Inputs.hpp"
+#include "opentxs/blockchain/bitcoin/block/Output.hpp"
+#include "opentxs/blockchain/bitcoin/block/Outputs.hpp"
 #include "opentxs/blockchain/bitcoin/block/Transaction.hpp"
+#include "opentxs/blockchain/block/Outpoint.hpp"
 #include "opentxs/blockchain/block/Types.hpp"
+#include "opentxs/core/Amount.hpp"
 #include "opentxs/core/ByteArray.hpp"
+#include "opentxs/core/FixedByteArray.hpp"
 #include "opentxs/network/zeromq/message/Message.hpp"
 #include "opentxs/network/zeromq/message/Message.tpp"
 #include "opentxs/network/zeromq/socket/Publish.hpp"
@@ -37,22 +52,65 @@ struct Mempool::Imp {
 
     auto Dump() const noexcept -> UnallocatedSet<UnallocatedCString>
     {
+        auto output = UnallocatedSet<UnallocatedCString>{};
         auto lock = sLock{lock_};
 
-        return active_;
+        for (const auto& [txid, entry] : transactions_) {
+            if (entry.tx_) { output.emplace(txid.Bytes()); }
+        }
+
+        return output;
+    }
+    auto EstimateFeeRate() const noexcept -> std::optional<std::uint64_t>
+    {
+        auto lock = sLock{lock_};
+
+        return policy_.EstimateFeeRate();
+    }
+    auto FeeRate(ReadView txid) const noexcept -> std::optional<std::uint64_t>
+    {
+        auto lock = sLock{lock_};
+
+        if (auto i = transactions_.find(Txid{txid}); transactions_.end() != i) {
+
+            return i->second.fee_rate_;
+        }
+
+        return std::nullopt;
+    }
+    auto Match(const ShortID& id, const ShortIDs& ids) const noexcept
+        -> Matches
+    {
+        auto output = Matches{};
+        auto lock = sLock{lock_};
+
+        for (const auto& [txid, entry] : transactions_) {
+            if (false == bool(entry.tx_)) { continue; }
+
+            if (auto i = ids.find(id(*entry.tx_)); ids.end() != i) {
+                output.emplace_back(i->second, entry.tx_);
+            }
+        }
+
+        return output;
+    }
+    auto MinimumFeeRate() const noexcept -> std::uint64_t
+    {
+        auto lock = sLock{lock_};
+
+        return policy_.MinimumFeeRate();
     }
     auto Query(ReadView txid) const noexcept
         -> std::shared_ptr<const bitcoin::block::Transaction>
     {
         auto lock = sLock{lock_};
 
-        try {
-
-            return transactions_.at(Hash{txid});
-        } catch (...) {
+        if (auto i = transactions_.find(Txid{txid}); transactions_.end() != i) {
 
-            return {};
+            return i->second.tx_;
         }
+
+        return {};
     }
     auto Submit(ReadView txid) const noexcept -> bool
     {
@@ -69,11 +127,10 @@ struct Mempool::Imp {
         auto lock = eLock{lock_};
 
         for (const auto& txid : txids) {
-            const auto [it, added] =
-                transactions_.try_emplace(Hash{txid}, nullptr);
+            const auto [it, added] = transactions_.try_emplace(Txid{txid});
 
             if (added) {
-                unexpired_txid_.emplace(Clock::now(), txid);
+                unexpired_txid_.emplace(Clock::now(), it->first);
                 output.emplace_back(true);
             } else {
                 output.emplace_back(false);
@@ -84,41 +141,62 @@ struct Mempool::Imp {
 
         return output;
     }
-    auto Submit(std::unique_ptr<const bitcoin::block::Transaction> tx)
-        const noexcept -> void
+    auto Submit(
+        std::unique_ptr<const bitcoin::block::Transaction> tx,
+        const bool local) const noexcept -> void
     {
-        Submit([&] {
-            auto out = Transactions{};
-            out.emplace_back(std::move(tx));
-
-            return out;
-        }());
+        Submit(
+            [&] {
+                auto out = Transactions{};
+                out.emplace_back(std::move(tx));
+
+                return out;
+            }(),
+            local);
     }
-    auto Submit(Transactions&& txns) const noexcept -> void
+    auto Submit(Transactions&& txns, const bool local) const noexcept -> void
     {
         const auto now = Clock::now();
+        const auto rates = fee_rates(txns);
         auto lock = eLock{lock_};
+        auto rate = rates.begin();
 
         for (auto& tx : txns) {
+            const auto& feeRate = *(rate++);
+
             if (!tx) {
                 LogError()(OT_PRETTY_CLASS())("invalid transaction").Flush();
 
                 continue;
             }
 
-            auto txid = Hash{tx->ID().Bytes()};
-            const auto [it, added] = transactions_.try_emplace(txid, nullptr);
+            auto txid = Txid{tx->ID().Bytes()};
+            const auto [it, added] = transactions_.try_emplace(txid);
 
             if (added) { unexpired_txid_.emplace(now, txid); }
 
-            auto& existing = it->second;
+            auto& entry = it->second;
+
+            if (entry.tx_) { continue; }
+
+            const auto evicted = policy_.Add(
+                txid,
+                tx->Internal().CalculateSize(),
+                tx->vBytes(chain_),
+                feeRate,
+                local);
 
-            if (!existing) {
-                existing = std::move(tx);
-                notify(txid);
-                active_.emplace(txid);
-                unexpired_tx_.emplace(now, std::move(txid));
+            if (false == evicted.has_value()) { continue; }
+
+            for (const auto& id : *evicted) {
+                transactions_.at(id).tx_.reset();
             }
+
+            entry.fee_rate_ = feeRate;
+            entry.tx_ = std::move(tx);
+
+            notify(txid.Bytes());
+            unexpired_tx_.emplace(now, std::move(txid));
         }
     }
 
@@ -132,12 +210,10 @@ struct Mempool::Imp {
 
             if ((now - time) < tx_limit_) { break; }
 
-            try {
-                transactions_.at(txid).reset();
-            } catch (...) {
+            if (auto i = transactions_.find(txid); transactions_.end() != i) {
+                remove(i->first, i->second);
             }
 
-            active_.erase(txid);
             unexpired_tx_.pop();
         }
 
@@ -146,22 +222,30 @@ struct Mempool::Imp {
 
             if ((now - time) < txid_limit_) { break; }
 
-            transactions_.erase(txid);
-            active_.erase(txid);
+            if (auto i = transactions_.find(txid); transactions_.end() != i) {
+                remove(i->first, i->second);
+                transactions_.erase(i);
+            }
+
             unexpired_txid_.pop();
         }
+
+        // NOTE the minimum fee rate decays once the pool is no longer under
+        // pressure so a temporary spike does not block relay indefinitely
+        policy_.Decay();
     }
 
     Imp(const api::crypto::Blockchain& crypto,
         database::Wallet& wallet,
         const network::zeromq::socket::Publish& socket,
-        const Type chain) noexcept
+        const Type chain,
+        const std::size_t maxBytes) noexcept
         : crypto_(crypto)
         , wallet_(wallet)
         , chain_(chain)
         , lock_()
         , transactions_()
-        , active_()
+        , policy_(maxBytes)
         , unexpired_txid_()
         , unexpired_tx_()
         , socket_(socket)
@@ -170,11 +254,26 @@ struct Mempool::Imp {
     }
 
 private:
-    using Hash = UnallocatedCString;
-    using TransactionMap = robin_hood::unordered_flat_map<
-        Hash,
-        std::shared_ptr<const bitcoin::block::Transaction>>;
-    using Data = std::pair<Time, Hash>;
+    using Txid = MempoolPolicy::Txid;
+
+    struct Entry {
+        // NOTE null if the transaction was announced but not yet received, or
+        // if it was evicted or expired
+        std::shared_ptr<const bitcoin::block::Transaction> tx_{};
+        std::optional<std::uint64_t> fee_rate_{};
+    };
+
+    // NOTE the transactions whose outputs are spent by a batch which is being
+    // submitted, plus ownership of any which were copied from the mempool or
+    // loaded from the wallet
+    struct Parents {
+        UnallocatedMap<Txid, const bitcoin::block::Transaction*> index_{};
+        UnallocatedVector<std::shared_ptr<const bitcoin::block::Transaction>>
+            pinned_{};
+    };
+    using Rates = UnallocatedVector<std::optional<std::uint64_t>>;
+    using TransactionMap = robin_hood::unordered_node_map<Txid, Entry>;
+    using Data = std::pair<Time, Txid>;
     using Cache = std::queue<Data>;
 
     static constexpr auto tx_limit_ = std::chrono::hours{2};
@@ -185,11 +284,108 @@ private:
     const Type chain_;
     mutable std::shared_mutex lock_;
     mutable TransactionMap transactions_;
-    mutable UnallocatedSet<Hash> active_;
+    mutable MempoolPolicy policy_;
     mutable Cache unexpired_txid_;
     mutable Cache unexpired_tx_;
     const network::zeromq::socket::Publish& socket_;
 
+    auto fee_rate(const bitcoin::block::Transaction& tx, Parents& parents)
+        const noexcept -> std::optional<std::uint64_t>
+    {
+        try {
+            auto in = Amount{0};
+
+            for (const auto& input : tx.Inputs()) {
+                const auto& outpoint = input.PreviousOutput();
+
+                try {
+                    in += input.Internal().Spends().Value();
+
+                    continue;
+                } catch (...) {
+                }
+
+                const auto parentID = Txid{outpoint.Txid()};
+                auto& parent = parents.index_[parentID];
+
+                if (nullptr == parent) {
+                    // NOTE relayed transactions do not carry their spent
+                    // outputs so fall back to the transactions known to the
+                    // wallet
+                    auto loaded =
+                        crypto_.LoadTransactionBitcoin(parentID.asHex());
+
+                    if (false == bool(loaded)) { return std::nullopt; }
+
+                    parent = loaded.get();
+                    parents.pinned_.emplace_back(std::move(loaded));
+                }
+
+                in += parent->Outputs().at(outpoint.Index()).Value();
+            }
+
+            auto out = Amount{0};
+
+            for (const auto& output : tx.Outputs()) { out += output.Value(); }
+
+            const auto vbytes = tx.vBytes(chain_);
+
+            if ((out > in) || (0_uz == vbytes)) { return std::nullopt; }
+
+            const auto rate = ((in - out) * 1000u) / vbytes;
+
+            return rate.Internal().ExtractUInt64();
+        } catch (...) {
+
+            return std::nullopt;
+        }
+    }
+    // NOTE fee rates are calculated before the exclusive lock is acquired
+    // since a spent output which is not found in the mempool or in the
+    // submitted batch requires a database read
+    auto fee_rates(const Transactions& txns) const noexcept -> Rates
+    {
+        auto parents = Parents{};
+        auto& index = parents.index_;
+
+        for (const auto& tx : txns) {
+            if (tx) { index.try_emplace(Txid{tx->ID().Bytes()}, tx.get()); }
+        }
+
+        {
+            auto lock = sLock{lock_};
+
+            for (const auto& tx : txns) {
+                if (false == bool(tx)) { continue; }
+
+                for (const auto& input : tx->Inputs()) {
+                    const auto parentID = Txid{input.PreviousOutput().Txid()};
+
+                    if (index.end() != index.find(parentID)) { continue; }
+
+                    const auto i = transactions_.find(parentID);
+
+                    if ((transactions_.end() != i) && i->second.tx_) {
+                        index.try_emplace(parentID, i->second.tx_.get());
+                        parents.pinned_.emplace_back(i->second.tx_);
+                    }
+                }
+            }
+        }
+
+        auto out = Rates{};
+        out.reserve(txns.size());
+
+        for (const auto& tx : txns) {
+            if (tx) {
+                out.emplace_back(fee_rate(*tx, parents));
+            } else {
+                out.emplace_back(std::nullopt);
+            }
+        }
+
+        return out;
+    }
     auto notify(ReadView txid) const noexcept -> void
     {
         socket_.Send([&] {
@@ -201,6 +397,13 @@ private:
             return work;
         }());
     }
+    auto remove(const Txid& txid, Entry& entry) const noexcept -> void
+    {
+        if (false == bool(entry.tx_)) { return; }
+
+        policy_.Remove(txid);
+        entry.tx_.reset();
+    }
 
     auto init() noexcept -> void
     {
@@ -220,7 +423,7 @@ private:
             }
         }
 
-        Submit(std::move(transactions));
+        Submit(std::move(transactions), true);
     }
 };
 
@@ -228,8 +431,9 @@ Mempool::Mempool(
     const api::crypto::Blockchain& crypto,
     database::Wallet& wallet,
     const network::zeromq::socket::Publish& socket,
-    const Type chain) noexcept
-    : imp_(std::make_unique<Imp>(crypto, wallet, socket, chain))
+    const Type chain,
+    const std::size_t maxBytes) noexcept
+    : imp_(std::make_unique<Imp>(crypto, wallet, socket, chain, maxBytes))
 {
 }
 
@@ -238,8 +442,30 @@ auto Mempool::Dump() const noexcept -> UnallocatedSet<UnallocatedCString>
     return imp_->Dump();
 }
 
+auto Mempool::EstimateFeeRate() const noexcept -> std::optional<std::uint64_t>
+{
+    return imp_->EstimateFeeRate();
+}
+
+auto Mempool::FeeRate(ReadView txid) const noexcept
+    -> std::optional<std::uint64_t>
+{
+    return imp_->FeeRate(txid);
+}
+
 auto Mempool::Heartbeat() noexcept -> void { imp_->Heartbeat(); }
 
+auto Mempool::Match(const ShortID& id, const ShortIDs& ids) const noexcept
+    -> Matches
+{
+    return imp_->Match(id, ids);
+}
+
+auto Mempool::MinimumFeeRate() const noexcept -> std::uint64_t
+{
+    return imp_->MinimumFeeRate();
+}
+
 auto Mempool::Query(ReadView txid) const noexcept
     -> std::shared_ptr<const bitcoin::block::Transaction>
 {
@@ -257,10 +483,11 @@ auto Mempool::Submit(const UnallocatedVector<ReadView>& txids) const noexcept
     return imp_->Submit(txids);
 }
 
-auto Mempool::Submit(std::unique_ptr<const bitcoin::block::Transaction> tx)
-    const noexcept -> void
+auto Mempool::Submit(
+    std::unique_ptr<const bitcoin::block::Transaction> tx,
+    const bool local) const noexcept -> void
 {
-    imp_->Submit(std::move(tx));
+    imp_->Submit(std::move(tx), local);
 }
 
 Mempool::~Mempool() = default;
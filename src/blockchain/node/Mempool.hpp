@@ -7,7 +7,10 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <optional>
 
 #include "internal/blockchain/node/Mempool.hpp"
 #include "opentxs/blockchain/Types.hpp"
@@ -68,13 +71,21 @@ class Mempool final : public internal::Mempool
 {
 public:
     auto Dump() const noexcept -> UnallocatedSet<UnallocatedCString> final;
+    auto EstimateFeeRate() const noexcept
+        -> std::optional<std::uint64_t> final;
+    auto FeeRate(ReadView txid) const noexcept
+        -> std::optional<std::uint64_t> final;
+    auto Match(const ShortID& id, const ShortIDs& ids) const noexcept
+        -> Matches final;
+    auto MinimumFeeRate() const noexcept -> std::uint64_t final;
     auto Query(ReadView txid) const noexcept
         -> std::shared_ptr<const bitcoin::block::Transaction> final;
     auto Submit(ReadView txid) const noexcept -> bool final;
     auto Submit(const UnallocatedVector<ReadView>& txids) const noexcept
         -> UnallocatedVector<bool> final;
-    auto Submit(std::unique_ptr<const bitcoin::block::Transaction> tx)
-        const noexcept -> void final;
+    auto Submit(
+        std::unique_ptr<const bitcoin::block::Transaction> tx,
+        const bool local) const noexcept -> void final;
 
     auto Heartbeat() noexcept -> void final;
 
@@ -82,7 +93,8 @@ public:
         const api::crypto::Blockchain& crypto,
         database::Wallet& db,
         const network::zeromq::socket::Publish& socket,
-        const Type chain) noexcept;
+        const Type chain,
+        const std::size_t maxBytes) noexcept;
     Mempool() = delete;
     Mempool(const Mempool&) = delete;
     Mempool(Mempool&&) = delete;
@@ -0,0 +1,176 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                       // IWYU pragma: associated
+#include "1_Internal.hpp"                     // IWYU pragma: associated
+#include "blockchain/node/MempoolPolicy.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+
+#include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
+#include "opentxs/util/Log.hpp"
+
+namespace opentxs::blockchain::node
+{
+MempoolPolicy::MempoolPolicy(const std::size_t maxBytes) noexcept
+    : max_bytes_(maxBytes)
+    , entries_()
+    , by_fee_()
+    , by_age_()
+    , bytes_(0)
+    , min_fee_rate_(0)
+    , sequence_(0)
+{
+}
+
+auto MempoolPolicy::Add(
+    const Txid& txid,
+    const std::size_t bytes,
+    const std::size_t vbytes,
+    const std::optional<std::uint64_t> rate,
+    const bool local) noexcept -> std::optional<Evicted>
+{
+    if (0_uz < entries_.count(txid)) { return std::nullopt; }
+
+    if ((false == local) && rate.has_value() && (*rate < min_fee_rate_)) {
+
+        return std::nullopt;
+    }
+
+    auto evicted = find_room(bytes, rate, local);
+
+    if (false == evicted.has_value()) { return std::nullopt; }
+
+    for (const auto& id : *evicted) {
+        if (const auto& entry = entries_.at(id); entry.fee_rate_.has_value()) {
+            LogTrace()(OT_PRETTY_CLASS())("evicting transaction ")
+                .asHex(id)(" with fee rate ")(*entry.fee_rate_)
+                .Flush();
+            min_fee_rate_ = std::max(min_fee_rate_, *entry.fee_rate_);
+        } else {
+            LogTrace()(OT_PRETTY_CLASS())("evicting transaction ")
+                .asHex(id)(" with unknown fee rate")
+                .Flush();
+        }
+
+        Remove(id);
+    }
+
+    const auto sequence = ++sequence_;
+    entries_.try_emplace(txid, Entry{bytes, vbytes, rate, local, sequence});
+    bytes_ += bytes;
+
+    if (false == local) {
+        if (rate.has_value()) {
+            by_fee_.emplace(*rate, txid);
+        } else {
+            by_age_.emplace(sequence, txid);
+        }
+    }
+
+    return evicted;
+}
+
+auto MempoolPolicy::BelowFeeFilter(
+    const std::optional<std::uint64_t> rate,
+    const std::uint64_t filter) noexcept -> bool
+{
+    return rate.has_value() && (*rate < filter);
+}
+
+auto MempoolPolicy::Decay() noexcept -> void
+{
+    if ((bytes_ < (max_bytes_ / 2u)) && (0u < min_fee_rate_)) {
+        min_fee_rate_ /= 2u;
+    }
+}
+
+auto MempoolPolicy::EstimateFeeRate() const noexcept
+    -> std::optional<std::uint64_t>
+{
+    auto samples = 0_uz;
+    auto vbytes = 0_uz;
+    auto output = std::optional<std::uint64_t>{};
+
+    for (auto i = by_fee_.crbegin(); i != by_fee_.crend(); ++i) {
+        const auto& [rate, txid] = *i;
+        ++samples;
+        vbytes += entries_.at(txid).vbytes_;
+        output = rate;
+
+        if (vbytes >= estimate_block_vbytes_) { break; }
+    }
+
+    if (samples < estimate_min_samples_) { return std::nullopt; }
+
+    return output;
+}
+
+auto MempoolPolicy::find_room(
+    const std::size_t bytes,
+    const std::optional<std::uint64_t> rate,
+    const bool local) const noexcept -> std::optional<Evicted>
+{
+    auto output = Evicted{};
+    auto available = (max_bytes_ > bytes_) ? (max_bytes_ - bytes_) : 0_uz;
+    const auto full = [&] { return available < bytes; };
+    const auto evict = [&](const auto& txid) {
+        available += entries_.at(txid).bytes_;
+        output.emplace_back(txid);
+    };
+
+    if (local) {
+        for (auto i = by_fee_.cbegin(); full() && (i != by_fee_.cend()); ++i) {
+            evict(i->second);
+        }
+
+        for (auto i = by_age_.cbegin(); full() && (i != by_age_.cend()); ++i) {
+            evict(i->second);
+        }
+
+        // NOTE local transactions are admitted even if the pool remains full
+        return output;
+    } else if (rate.has_value()) {
+        for (auto i = by_fee_.cbegin(); full() && (i != by_fee_.cend()); ++i) {
+            if (i->first >= *rate) { break; }
+
+            evict(i->second);
+        }
+    } else {
+        for (auto i = by_age_.cbegin(); full() && (i != by_age_.cend()); ++i) {
+            evict(i->second);
+        }
+    }
+
+    if (full()) { return std::nullopt; }
+
+    return output;
+}
+
+auto MempoolPolicy::Remove(const Txid& txid) noexcept -> void
+{
+    auto i = entries_.find(txid);
+
+    if (entries_.end() == i) { return; }
+
+    const auto& entry = i->second;
+
+    if (false == entry.local_) {
+        if (entry.fee_rate_.has_value()) {
+            by_fee_.erase({*entry.fee_rate_, txid});
+        } else {
+            by_age_.erase({entry.sequence_, txid});
+        }
+    }
+
+    OT_ASSERT(bytes_ >= entry.bytes_);
+
+    bytes_ -= entry.bytes_;
+    entries_.erase(i);
+}
+
+MempoolPolicy::~MempoolPolicy() = default;
+}  // namespace opentxs::blockchain::node
@@ -0,0 +1,100 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <set>
+#include <utility>
+
+#include "opentxs/core/FixedByteArray.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::blockchain::node
+{
+// NOTE size accounting and eviction order for the mempool. All fee rates are
+// measured in satoshis per 1000 virtual bytes.
+//
+// Relayed transactions whose fee rate is known compete with each other by fee
+// rate. Relayed transactions whose fee rate is not known can not be ranked
+// against those, so they only displace each other, oldest first. Local
+// transactions are always admitted and are never evicted.
+//
+// Not thread safe, the owner must serialize access.
+class MempoolPolicy
+{
+public:
+    using Txid = FixedByteArray<32>;
+    using Evicted = UnallocatedVector<Txid>;
+
+    static constexpr auto estimate_block_vbytes_ = std::size_t{1000000};
+    static constexpr auto estimate_min_samples_ = std::size_t{100};
+
+    /// Transactions with an unknown fee rate are never filtered
+    static auto BelowFeeFilter(
+        const std::optional<std::uint64_t> rate,
+        const std::uint64_t filter) noexcept -> bool;
+
+    auto Bytes() const noexcept -> std::size_t { return bytes_; }
+    /// Returns a fee rate which would place a transaction in the next block,
+    /// or nothing if too few fees are known to make an estimate
+    auto EstimateFeeRate() const noexcept -> std::optional<std::uint64_t>;
+    auto MinimumFeeRate() const noexcept -> std::uint64_t
+    {
+        return min_fee_rate_;
+    }
+
+    /// Returns nothing if the transaction was rejected, otherwise the
+    /// transactions which were evicted to make room for it
+    auto Add(
+        const Txid& txid,
+        const std::size_t bytes,
+        const std::size_t vbytes,
+        const std::optional<std::uint64_t> rate,
+        const bool local) noexcept -> std::optional<Evicted>;
+    /// Lowers the minimum fee rate once the pool is no longer under pressure
+    auto Decay() noexcept -> void;
+    auto Remove(const Txid& txid) noexcept -> void;
+
+    MempoolPolicy(const std::size_t maxBytes) noexcept;
+    MempoolPolicy() = delete;
+    MempoolPolicy(const MempoolPolicy&) = delete;
+    MempoolPolicy(MempoolPolicy&&) = delete;
+    auto operator=(const MempoolPolicy&) -> MempoolPolicy& = delete;
+    auto operator=(MempoolPolicy&&) -> MempoolPolicy& = delete;
+
+    ~MempoolPolicy();
+
+private:
+    struct Entry {
+        std::size_t bytes_{};
+        std::size_t vbytes_{};
+        std::optional<std::uint64_t> fee_rate_{};
+        bool local_{};
+        std::uint64_t sequence_{};
+    };
+
+    using EntryMap = UnallocatedUnorderedMap<Txid, Entry>;
+    // NOTE lowest fee rate first
+    using FeeIndex = std::set<std::pair<std::uint64_t, Txid>>;
+    // NOTE oldest first
+    using AgeIndex = std::set<std::pair<std::uint64_t, Txid>>;
+
+    const std::size_t max_bytes_;
+    EntryMap entries_;
+    FeeIndex by_fee_;
+    AgeIndex by_age_;
+    std::size_t bytes_;
+    std::uint64_t min_fee_rate_;
+    std::uint64_t sequence_;
+
+    auto find_room(
+        const std::size_t bytes,
+        const std::optional<std::uint64_t> rate,
+        const bool local) const noexcept -> std::optional<Evicted>;
+};
+}  // namespace opentxs::blockchain::node
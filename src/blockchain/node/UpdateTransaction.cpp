@@ -11,7 +11,7 @@
 #include <tuple>
 #include <utility>
 
-#include "internal/blockchain/database/Header.hpp"
+#include "blockchain/node/HeaderCache.hpp"
 #include "internal/blockchain/node/Types.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "opentxs/blockchain/block/Hash.hpp"
@@ -24,7 +24,7 @@ namespace opentxs::blockchain::node
 {
 UpdateTransaction::UpdateTransaction(
     const api::Session& api,
-    const database::Header& db)
+    const HeaderCache& db)
     : api_(api)
     , db_(db)
     , have_reorg_(false)
@@ -156,11 +156,26 @@ auto UpdateTransaction::EffectiveHasDisconnectedChildren(
 }
 
 auto UpdateTransaction::EffectiveHeaderExists(
-    const block::Hash& hash) const noexcept -> bool
+    const block::Header& header) const noexcept -> bool
 {
+    const auto& hash = header.Hash();
+
     if (0 < headers_.count(hash)) { return true; }
 
-    return db_.HeaderExists(hash);
+    const auto& parent = header.ParentHash();
+
+    if (const auto i = headers_.find(parent); headers_.end() != i) {
+        const auto isNew = i->second.second;
+
+        // NOTE a header which did not exist before this update can only have
+        // children in the database if they were stored as disconnected
+        if (isNew && (false == EffectiveHasDisconnectedChildren(parent))) {
+
+            return false;
+        }
+    }
+
+    return db_.HeaderExists(hash, parent);
 }
 
 auto UpdateTransaction::Header(const block::Hash& hash) noexcept(false)
@@ -31,10 +31,10 @@ class Header;
 class Position;
 }  // namespace block
 
-namespace database
+namespace node
 {
-class Header;
-}  // namespace database
+class HeaderCache;
+}  // namespace node
 }  // namespace blockchain
 
 class Factory;
@@ -64,7 +64,8 @@ public:
     }
     auto EffectiveHasDisconnectedChildren(
         const block::Hash& hash) const noexcept -> bool;
-    auto EffectiveHeaderExists(const block::Hash& hash) const noexcept -> bool;
+    auto EffectiveHeaderExists(const block::Header& header) const noexcept
+        -> bool;
     auto EffectiveIsSibling(const block::Hash& hash) const noexcept -> bool
     {
         return 0 < siblings().count(hash);
@@ -106,13 +107,13 @@ public:
     // Stages an existing header for possible metadata update
     auto Stage(const block::Height& height) noexcept(false) -> block::Header&;
 
-    UpdateTransaction(const api::Session& api, const database::Header& db);
+    UpdateTransaction(const api::Session& api, const HeaderCache& db);
 
 private:
     friend opentxs::Factory;
 
     const api::Session& api_;
-    const database::Header& db_;
+    const HeaderCache& db_;
     bool have_reorg_;
     bool have_checkpoint_;
     block::Position reorg_from_;
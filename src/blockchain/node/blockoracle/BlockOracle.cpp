@@ -249,6 +249,11 @@ auto BlockOracle::Imp::LoadBitcoin(
     return output;
 }
 
+auto BlockOracle::Imp::Pin(const block::Hash& block) const noexcept -> void
+{
+    cache_.lock()->Pin(block);
+}
+
 auto BlockOracle::Imp::pipeline(const Work work, Message&& msg) noexcept -> void
 {
     switch (work) {
@@ -304,6 +309,11 @@ auto BlockOracle::Imp::SubmitBlock(const ReadView in) const noexcept -> void
     }());
 }
 
+auto BlockOracle::Imp::Unpin(const block::Hash& block) const noexcept -> void
+{
+    cache_.lock()->Unpin(block);
+}
+
 auto BlockOracle::Imp::work() noexcept -> bool
 {
     return cache_.lock()->StateMachine();
@@ -361,6 +371,11 @@ auto BlockOracle::LoadBitcoin(const Vector<block::Hash>& hashes) const noexcept
     return imp_->LoadBitcoin(hashes);
 }
 
+auto BlockOracle::Pin(const block::Hash& block) const noexcept -> void
+{
+    imp_->Pin(block);
+}
+
 auto BlockOracle::Shutdown() noexcept -> void { imp_->Shutdown(); }
 
 auto BlockOracle::SubmitBlock(const ReadView in) const noexcept -> void
@@ -373,6 +388,11 @@ auto BlockOracle::Tip() const noexcept -> block::Position
     return imp_->Tip();
 }
 
+auto BlockOracle::Unpin(const block::Hash& block) const noexcept -> void
+{
+    imp_->Unpin(block);
+}
+
 auto BlockOracle::Validate(const bitcoin::block::Block& block) const noexcept
     -> bool
 {
@@ -129,8 +129,10 @@ public:
         -> BitcoinBlockResult;
     auto LoadBitcoin(const Vector<block::Hash>& hashes) const noexcept
         -> BitcoinBlockResults;
+    auto Pin(const block::Hash& block) const noexcept -> void;
     auto SubmitBlock(const ReadView in) const noexcept -> void;
     auto Tip() const noexcept -> block::Position { return db_.BlockTip(); }
+    auto Unpin(const block::Hash& block) const noexcept -> void;
     auto Validate(const bitcoin::block::Block& block) const noexcept -> bool
     {
         return validator_->Validate(block);
@@ -43,11 +43,9 @@
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/WorkType.hpp"
-#include "util/ByteLiterals.hpp"
 
 namespace opentxs::blockchain::node::blockoracle
 {
-const std::size_t Cache::cache_limit_{8_mib};
 const std::chrono::seconds Cache::download_timeout_{60};
 
 Cache::Cache(
@@ -106,7 +104,7 @@ Cache::Cache(
     , batch_index_(alloc)
     , hash_index_(alloc)
     , hash_cache_(alloc)
-    , mem_(cache_limit_, alloc)
+    , mem_(config.BlockCacheLimit(), config.block_cache_, alloc)
     , running_(true)
 {
 }
@@ -188,6 +186,11 @@ auto Cache::GetBatch(allocator_type alloc) noexcept
     return out;
 }
 
+auto Cache::Pin(const block::Hash& block) noexcept -> void
+{
+    mem_.pin(block);
+}
+
 auto Cache::ProcessBlockRequests(network::zeromq::Message&& in) noexcept -> void
 {
     if (false == running_) { return; }
@@ -380,8 +383,9 @@ auto Cache::Request(const Vector<block::Hash>& hashes) noexcept
 
             auto promise = Promise{};
             promise.set_value(std::move(pBlock));
-            mem_.push(block::Hash{block}, promise.get_future());
-            output.emplace_back(mem_.find(block.Bytes()));
+            auto future = BitcoinBlockResult{promise.get_future()};
+            output.emplace_back(future);
+            mem_.push(block::Hash{block}, std::move(future));
             ready.emplace_back(&block);
             found = true;
         }
@@ -494,4 +498,9 @@ auto Cache::StateMachine() noexcept -> bool
 
     return 0 < pending_.size();
 }
+
+auto Cache::Unpin(const block::Hash& block) noexcept -> void
+{
+    mem_.unpin(block);
+}
 }  // namespace opentxs::blockchain::node::blockoracle
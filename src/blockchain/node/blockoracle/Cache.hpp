@@ -94,6 +94,7 @@ public:
     auto FinishBatch(const BatchID id) noexcept -> void;
     auto GetBatch(allocator_type alloc) noexcept
         -> std::pair<BatchID, Vector<block::Hash>>;
+    auto Pin(const block::Hash& block) noexcept -> void;
     auto ProcessBlockRequests(network::zeromq::Message&& in) noexcept -> void;
     auto ReceiveBlock(const network::zeromq::Frame& in) noexcept -> void;
     auto ReceiveBlock(const std::string_view in) noexcept -> void;
@@ -104,6 +105,7 @@ public:
         -> BitcoinBlockResults;
     auto Shutdown() noexcept -> void;
     auto StateMachine() noexcept -> bool;
+    auto Unpin(const block::Hash& block) noexcept -> void;
 
     Cache(
         const api::Session& api_,
@@ -124,7 +126,6 @@ private:
     using HashIndex = Map<block::Hash, BatchID>;
     using HashCache = Set<block::Hash>;
 
-    static const std::size_t cache_limit_;
     static const std::chrono::seconds download_timeout_;
 
     const api::Session& api_;
@@ -11,29 +11,54 @@
 #include <memory>
 
 #include "internal/blockchain/block/Block.hpp"
+#include "internal/blockchain/node/Config.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
 #include "opentxs/blockchain/bitcoin/block/Block.hpp"
 #include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Log.hpp"
 
 namespace opentxs::blockchain::node::blockoracle
 {
-MemDB::MemDB(const std::size_t limit, allocator_type alloc) noexcept
+MemDB::MemDB(
+    const std::size_t limit,
+    internal::BlockCacheMetrics& metrics,
+    allocator_type alloc) noexcept
     : limit_(limit)
+    , metrics_(metrics)
     , bytes_(0)
-    , queue_(alloc)
+    , lru_(alloc)
+    , pinned_(alloc)
     , index_(alloc)
+    , pins_(alloc)
 {
 }
 
 auto MemDB::clear() noexcept -> void
 {
     index_.clear();
-    queue_.clear();
+    lru_.clear();
+    pinned_.clear();
+    pins_.clear();
     bytes_ = 0;
+    update_metrics();
 }
 
-auto MemDB::find(const ReadView id) const noexcept -> BitcoinBlockResult
+auto MemDB::evict() noexcept -> void
+{
+    while ((bytes_ > limit_) && (false == lru_.empty())) {
+        const auto& item = lru_.back();
+        LogTrace()(OT_PRETTY_CLASS())("dropping least recently used block ")(
+            item.id_.asHex())(" from cache due to exceeding byte limit")
+            .Flush();
+        index_.erase(item.id_.Bytes());
+        bytes_ -= item.bytes_;
+        lru_.pop_back();
+        ++metrics_.evictions_;
+    }
+}
+
+auto MemDB::find(const ReadView id) noexcept -> BitcoinBlockResult
 {
     if (false == valid(id)) {
         LogError()(OT_PRETTY_CLASS())("invalid block id").Flush();
@@ -42,14 +67,43 @@ auto MemDB::find(const ReadView id) const noexcept -> BitcoinBlockResult
     }
 
     if (auto i = index_.find(id); index_.end() != i) {
+        auto& item = i->second;
 
-        return i->second->second;
+        if (item->pinned_) {
+            pinned_.splice(pinned_.begin(), pinned_, item);
+        } else {
+            lru_.splice(lru_.begin(), lru_, item);
+        }
+
+        ++metrics_.hits_;
+
+        return item->future_;
     } else {
+        ++metrics_.misses_;
 
         return {};
     }
 }
 
+auto MemDB::pin(const block::Hash& id) noexcept -> void
+{
+    if (id.IsNull()) {
+        LogError()(OT_PRETTY_CLASS())("invalid block id").Flush();
+
+        return;
+    }
+
+    auto& count = pins_[id];
+
+    if (0_uz < count++) { return; }
+
+    if (auto i = index_.find(id.Bytes()); index_.end() != i) {
+        auto& item = i->second;
+        item->pinned_ = true;
+        pinned_.splice(pinned_.begin(), lru_, item);
+    }
+}
+
 auto MemDB::push(block::Hash&& id, BitcoinBlockResult&& future) noexcept -> void
 {
     if (id.IsNull()) {
@@ -71,20 +125,54 @@ auto MemDB::push(block::Hash&& id, BitcoinBlockResult&& future) noexcept -> void
 
     OT_ASSERT(pBlock);
 
-    const auto& block = *pBlock;
-    const auto& item = queue_.emplace_back(std::move(id), std::move(future));
-    bytes_ += block.Internal().CalculateSize();
-    index_.try_emplace(item.first.Bytes(), &item);
+    const auto bytes = pBlock->Internal().CalculateSize();
+    const auto pinned = (0u < pins_.count(id));
 
-    while ((bytes_ > limit_) && (0u < queue_.size())) {
-        const auto& item = queue_.front();
-        const auto& id = item.first;
-        LogTrace()(OT_PRETTY_CLASS())("dropping oldest block ")(id.asHex())(
-            " from cache due to exceeding byte limit")
+    if ((bytes > limit_) && (false == pinned)) {
+        LogTrace()(OT_PRETTY_CLASS())("block ")(id.asHex())(" size (")(
+            bytes)(" bytes) exceeds cache limit")
             .Flush();
-        index_.erase(item.first.Bytes());
-        bytes_ -= item.second.get()->Internal().CalculateSize();
-        queue_.pop_front();
+
+        return;
+    }
+
+    auto& list = pinned ? pinned_ : lru_;
+    const auto item = list.emplace(
+        list.begin(),
+        CachedBlock{std::move(id), std::move(future), bytes, pinned});
+    index_.try_emplace(item->id_.Bytes(), item);
+    bytes_ += bytes;
+    evict();
+    update_metrics();
+}
+
+auto MemDB::unpin(const block::Hash& id) noexcept -> void
+{
+    auto pin = pins_.find(id);
+
+    if (pins_.end() == pin) {
+        LogError()(OT_PRETTY_CLASS())("block ")(id.asHex())(" is not pinned")
+            .Flush();
+
+        return;
     }
+
+    if (0_uz < --pin->second) { return; }
+
+    pins_.erase(pin);
+
+    if (auto i = index_.find(id.Bytes()); index_.end() != i) {
+        auto& item = i->second;
+        item->pinned_ = false;
+        lru_.splice(lru_.begin(), pinned_, item);
+        evict();
+        update_metrics();
+    }
+}
+
+auto MemDB::update_metrics() noexcept -> void
+{
+    metrics_.blocks_.store(index_.size());
+    metrics_.bytes_.store(bytes_);
 }
 }  // namespace opentxs::blockchain::node::blockoracle
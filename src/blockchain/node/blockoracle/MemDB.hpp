@@ -5,8 +5,6 @@
 
 #pragma once
 
-#include <boost/container/flat_map.hpp>
-#include <boost/container/vector.hpp>
 #include <cstddef>
 #include <functional>
 #include <string_view>
@@ -39,6 +37,14 @@ namespace block
 {
 class Hash;
 }  // namespace block
+
+namespace node
+{
+namespace internal
+{
+struct BlockCacheMetrics;
+}  // namespace internal
+}  // namespace node
 }  // namespace blockchain
 // }  // namespace v1
 }  // namespace opentxs
@@ -46,28 +52,55 @@ class Hash;
 
 namespace opentxs::blockchain::node::blockoracle
 {
+/// Byte-budgeted, access-ordered cache of recently used blocks
+///
+/// Blocks which are pinned are never evicted. Their size still counts toward
+/// the budget so heavy pinning shrinks the space available to everything else.
 class MemDB final : public Allocated
 {
 public:
-    auto find(const ReadView id) const noexcept -> BitcoinBlockResult;
     auto get_allocator() const noexcept -> allocator_type final
     {
-        return queue_.get_allocator();
+        return lru_.get_allocator();
     }
 
     auto clear() noexcept -> void;
+    /// Returns an invalid future if the block is not cached. A hit marks the
+    /// block as most recently used.
+    auto find(const ReadView id) noexcept -> BitcoinBlockResult;
+    /// Pins are reference counted and may be taken before the block is cached
+    auto pin(const block::Hash& id) noexcept -> void;
     auto push(block::Hash&& id, BitcoinBlockResult&& future) noexcept -> void;
+    auto unpin(const block::Hash& id) noexcept -> void;
 
-    MemDB(const std::size_t limit, allocator_type alloc) noexcept;
+    MemDB(
+        const std::size_t limit,
+        internal::BlockCacheMetrics& metrics,
+        allocator_type alloc) noexcept;
 
 private:
-    using CachedBlock = std::pair<block::Hash, BitcoinBlockResult>;
-    using Completed = Deque<CachedBlock>;
-    using Index = Map<ReadView, const CachedBlock*>;
+    struct CachedBlock {
+        block::Hash id_;
+        BitcoinBlockResult future_;
+        std::size_t bytes_;
+        bool pinned_;
+    };
+
+    using Entries = List<CachedBlock>;
+    using Index = UnorderedMap<ReadView, Entries::iterator>;
+    using Pins = UnorderedMap<block::Hash, std::size_t>;
 
     const std::size_t limit_;
+    internal::BlockCacheMetrics& metrics_;
     std::size_t bytes_;
-    Completed queue_;
+    // NOTE most recently used entries are at the front of both lists and
+    // eviction only considers lru_
+    Entries lru_;
+    Entries pinned_;
     Index index_;
+    Pins pins_;
+
+    auto evict() noexcept -> void;
+    auto update_metrics() noexcept -> void;
 };
 }  // namespace opentxs::blockchain::node::blockoracle
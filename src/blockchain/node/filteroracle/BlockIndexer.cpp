@@ -17,9 +17,11 @@
 #include <memory>
 #include <mutex>
 #include <string_view>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
+#include "internal/api/network/Asio.hpp"
 #include "internal/api/session/Endpoints.hpp"
 #include "internal/blockchain/database/Cfilter.hpp"
 #include "internal/blockchain/node/Types.hpp"
@@ -29,6 +31,7 @@
 #include "internal/network/zeromq/Types.hpp"
 #include "internal/util/Future.hpp"
 #include "internal/util/LogMacros.hpp"
+#include "opentxs/api/network/Asio.hpp"
 #include "opentxs/api/network/Network.hpp"
 #include "opentxs/api/session/Endpoints.hpp"
 #include "opentxs/api/session/Session.hpp"
@@ -136,78 +139,47 @@ BlockIndexer::Imp::Imp(
     , current_header_()
     , best_position_(block::Position{})
     , current_position_(block::Position{})
+    , queued_position_(block::Position{})
+    , generation_(0)
+    , job_limit_(std::max<std::size_t>(std::thread::hardware_concurrency(), 1))
+    , jobs_(0)
+    , me_()
+    , queue_()
 {
 }
 
-auto BlockIndexer::Imp::calculate_next_block() noexcept -> bool
+auto BlockIndexer::Imp::calculate_cfilter(
+    const std::size_t generation,
+    const block::Position& position,
+    const bitcoin::block::Block& block) noexcept -> void
 {
-    OT_ASSERT(0 <= current_position_.height_);
-
-    const auto& blockOracle = node_.BlockOracle();
-    const auto& headerOracle = node_.HeaderOracle();
-    auto position = headerOracle.GetPosition(current_position_.height_ + 1);
-    const auto& [height, hash] = position;
-
-    if (hash.empty()) {
-        log_(OT_PRETTY_CLASS())(name_)(": block hash not found for height ")(
-            height)
-            .Flush();
-
-        return true;
-    }
-
-    auto future = blockOracle.LoadBitcoin(hash);
-
-    if (false == IsReady(future)) {
-        log_(OT_PRETTY_CLASS())(name_)(": block ")
-            .asHex(hash)(" not yet downloaded")
-            .Flush();
-
-        return true;
-    }
-
-    const auto pBlock = future.get();
-
-    if (false == bool(pBlock)) {
-        // NOTE the only time the future should contain an uninitialized pointer
-        // is if the block oracle is shutting down
-        log_(OT_PRETTY_CLASS())(name_)(": block ")
-            .asHex(hash)(" unavailable")
-            .Flush();
-
-        return false;
-    }
-
-    const auto& block = *pBlock;
-
-    OT_ASSERT(block.ID() == hash);
-
-    if (block.Header().ParentHash() != current_position_.hash_) {
-        log_(OT_PRETTY_CLASS())(name_)(": block ")
-            .asHex(hash)(" is not connected to current tip")
-            .Flush();
-        process_reorg(headerOracle.CommonParent(position).first);
-
-        return true;
-    }
+    queue_.Add(
+        generation,
+        position,
+        parent_.Internal().ProcessBlock(filter_type_, block, {}));
+
+    // NOTE the job count must be decremented before the state machine is
+    // triggered or else the final job of a full queue could stall the pipeline
+    --jobs_;
+    trigger();
+}
 
-    auto alloc = get_allocator();
-    auto filters = Vector<database::Cfilter::CFilterParams>{alloc};
-    auto headers = Vector<database::Cfilter::CFHeaderParams>{alloc};
-    const auto& [ignore1, cfilter] = filters.emplace_back(
-        hash, parent_.Internal().ProcessBlock(filter_type_, block, alloc));
+auto BlockIndexer::Imp::commit_cfilters() noexcept -> void
+{
+    OT_ASSERT(0 <= current_position_.height_);
 
-    if (false == cfilter.IsValid()) {
-        log_(OT_PRETTY_CLASS())(name_)(": failed to calculate gcs for ")(
-            position)
-            .Flush();
+    auto batch = queue_.Next(
+        current_position_,
+        current_header_,
+        queued_position_.height_,
+        commit_batch_,
+        get_allocator());
 
-        OT_FAIL;
-    }
+    if (false == batch.has_value()) { return; }
 
-    auto& [ignore2, cfheader, cfhash] = headers.emplace_back(
-        hash, cfilter.Header(current_header_), cfilter.Hash());
-    const auto rc = db_.StoreFilters(filter_type_, headers, filters, position);
+    auto& [tip, previous, current, headers, filters] = *batch;
+    const auto count = filters.size();
+    const auto rc = db_.StoreFilters(filter_type_, headers, filters, tip);
 
     if (false == rc) {
         log_(OT_PRETTY_CLASS())(name_)(": failed to update database").Flush();
@@ -215,12 +187,13 @@ auto BlockIndexer::Imp::calculate_next_block() noexcept -> bool
         OT_FAIL;
     }
 
-    previous_header_ = std::move(current_header_);
-    current_header_ = std::move(cfheader);
-    current_position_ = std::move(position);
+    log_(OT_PRETTY_CLASS())(name_)(": committed ")(count)(
+        " cfilters ending at ")(tip)
+        .Flush();
+    previous_header_ = std::move(previous);
+    current_header_ = std::move(current);
+    current_position_ = std::move(tip);
     notify_(filter_type_, current_position_);
-
-    return current_position_ != best_position_;
 }
 
 auto BlockIndexer::Imp::do_shutdown() noexcept -> void
@@ -229,6 +202,7 @@ auto BlockIndexer::Imp::do_shutdown() noexcept -> void
     previous_header_ = {};
     best_position_ = block::Position{};
     current_position_ = block::Position{};
+    restart_pipeline();
 }
 
 auto BlockIndexer::Imp::do_startup() noexcept -> void
@@ -239,6 +213,7 @@ auto BlockIndexer::Imp::do_startup() noexcept -> void
     auto post = ScopeGuard{
         [&] { update_position(headerTip, cfilterTip, current_position_); }};
     find_best_position(std::min(headerTip, cfilterTip));
+    restart_pipeline();
 }
 
 auto BlockIndexer::Imp::find_best_position(block::Position candidate) noexcept
@@ -306,6 +281,7 @@ auto BlockIndexer::Imp::find_best_position(block::Position candidate) noexcept
 
 auto BlockIndexer::Imp::Init(boost::shared_ptr<Imp> me) noexcept -> void
 {
+    me_ = me;
     signal_startup(me);
 }
 
@@ -374,7 +350,97 @@ auto BlockIndexer::Imp::process_reorg(block::Position&& commonParent) noexcept
 {
     if (best_position_ > commonParent) { best_position_ = commonParent; }
 
-    if (current_position_ > commonParent) { reset(std::move(commonParent)); }
+    if (current_position_ > commonParent) {
+        reset(std::move(commonParent));
+    } else if (queued_position_ > commonParent) {
+        restart_pipeline();
+    }
+}
+
+auto BlockIndexer::Imp::queue_blocks() noexcept -> bool
+{
+    OT_ASSERT(0 <= queued_position_.height_);
+
+    const auto& blockOracle = node_.BlockOracle();
+    const auto& headerOracle = node_.HeaderOracle();
+    const auto canQueue = [&] {
+        const auto waiting = static_cast<std::size_t>(
+            queued_position_.height_ - current_position_.height_);
+
+        return (queued_position_.height_ < best_position_.height_) &&
+               (waiting < window_) && (jobs_.load() < job_limit_);
+    };
+
+    while (canQueue()) {
+        auto position = headerOracle.GetPosition(queued_position_.height_ + 1);
+        const auto& [height, hash] = position;
+
+        if (hash.empty()) {
+            log_(OT_PRETTY_CLASS())(name_)(
+                ": block hash not found for height ")(height)
+                .Flush();
+
+            return true;
+        }
+
+        auto future = blockOracle.LoadBitcoin(hash);
+
+        if (false == IsReady(future)) {
+            log_(OT_PRETTY_CLASS())(name_)(": block ")
+                .asHex(hash)(" not yet downloaded")
+                .Flush();
+
+            return true;
+        }
+
+        auto pBlock = future.get();
+
+        if (false == bool(pBlock)) {
+            // NOTE the only time the future should contain an uninitialized
+            // pointer is if the block oracle is shutting down
+            log_(OT_PRETTY_CLASS())(name_)(": block ")
+                .asHex(hash)(" unavailable")
+                .Flush();
+
+            return false;
+        }
+
+        OT_ASSERT(pBlock->ID() == hash);
+
+        if (pBlock->Header().ParentHash() != queued_position_.hash_) {
+            log_(OT_PRETTY_CLASS())(name_)(": block ")
+                .asHex(hash)(" is not connected to current tip")
+                .Flush();
+            process_reorg(headerOracle.CommonParent(position).first);
+
+            return true;
+        }
+
+        auto me = me_.lock();
+
+        if (false == bool(me)) { return false; }
+
+        ++jobs_;
+        const auto posted = api_.Network().Asio().Internal().Post(
+            ThreadPool::Blockchain,
+            [me = std::move(me),
+             generation = generation_,
+             pos{position},
+             ptr{std::move(pBlock)}] {
+                me->calculate_cfilter(generation, pos, *ptr);
+            },
+            "Calculate cfilter");
+
+        if (false == posted) {
+            --jobs_;
+
+            return false;
+        }
+
+        queued_position_ = std::move(position);
+    }
+
+    return false;
 }
 
 auto BlockIndexer::Imp::Reindex() noexcept -> void
@@ -388,6 +454,15 @@ auto BlockIndexer::Imp::reset(block::Position&& to) noexcept -> void
     auto post =
         ScopeGuard{[&] { update_position(before, before, current_position_); }};
     find_best_position(std::move(to));
+    restart_pipeline();
+}
+
+auto BlockIndexer::Imp::restart_pipeline() noexcept -> void
+{
+    // NOTE results from jobs which are still running on the thread pool will
+    // be discarded when they complete
+    generation_ = queue_.Reset();
+    queued_position_ = current_position_;
 }
 
 auto BlockIndexer::Imp::Shutdown() noexcept -> void
@@ -470,9 +545,14 @@ auto BlockIndexer::Imp::update_position(
 
 auto BlockIndexer::Imp::work() noexcept -> bool
 {
-    if (current_position_ == best_position_) { return false; }
+    const auto idle = (current_position_ == best_position_) &&
+                      (queued_position_ == current_position_);
+
+    if (idle) { return false; }
+
+    commit_cfilters();
 
-    return calculate_next_block();
+    return queue_blocks();
 }
 
 BlockIndexer::Imp::~Imp() = default;
@@ -8,12 +8,18 @@
 #pragma once
 
 #include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/smart_ptr/weak_ptr.hpp>
+#include <atomic>
+#include <cstddef>
+#include <memory>
 #include <string_view>
 
+#include "blockchain/node/filteroracle/CfilterQueue.hpp"
 #include "internal/blockchain/node/filteroracle/BlockIndexer.hpp"
 #include "internal/blockchain/node/filteroracle/Types.hpp"
 #include "internal/network/zeromq/Types.hpp"
 #include "opentxs/blockchain/Types.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/Header.hpp"
 #include "opentxs/blockchain/bitcoin/cfilter/Types.hpp"
 #include "opentxs/blockchain/block/Position.hpp"
@@ -33,6 +39,14 @@ class Session;
 
 namespace blockchain
 {
+namespace bitcoin
+{
+namespace block
+{
+class Block;
+}  // namespace block
+}  // namespace bitcoin
+
 namespace block
 {
 class Position;
@@ -96,6 +110,13 @@ private:
         shutdown,
     };
 
+    // NOTE maximum number of blocks which may be queued for processing ahead
+    // of the committed cfilter tip
+    static constexpr auto window_ = std::size_t{1000};
+    // NOTE minimum number of contiguous cfilters to write in a single
+    // database transaction unless the pipeline has drained
+    static constexpr auto commit_batch_ = std::size_t{250};
+
     const api::Session& api_;
     const node::Manager& node_;
     const node::FilterOracle& parent_;
@@ -108,8 +129,18 @@ private:
     cfilter::Header current_header_;
     block::Position best_position_;
     block::Position current_position_;
-
-    auto calculate_next_block() noexcept -> bool;
+    block::Position queued_position_;
+    std::size_t generation_;
+    const std::size_t job_limit_;
+    std::atomic<std::size_t> jobs_;
+    boost::weak_ptr<Imp> me_;
+    CfilterQueue queue_;
+
+    auto calculate_cfilter(
+        const std::size_t generation,
+        const block::Position& position,
+        const bitcoin::block::Block& block) noexcept -> void;
+    auto commit_cfilters() noexcept -> void;
     auto do_shutdown() noexcept -> void;
     auto do_startup() noexcept -> void;
     auto find_best_position(block::Position candidate) noexcept -> void;
@@ -119,7 +150,9 @@ private:
     auto process_reindex(network::zeromq::Message&& in) noexcept -> void;
     auto process_reorg(network::zeromq::Message&& in) noexcept -> void;
     auto process_reorg(block::Position&& commonParent) noexcept -> void;
+    auto queue_blocks() noexcept -> bool;
     auto reset(block::Position&& to) noexcept -> void;
+    auto restart_pipeline() noexcept -> void;
     auto state_normal(const Work work, network::zeromq::Message&& msg) noexcept
         -> void;
     auto transition_state_shutdown() noexcept -> void;
@@ -0,0 +1,113 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#include "blockchain/node/filteroracle/CfilterQueue.hpp"  // IWYU pragma: associated
+
+#include <utility>
+
+#include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/Hash.hpp"  // IWYU pragma: keep
+#include "opentxs/blockchain/block/Hash.hpp"
+#include "opentxs/util/Log.hpp"
+
+namespace opentxs::blockchain::node::filteroracle
+{
+CfilterQueue::CfilterQueue() noexcept
+    : results_()
+{
+}
+
+auto CfilterQueue::Add(
+    const std::size_t generation,
+    const block::Position& position,
+    GCS&& cfilter) const noexcept -> bool
+{
+    auto handle = results_.lock();
+    auto& results = *handle;
+
+    if (results.generation_ != generation) { return false; }
+
+    results.ready_.try_emplace(position.height_, position, std::move(cfilter));
+
+    return true;
+}
+
+auto CfilterQueue::Next(
+    const block::Position& tip,
+    const cfilter::Header& header,
+    const block::Height queued,
+    const std::size_t minimum,
+    alloc::Default alloc) const noexcept -> std::optional<Batch>
+{
+    auto ready = Vector<std::pair<block::Position, GCS>>{alloc};
+
+    {
+        auto handle = results_.lock();
+        auto& results = handle->ready_;
+        const auto first = tip.height_ + 1;
+        auto next = first;
+
+        while (results.end() != results.find(next)) { ++next; }
+
+        const auto available = static_cast<std::size_t>(next - first);
+        const auto outstanding = static_cast<std::size_t>(queued - tip.height_);
+
+        if (0_uz == available) { return std::nullopt; }
+
+        if ((available < minimum) && (available < outstanding)) {
+
+            return std::nullopt;
+        }
+
+        ready.reserve(available);
+
+        for (auto height = first; height < next; ++height) {
+            auto i = results.find(height);
+            ready.emplace_back(std::move(i->second));
+            results.erase(i);
+        }
+    }
+
+    using Headers = Vector<database::Cfilter::CFHeaderParams>;
+    using Filters = Vector<database::Cfilter::CFilterParams>;
+    auto batch = Batch{{}, header, header, Headers{alloc}, Filters{alloc}};
+    batch.headers_.reserve(ready.size());
+    batch.filters_.reserve(ready.size());
+
+    for (auto& [position, cfilter] : ready) {
+        if (false == cfilter.IsValid()) {
+            LogError()(OT_PRETTY_CLASS())("failed to calculate gcs for ")(
+                position)
+                .Flush();
+
+            OT_FAIL;
+        }
+
+        auto cfheader = cfilter.Header(batch.current_);
+        batch.headers_.emplace_back(position.hash_, cfheader, cfilter.Hash());
+        batch.filters_.emplace_back(position.hash_, std::move(cfilter));
+        batch.previous_ = std::move(batch.current_);
+        batch.current_ = std::move(cfheader);
+    }
+
+    batch.tip_ = std::move(ready.back().first);
+
+    return batch;
+}
+
+auto CfilterQueue::Reset() noexcept -> std::size_t
+{
+    auto handle = results_.lock();
+    auto& results = *handle;
+    results.ready_.clear();
+
+    return ++results.generation_;
+}
+
+CfilterQueue::~CfilterQueue() = default;
+}  // namespace opentxs::blockchain::node::filteroracle
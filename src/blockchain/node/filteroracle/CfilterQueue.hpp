@@ -0,0 +1,72 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cs_plain_guarded.h>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+#include "internal/blockchain/database/Cfilter.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
+#include "opentxs/blockchain/bitcoin/cfilter/Header.hpp"
+#include "opentxs/blockchain/block/Position.hpp"
+#include "opentxs/blockchain/block/Types.hpp"
+#include "opentxs/util/Allocator.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::blockchain::node::filteroracle
+{
+// NOTE collects cfilters which are calculated out of order on the thread pool
+// and releases them in height order with their cfheaders chained to the
+// previously committed cfheader
+class CfilterQueue
+{
+public:
+    struct Batch {
+        block::Position tip_;
+        cfilter::Header previous_;
+        cfilter::Header current_;
+        Vector<database::Cfilter::CFHeaderParams> headers_;
+        Vector<database::Cfilter::CFilterParams> filters_;
+    };
+
+    // NOTE returns false if the cfilter belongs to a previous generation
+    auto Add(
+        const std::size_t generation,
+        const block::Position& position,
+        GCS&& cfilter) const noexcept -> bool;
+    // NOTE returns the contiguous cfilters which follow tip once at least
+    // minimum of them are ready or once every cfilter up to and including
+    // queued is ready
+    auto Next(
+        const block::Position& tip,
+        const cfilter::Header& header,
+        const block::Height queued,
+        const std::size_t minimum,
+        alloc::Default alloc) const noexcept -> std::optional<Batch>;
+    // NOTE discards every pending cfilter and returns the new generation
+    auto Reset() noexcept -> std::size_t;
+
+    CfilterQueue() noexcept;
+    CfilterQueue(const CfilterQueue&) = delete;
+    CfilterQueue(CfilterQueue&&) = delete;
+    auto operator=(const CfilterQueue&) -> CfilterQueue& = delete;
+    auto operator=(CfilterQueue&&) -> CfilterQueue& = delete;
+
+    ~CfilterQueue();
+
+private:
+    struct Results {
+        std::size_t generation_{};
+        UnallocatedMap<block::Height, std::pair<block::Position, GCS>> ready_{};
+    };
+
+    using GuardedResults = libguarded::plain_guarded<Results>;
+
+    mutable GuardedResults results_;
+};
+}  // namespace opentxs::blockchain::node::filteroracle
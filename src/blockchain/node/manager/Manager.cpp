@@ -248,7 +248,8 @@ Base::Base(
           api_.Crypto().Blockchain(),
           *database_p_,
           api_.Network().Blockchain().Internal().Mempool(),
-          chain_)
+          chain_,
+          config_.MempoolLimit())
     , header_p_(factory::HeaderOracle(api, *database_p_, chain_))
     , block_(factory::BlockOracle(
           api,
@@ -513,7 +514,7 @@ auto Base::BroadcastTransaction(
     const bitcoin::block::Transaction& tx,
     const bool pushtx) const noexcept -> bool
 {
-    mempool_.Submit(tx.clone());
+    mempool_.Submit(tx.clone(), true);
 
     if (pushtx && p2p_requestor_) {
         sync_socket_->Send([&] {
@@ -549,10 +550,9 @@ auto Base::Disconnect() noexcept -> bool
 
 auto Base::FeeRate() const noexcept -> Amount
 {
-    // TODO in full node mode, calculate the fee network from the mempool and
-    // recent blocks
-    // TODO on networks that support it, query the fee rate from network peers
+    // TODO take recent blocks into account
     const auto http = wallet_.FeeEstimate();
+    const auto local = mempool_.EstimateFeeRate();
     const auto fallback = params::Chains().at(chain_).default_fee_rate_;
     const auto chain = print(chain_);
     LogConsole()(chain)(" defined minimum fee rate is: ")(fallback).Flush();
@@ -567,7 +567,19 @@ auto Base::FeeRate() const noexcept -> Amount
             .Flush();
     }
 
-    auto out = std::max<Amount>(fallback, http.value_or(0));
+    if (local.has_value()) {
+        LogConsole()(chain)(" transaction fee rate via mempool is: ")(
+            local.value())
+            .Flush();
+    } else {
+        LogConsole()(chain)(
+            " transaction fee estimates via mempool not available")
+            .Flush();
+    }
+
+    auto out = std::max<Amount>(
+        fallback,
+        std::max<Amount>(http.value_or(0), Amount{local.value_or(0u)}));
     LogConsole()("Using ")(out)(" for current ")(chain)(" fee rate").Flush();
 
     return out;
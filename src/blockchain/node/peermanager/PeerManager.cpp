@@ -103,6 +103,7 @@ PeerManager::PeerManager(
           seednode)
     , verified_lock_()
     , verified_peers_()
+    , high_bandwidth_peers_()
     , init_promise_()
     , init_(init_promise_.get_future())
 {
@@ -267,6 +268,7 @@ auto PeerManager::pipeline(zmq::Message&& message) noexcept -> void
             {
                 auto lock = Lock{verified_lock_};
                 verified_peers_.erase(id);
+                high_bandwidth_peers_.erase(id);
             }
 
             peers_.Disconnect(id);
@@ -384,6 +386,19 @@ auto PeerManager::RequestHeaders() const noexcept -> bool
     return true;
 }
 
+auto PeerManager::RequestHighBandwidth(const int id) const noexcept -> bool
+{
+    auto lock = Lock{verified_lock_};
+
+    if (0_uz < high_bandwidth_peers_.count(id)) { return true; }
+
+    if (high_bandwidth_peers_.size() >= max_high_bandwidth_) { return false; }
+
+    high_bandwidth_peers_.emplace(id);
+
+    return true;
+}
+
 auto PeerManager::shutdown(std::promise<void>& promise) noexcept -> void
 {
     if (auto previous = running_.exchange(false); previous) {
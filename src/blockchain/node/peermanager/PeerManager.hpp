@@ -288,6 +288,7 @@ public:
     auto RequestBlocks(const UnallocatedVector<ReadView>& hashes) const noexcept
         -> bool final;
     auto RequestHeaders() const noexcept -> bool final;
+    auto RequestHighBandwidth(const int id) const noexcept -> bool final;
     auto VerifyPeer(const int id, const UnallocatedCString& address)
         const noexcept -> void final;
 
@@ -355,6 +356,9 @@ private:
             const zmq::socket::Sender& socket) noexcept -> void;
     };
 
+    // NOTE BIP152 allows at most three high bandwidth compact block peers
+    static constexpr auto max_high_bandwidth_ = std::size_t{3};
+
     const node::internal::Manager& node_;
     database::Peer& database_;
     const Type chain_;
@@ -362,6 +366,8 @@ private:
     mutable Peers peers_;
     mutable std::mutex verified_lock_;
     mutable UnallocatedSet<int> verified_peers_;
+    // NOTE also guarded by verified_lock_
+    mutable UnallocatedSet<int> high_bandwidth_peers_;
     std::promise<void> init_promise_;
     std::shared_future<void> init_;
 
@@ -206,7 +206,6 @@ public:
     }
 
     PrehashData(
-        const api::Session& api,
         const BlockTargets& targets,
         const std::string_view name,
         wallet::MatchCache::Results& results,
@@ -214,7 +213,6 @@ public:
         std::size_t jobs,
         allocator_type alloc) noexcept
         : job_count_(jobs)
-        , api_(api)
         , targets_(targets)
         , name_(name)
         , data_(alloc)
@@ -257,7 +255,6 @@ private:
         TxoData>;
     using Data = Vector<BlockData>;
 
-    const api::Session& api_;
     const BlockTargets& targets_;
     const std::string_view name_;
     Data data_;
@@ -284,14 +281,17 @@ private:
             blockchain::internal::BlockHashToFilterKey(block.Bytes());
         const auto& [indices, bytes] = targets;
         auto& [hashes, map] = dest;
+
+        OT_ASSERT(indices.size() == bytes.size());
+
+        const auto first = hashes.size();
+        hashes.resize(first + bytes.size());
+        gcs::Siphash(key, bytes, hashes.data() + first);
         auto i = indices.cbegin();
-        auto t = bytes.cbegin();
+        auto n = first;
         auto end = indices.cend();
 
-        for (; i < end; ++i, ++t) {
-            auto& hash = hashes.emplace_back(gcs::Siphash(api_, key, *t));
-            map[hash].emplace_back(&(*i));
-        }
+        for (; i < end; ++i, ++n) { map[hashes[n]].emplace_back(&(*i)); }
 
         dedup(hashes);
     }
@@ -1213,7 +1213,6 @@ auto SubchainStateData::scan(
             select_targets(*handle, blocks, elements, startHeight, selected);
             auto results = wallet::MatchCache::Results{get_allocator()};
             auto prehash = PrehashData{
-                api_,
                 selected,
                 name_,
                 results,
@@ -26,6 +26,7 @@
 #include "internal/blockchain/Params.hpp"
 #include "internal/blockchain/node/Manager.hpp"
 #include "internal/blockchain/node/Mempool.hpp"
+#include "internal/blockchain/node/blockoracle/BlockOracle.hpp"
 #include "internal/blockchain/node/wallet/Types.hpp"
 #include "internal/blockchain/node/wallet/subchain/statemachine/Job.hpp"
 #include "internal/blockchain/node/wallet/subchain/statemachine/Types.hpp"
@@ -330,6 +331,8 @@ auto Process::Imp::process_mempool(Message&& in) noexcept -> void
 
 auto Process::Imp::process_process(block::Position&& pos) noexcept -> void
 {
+    parent_.node_.BlockOracle().Internal().Unpin(pos.hash_);
+
     if (const auto i = processing_.find(pos); i == processing_.end()) {
         log_(OT_PRETTY_CLASS())(parent_.name_)(" block ")(
             pos)(" has been removed from the processing list due to reorg")
@@ -414,6 +417,9 @@ auto Process::Imp::queue_process() noexcept -> bool
         log_(OT_PRETTY_CLASS())(parent_.name_)(" adding block ")(
             position)(" to process queue")
             .Flush();
+        // NOTE other subchains are likely to request the same block soon so
+        // keep it cached until this subchain is finished with it
+        parent_.node_.BlockOracle().Internal().Pin(position.hash_);
         parent_.api_.Network().Asio().Internal().Post(
             ThreadPool::Blockchain,
             [this,
@@ -11,6 +11,8 @@
 #include <boost/endian/buffers.hpp>
 #include <boost/exception/exception.hpp>
 #include <memory>
+#include <new>
+#include <utility>
 
 #include "core/Amount.hpp"
 #include "opentxs/network/zeromq/message/Frame.hpp"
@@ -22,12 +24,12 @@ namespace opentxs::factory
 auto Amount(std::string_view str, bool normalize) noexcept(false)
     -> opentxs::Amount
 {
-    return std::make_unique<opentxs::Amount::Imp>(str, normalize).release();
+    return opentxs::Amount::Imp{str, normalize};
 }
 
 auto Amount(const network::zeromq::Frame& in) noexcept(false) -> opentxs::Amount
 {
-    return std::make_unique<opentxs::Amount::Imp>(in.Bytes()).release();
+    return opentxs::Amount::Imp{in.Bytes()};
 }
 }  // namespace opentxs::factory
 
@@ -143,53 +145,57 @@ auto Amount::SerializeBitcoinSize() noexcept -> std::size_t
 namespace opentxs
 {
 Amount::Amount(Imp* rhs) noexcept
-    : imp_(rhs)
+    : imp_()
 {
-    OT_ASSERT(nullptr != imp_);
+    OT_ASSERT(nullptr != rhs);
+
+    auto imp = std::unique_ptr<Imp>{rhs};
+    new (imp_.data()) Imp(std::move(*imp));
 }
 
 Amount::Amount(const Imp& rhs) noexcept
-    : Amount(std::make_unique<Imp>(rhs).release())
+    : imp_()
 {
+    new (imp_.data()) Imp(rhs);
 }
 
 Amount::Amount(int rhs)
-    : Amount(Imp::factory_signed(rhs))
+    : Amount(Imp{static_cast<long long>(rhs)})
 {
 }
 
 Amount::Amount(long rhs)
-    : Amount(Imp::factory_signed(rhs))
+    : Amount(Imp{static_cast<long long>(rhs)})
 {
 }
 
 Amount::Amount(long long rhs)
-    : Amount(Imp::factory_signed(rhs))
+    : Amount(Imp{rhs})
 {
 }
 
 Amount::Amount(unsigned rhs)
-    : Amount(Imp::factory_unsigned(rhs))
+    : Amount(Imp{static_cast<unsigned long long>(rhs)})
 {
 }
 
 Amount::Amount(unsigned long rhs)
-    : Amount(Imp::factory_unsigned(rhs))
+    : Amount(Imp{static_cast<unsigned long long>(rhs)})
 {
 }
 
 Amount::Amount(unsigned long long rhs)
-    : Amount(Imp::factory_unsigned(rhs))
+    : Amount(Imp{rhs})
 {
 }
 
 Amount::Amount() noexcept
-    : Amount(std::make_unique<Imp>().release())
+    : Amount(Imp{})
 {
 }
 
 Amount::Amount(const Amount& rhs) noexcept
-    : Amount(std::make_unique<Imp>(*rhs.imp_).release())
+    : Amount(rhs.imp())
 {
 }
 
@@ -199,10 +205,22 @@ Amount::Amount(Amount&& rhs) noexcept
     operator=(std::move(rhs));
 }
 
+auto Amount::imp() const noexcept -> const Imp&
+{
+    static_assert(sizeof(Imp) <= imp_size_);
+    static_assert(alignof(Imp) <= imp_align_);
+
+    return *std::launder(reinterpret_cast<const Imp*>(imp_.data()));
+}
+
+auto Amount::imp() noexcept -> Imp&
+{
+    return *std::launder(reinterpret_cast<Imp*>(imp_.data()));
+}
+
 auto Amount::operator=(const Amount& rhs) noexcept -> Amount&
 {
-    auto old = std::unique_ptr<Imp>{imp_};
-    imp_ = std::make_unique<Imp>(*rhs.imp_).release();
+    imp() = rhs.imp();
 
     return *this;
 }
@@ -216,155 +234,149 @@ auto Amount::operator=(Amount&& rhs) noexcept -> Amount&
 
 auto Amount::operator<(const Amount& rhs) const noexcept -> bool
 {
-    return *imp_ < *rhs.imp_;
+    return imp() < rhs.imp();
 }
 
 template <typename T, std::enable_if_t<std::is_integral<T>::value, int>>
 auto Amount::operator<(const T rhs) const noexcept -> bool
 {
-    return *imp_ < rhs;
+    return imp() < rhs;
 }
 
 auto Amount::operator>(const Amount& rhs) const noexcept -> bool
 {
-    return *imp_ > *rhs.imp_;
+    return imp() > rhs.imp();
 }
 
 template <typename T, std::enable_if_t<std::is_integral<T>::value, int>>
 auto Amount::operator>(const T rhs) const noexcept -> bool
 {
-    return *imp_ > rhs;
+    return imp() > rhs;
 }
 
 auto Amount::operator==(const Amount& rhs) const noexcept -> bool
 {
-    return *imp_ == *rhs.imp_;
+    return imp() == rhs.imp();
 }
 
 template <typename T, std::enable_if_t<std::is_integral<T>::value, int>>
 auto Amount::operator==(const T rhs) const noexcept -> bool
 {
-    return *imp_ == rhs;
+    return imp() == rhs;
 }
 
 auto Amount::operator!=(const Amount& rhs) const noexcept -> bool
 {
-    return *imp_ != *rhs.imp_;
+    return imp() != rhs.imp();
 }
 
 template <typename T, std::enable_if_t<std::is_integral<T>::value, int>>
 auto Amount::operator!=(const T rhs) const noexcept -> bool
 {
-    return *imp_ != rhs;
+    return imp() != rhs;
 }
 
 auto Amount::operator<=(const Amount& rhs) const noexcept -> bool
 {
-    return *imp_ <= *rhs.imp_;
+    return imp() <= rhs.imp();
 }
 
 template <typename T, std::enable_if_t<std::is_integral<T>::value, int>>
 auto Amount::operator<=(const T rhs) const noexcept -> bool
 {
-    return *imp_ <= rhs;
+    return imp() <= rhs;
 }
 
 auto Amount::operator>=(const Amount& rhs) const noexcept -> bool
 {
-    return *imp_ >= *rhs.imp_;
+    return imp() >= rhs.imp();
 }
 
 template <typename T, std::enable_if_t<std::is_integral<T>::value, int>>
 auto Amount::operator>=(const T rhs) const noexcept -> bool
 {
-    return *imp_ >= rhs;
+    return imp() >= rhs;
 }
 
 auto Amount::operator+(const Amount& rhs) const noexcept(false) -> Amount
 {
-    return *imp_ + *rhs.imp_;
+    return imp() + rhs.imp();
 }
 
 auto Amount::operator-(const Amount& rhs) const noexcept(false) -> Amount
 {
-    return *imp_ - *rhs.imp_;
+    return imp() - rhs.imp();
 }
 
 auto Amount::operator*(const Amount& rhs) const noexcept(false) -> Amount
 {
-    return *imp_ * *rhs.imp_;
+    return imp() * rhs.imp();
 }
 
 template <typename T, std::enable_if_t<std::is_integral<T>::value, int>>
 auto Amount::operator*(const T rhs) const noexcept(false) -> Amount
 {
-    return *imp_ * rhs;
+    return imp() * rhs;
 }
 
 auto Amount::operator/(const Amount& rhs) const noexcept(false) -> Amount
 {
-    return *imp_ / *rhs.imp_;
+    return imp() / rhs.imp();
 }
 
 template <typename T, std::enable_if_t<std::is_integral<T>::value, int>>
 auto Amount::operator/(const T rhs) const noexcept(false) -> Amount
 {
-    return *imp_ / rhs;
+    return imp() / rhs;
 }
 
 auto Amount::operator%(const Amount& rhs) const noexcept(false) -> Amount
 {
-    return *imp_ % *rhs.imp_;
+    return imp() % rhs.imp();
 }
 
 template <typename T, std::enable_if_t<std::is_integral<T>::value, int>>
 auto Amount::operator%(const T rhs) const noexcept(false) -> Amount
 {
-    return *imp_ % rhs;
+    return imp() % rhs;
 }
 
 auto Amount::operator*=(const Amount& rhs) noexcept(false) -> Amount&
 {
-    *imp_ *= *rhs.imp_;
+    imp() *= rhs.imp();
 
     return *this;
 }
 
 auto Amount::operator+=(const Amount& rhs) noexcept(false) -> Amount&
 {
-    *imp_ += *rhs.imp_;
+    imp() += rhs.imp();
 
     return *this;
 }
 
 auto Amount::operator-=(const Amount& rhs) noexcept(false) -> Amount&
 {
-    *imp_ -= *rhs.imp_;
+    imp() -= rhs.imp();
 
     return *this;
 }
 
-auto Amount::operator-() -> Amount { return -*imp_; }
+auto Amount::operator-() -> Amount { return -imp(); }
 
 auto Amount::Internal() const noexcept -> const internal::Amount&
 {
-    return *imp_;
+    return imp();
 }
 
 auto Amount::Serialize(const AllocateOutput dest) const noexcept -> bool
 {
-    return imp_->Serialize(dest);
+    return imp().Serialize(dest);
 }
 
-auto Amount::swap(Amount& rhs) noexcept -> void { std::swap(imp_, rhs.imp_); }
+auto Amount::swap(Amount& rhs) noexcept -> void { imp().swap(rhs.imp()); }
 
-Amount::~Amount()
-{
-    if (nullptr != imp_) {
-        delete imp_;
-        imp_ = nullptr;
-    }
-}
+Amount::~Amount() { imp().~Imp(); }
 }  // namespace opentxs
 
 namespace opentxs
@@ -12,6 +12,7 @@
 #include <exception>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string_view>
 #include <utility>
 
@@ -26,17 +27,23 @@ namespace be = boost::endian;
 
 namespace opentxs
 {
+// NOTE values are held as a native 128 bit fixed point integer whenever they
+// fit, which covers every amount with an integer part smaller than 2^63. Only
+// results which overflow that representation move to the heap allocated
+// amount::Integer backend, and a result which fits again moves back.
+//
+// small_ never holds the minimum value of Small so every small value can be
+// negated, and big_ is never set for a value which would fit in small_.
 class Amount::Imp final : virtual public internal::Amount
 {
 public:
-    static auto factory_signed(long long rhs) noexcept -> Imp*
-    {
-        return std::make_unique<Imp>(rhs).release();
-    }
-    static auto factory_unsigned(unsigned long long rhs) noexcept -> Imp*
-    {
-        return std::make_unique<Imp>(rhs).release();
-    }
+#if defined(__SIZEOF_INT128__)
+    using Small = __int128;
+    using Magnitude = unsigned __int128;
+#else
+    using Small = std::int64_t;
+    using Magnitude = std::uint64_t;
+#endif
 
     auto ExtractInt64() const noexcept(false) -> std::int64_t final
     {
@@ -46,66 +53,112 @@ public:
     {
         return extract_int<std::uint64_t>();
     }
-    auto operator<(const Imp& rhs) const { return amount_ < rhs.amount_; }
+    auto operator<(const Imp& rhs) const
+    {
+        if (is_small() && rhs.is_small()) { return small_ < rhs.small_; }
+
+        return integer() < rhs.integer();
+    }
 
     template <typename T>
     auto operator<(const T rhs) const
     {
-        return amount_ < shift_left(rhs);
+        if (auto val = small_shift_left(rhs); is_small() && val) {
+
+            return small_ < *val;
+        }
+
+        return integer() < shift_left(rhs);
     }
-    auto operator>(const Imp& rhs) const { return amount_ > rhs.amount_; }
+    auto operator>(const Imp& rhs) const { return rhs < *this; }
 
     template <typename T>
     auto operator>(const T rhs) const
     {
-        return amount_ > shift_left(rhs);
+        if (auto val = small_shift_left(rhs); is_small() && val) {
+
+            return small_ > *val;
+        }
+
+        return integer() > shift_left(rhs);
     }
 
-    auto operator==(const Imp& rhs) const { return amount_ == rhs.amount_; }
+    auto operator==(const Imp& rhs) const
+    {
+        if (is_small() && rhs.is_small()) { return small_ == rhs.small_; }
+
+        return integer() == rhs.integer();
+    }
 
     template <typename T>
     auto operator==(const T rhs) const
     {
-        return amount_ == shift_left(rhs);
+        if (auto val = small_shift_left(rhs); is_small() && val) {
+
+            return small_ == *val;
+        }
+
+        return integer() == shift_left(rhs);
     }
 
-    auto operator!=(const Imp& rhs) const { return amount_ != rhs.amount_; }
+    auto operator!=(const Imp& rhs) const { return false == (*this == rhs); }
 
     template <typename T>
     auto operator!=(const T rhs) const
     {
-        return amount_ != shift_left(rhs);
+        return false == (*this == rhs);
     }
 
-    auto operator<=(const Imp& rhs) const { return amount_ <= rhs.amount_; }
+    auto operator<=(const Imp& rhs) const { return false == (rhs < *this); }
 
     template <typename T>
     auto operator<=(const T rhs) const
     {
-        return amount_ <= shift_left(rhs);
+        return false == (*this > rhs);
     }
 
-    auto operator>=(const Imp& rhs) const { return amount_ >= rhs.amount_; }
+    auto operator>=(const Imp& rhs) const { return false == (*this < rhs); }
 
     template <typename T>
     auto operator>=(const T rhs) const
     {
-        return amount_ >= shift_left(rhs);
+        return false == (*this < rhs);
     }
 
     auto operator+(const Imp& rhs) const noexcept(false) -> Imp
     {
-        return amount_ + rhs.amount_;
+        if (is_small() && rhs.is_small()) {
+            if (auto out = small_add(small_, rhs.small_); out) {
+
+                return Imp{std::in_place, *out};
+            }
+        }
+
+        return integer() + rhs.integer();
     }
 
     auto operator-(const Imp& rhs) const noexcept(false) -> Imp
     {
-        return amount_ - rhs.amount_;
+        if (is_small() && rhs.is_small()) {
+            if (auto out = small_subtract(small_, rhs.small_); out) {
+
+                return Imp{std::in_place, *out};
+            }
+        }
+
+        return integer() - rhs.integer();
     }
 
     auto operator*(const Imp& rhs) const noexcept(false) -> Imp
     {
-        const auto total = amount_ * rhs.amount_;
+        if (is_small() && rhs.is_small()) {
+            if (auto out = small_multiply_fixed(small_, rhs.small_); out) {
+
+                return Imp{std::in_place, *out};
+            }
+        }
+
+        const auto total = integer() * rhs.integer();
         auto imp = Imp{total};
         return imp.shift_right();
     }
@@ -113,59 +166,117 @@ public:
     template <typename T>
     auto operator*(const T rhs) const noexcept(false) -> Imp
     {
-        return amount_ * rhs;
+        if (is_small()) {
+            if (auto out = small_multiply(small_, rhs); out) {
+
+                return Imp{std::in_place, *out};
+            }
+        }
+
+        return integer() * rhs;
     }
 
     auto operator/(const Imp& rhs) const noexcept(false) -> Imp
     {
-        const auto total = amount_ / rhs.amount_;
+        if (is_small() && rhs.is_small()) {
+            if (auto out = small_divide(small_, rhs.small_); out) {
+                if (auto shifted = small_shift_left(*out); shifted) {
+
+                    return Imp{std::in_place, *shifted};
+                }
+            }
+        }
+
+        const auto total = integer() / rhs.integer();
         return Imp::shift_left(total);
     }
 
     template <typename T>
     auto operator/(const T rhs) const noexcept(false) -> Imp
     {
-        return amount_ / rhs;
+        if (is_small()) {
+            if (auto out = small_divide(small_, rhs); out) {
+
+                return Imp{std::in_place, *out};
+            }
+        }
+
+        return integer() / rhs;
     }
 
     auto operator%(const Imp& rhs) const noexcept(false) -> Imp
     {
-        return amount_ % rhs.amount_;
+        if (is_small() && rhs.is_small()) {
+            if (auto out = small_modulo(small_, rhs.small_); out) {
+
+                return Imp{std::in_place, *out};
+            }
+        }
+
+        return integer() % rhs.integer();
     }
 
     template <typename T>
     auto operator%(const T rhs) const noexcept(false) -> Imp
     {
-        return amount_ % shift_left(rhs);
+        if (auto val = small_shift_left(rhs); is_small() && val) {
+            if (auto out = small_modulo(small_, *val); out) {
+
+                return Imp{std::in_place, *out};
+            }
+        }
+
+        return integer() % shift_left(rhs);
     }
 
     auto operator*=(const Imp& amount) noexcept(false) -> Imp&
     {
-        auto total = amount_ * amount.amount_;
-        amount_ = Imp(total).shift_right();
+        auto total = *this * amount;
+        swap(total);
         return *this;
     }
 
     auto operator+=(const Imp& amount) noexcept(false) -> Imp&
     {
-        amount_ += amount.amount_;
+        if (is_small() && amount.is_small()) {
+            if (auto out = small_add(small_, amount.small_); out) {
+                small_ = *out;
+
+                return *this;
+            }
+        }
+
+        set(integer() + amount.integer());
         return *this;
     }
 
     auto operator-=(const Imp& amount) noexcept(false) -> Imp&
     {
-        amount_ -= amount.amount_;
+        if (is_small() && amount.is_small()) {
+            if (auto out = small_subtract(small_, amount.small_); out) {
+                small_ = *out;
+
+                return *this;
+            }
+        }
+
+        set(integer() - amount.integer());
         return *this;
     }
 
-    auto operator-() -> Imp { return -amount_; }
+    auto operator-() -> Imp
+    {
+        if (is_small()) { return Imp{std::in_place, -small_}; }
+
+        return -integer();
+    }
 
     auto Serialize(const AllocateOutput dest) const noexcept -> bool
     {
         auto amount = UnallocatedCString{};
 
         try {
-            amount = amount_.str();
+            amount = integer().str();
         } catch (const std::exception& e) {
             LogError()(OT_PRETTY_CLASS())("Error serializing amount: ")(
                 e.what())
@@ -179,20 +290,34 @@ public:
     auto SerializeBitcoin(const AllocateOutput dest) const noexcept
         -> bool final
     {
-        const auto backend = shift_right();
-        if (backend < 0 || backend > std::numeric_limits<std::int64_t>::max()) {
-            return false;
-        }
-
         auto amount = std::int64_t{};
-        try {
-            amount = backend.convert_to<std::int64_t>();
-        } catch (const std::exception& e) {
-            LogError()(OT_PRETTY_CLASS())("Error serializing bitcoin amount: ")(
-                e.what())
-                .Flush();
-            return false;
+
+        if (is_small()) {
+            const auto value = small_shift_right(small_);
+
+            if (value < 0 ||
+                value > std::numeric_limits<std::int64_t>::max()) {
+                return false;
+            }
+
+            amount = static_cast<std::int64_t>(value);
+        } else {
+            const auto backend = shift_right();
+            if (backend < 0 ||
+                backend > std::numeric_limits<std::int64_t>::max()) {
+                return false;
+            }
+
+            try {
+                amount = backend.convert_to<std::int64_t>();
+            } catch (const std::exception& e) {
+                LogError()(OT_PRETTY_CLASS())(
+                    "Error serializing bitcoin amount: ")(e.what())
+                    .Flush();
+                return false;
+            }
         }
+
         const auto buffer = be::little_int64_buf_t(amount);
 
         const auto view =
@@ -205,12 +330,22 @@ public:
 
     auto ToFloat() const noexcept -> amount::Float final
     {
-        return amount::IntegerToFloat(amount_);
+        return amount::IntegerToFloat(integer());
     }
 
     template <typename T>
     auto extract_int() const noexcept -> T
     {
+        if (is_small()) {
+            const auto value = small_shift_right(small_);
+
+            if ((value >= std::numeric_limits<T>::min()) &&
+                (value <= std::numeric_limits<T>::max())) {
+
+                return static_cast<T>(value);
+            }
+        }
+
         try {
             return shift_right().convert_to<T>();
         } catch (const std::exception& e) {
@@ -225,7 +360,7 @@ public:
     auto extract_float() const noexcept -> T
     {
         try {
-            return amount_.convert_to<T>() / shift_left(1).convert_to<T>();
+            return integer().convert_to<T>() / shift_left(1).convert_to<T>();
         } catch (const std::exception& e) {
             LogError()(OT_PRETTY_CLASS())("Error converting Amount to float: ")(
                 e.what())
@@ -248,52 +383,87 @@ public:
 
     auto shift_right() const -> amount::Integer
     {
-        if (amount_ < 0) {
-            auto tmp = -amount_;
+        const auto amount = integer();
+
+        if (amount < 0) {
+            auto tmp = -amount;
             tmp >>= amount::fractional_bits_;
             return -tmp;
         } else {
-            return amount_ >> amount::fractional_bits_;
+            return amount >> amount::fractional_bits_;
         }
     }
 
-    Imp() noexcept
-        : amount_{}
+    auto swap(Imp& rhs) noexcept -> void
     {
+        std::swap(small_, rhs.small_);
+        std::swap(big_, rhs.big_);
     }
-    Imp(const amount::Integer& rhs) noexcept
-        : amount_{rhs}
+
+    Imp() noexcept
+        : small_{0}
+        , big_{}
     {
     }
-    Imp(amount::Integer&& rhs) noexcept
-        : amount_{std::move(rhs)}
+    Imp(const amount::Integer& rhs) noexcept
+        : Imp()
     {
+        set(rhs);
     }
     Imp(long long amount) noexcept
-        : amount_{shift_left(amount)}
+        : Imp()
     {
+        if (auto val = small_shift_left(amount); val) {
+            small_ = *val;
+        } else {
+            set(shift_left(amount));
+        }
     }
 
     Imp(unsigned long long amount) noexcept
-        : amount_{shift_left(amount)}
+        : Imp()
     {
+        if (auto val = small_shift_left(amount); val) {
+            small_ = *val;
+        } else {
+            set(shift_left(amount));
+        }
     }
     Imp(std::string_view str, bool normalize = false) noexcept(false)
-        : amount_{amount::Integer{str}}
+        : Imp()
     {
+        auto amount = amount::Integer{str};
+
         if (normalize) {
-            if (amount_ < 0) {
-                amount_ = -(-amount_ << amount::fractional_bits_);
+            if (amount < 0) {
+                amount = -(-amount << amount::fractional_bits_);
             } else {
-                amount_ <<= amount::fractional_bits_;
+                amount <<= amount::fractional_bits_;
             }
         }
+
+        set(amount);
+    }
+    Imp(const Imp& rhs) noexcept
+        : internal::Amount()
+        , small_{rhs.small_}
+        , big_{
+              rhs.big_ ? std::make_unique<amount::Integer>(*rhs.big_)
+                       : nullptr}
+    {
+    }
+    Imp(Imp&& rhs) noexcept
+        : Imp()
+    {
+        swap(rhs);
     }
-    Imp(const Imp&) noexcept = default;
-    Imp(Imp&& rhs) noexcept = delete;
     auto operator=(const Imp& imp) -> Imp&
     {
-        amount_ = imp.amount_;
+        if (this != &imp) {
+            auto copy = Imp{imp};
+            swap(copy);
+        }
+
         return *this;
     }
     auto operator=(Imp&& rhs) -> Imp& = delete;
@@ -301,6 +471,222 @@ public:
     ~Imp() final = default;
 
 private:
-    amount::Integer amount_;
+    static constexpr auto small_max_ =
+        static_cast<Small>(~Magnitude{0} >> 1u);
+    static constexpr auto small_min_ = -small_max_;
+
+    Small small_;
+    std::unique_ptr<amount::Integer> big_;
+
+    static auto magnitude(const Small value) noexcept -> Magnitude
+    {
+        return (value < 0) ? Magnitude(-value) : Magnitude(value);
+    }
+    static auto small_canonical(const Small value) noexcept
+        -> std::optional<Small>
+    {
+        if (value < small_min_) { return std::nullopt; }
+
+        return value;
+    }
+#if defined(__SIZEOF_INT128__)
+    static auto small_add(const Small lhs, const Small rhs) noexcept
+        -> std::optional<Small>
+    {
+        auto out = Small{};
+
+        if (__builtin_add_overflow(lhs, rhs, &out)) { return std::nullopt; }
+
+        return small_canonical(out);
+    }
+    static auto small_subtract(const Small lhs, const Small rhs) noexcept
+        -> std::optional<Small>
+    {
+        auto out = Small{};
+
+        if (__builtin_sub_overflow(lhs, rhs, &out)) { return std::nullopt; }
+
+        return small_canonical(out);
+    }
+    template <typename T>
+    static auto small_multiply(const Small lhs, const T rhs) noexcept
+        -> std::optional<Small>
+    {
+        auto out = Small{};
+
+        if (__builtin_mul_overflow(lhs, rhs, &out)) { return std::nullopt; }
+
+        return small_canonical(out);
+    }
+    // NOTE calculates (lhs * rhs) >> fractional_bits_ from 64 bit partial
+    // products, truncating towards zero like the Integer implementation
+    static auto small_multiply_fixed(const Small lhs, const Small rhs) noexcept
+        -> std::optional<Small>
+    {
+        using Half = std::uint64_t;
+        constexpr auto bits = amount::fractional_bits_;
+        const auto negative = (lhs < 0) != (rhs < 0);
+        const auto left = magnitude(lhs);
+        const auto right = magnitude(rhs);
+        const auto lh = static_cast<Half>(left >> bits);
+        const auto ll = static_cast<Half>(left);
+        const auto rh = static_cast<Half>(right >> bits);
+        const auto rl = static_cast<Half>(right);
+        const auto high = Magnitude{lh} * Magnitude{rh};
+
+        if (0u != (high >> (bits - 1u))) { return std::nullopt; }
+
+        auto out = high << bits;
+
+        for (const auto term :
+             {Magnitude{lh} * Magnitude{rl},
+              Magnitude{ll} * Magnitude{rh},
+              (Magnitude{ll} * Magnitude{rl}) >> bits}) {
+            if (__builtin_add_overflow(out, term, &out)) {
+                return std::nullopt;
+            }
+        }
+
+        if (out > Magnitude(small_max_)) { return std::nullopt; }
+
+        return negative ? -Small(out) : Small(out);
+    }
+    template <typename T>
+    static auto small_divide(const Small lhs, const T rhs) noexcept
+        -> std::optional<Small>
+    {
+        // NOTE division by zero is left to the Integer implementation so the
+        // same exception is thrown
+        if (0 == rhs) { return std::nullopt; }
+
+        return lhs / Small(rhs);
+    }
+    static auto small_modulo(const Small lhs, const Small rhs) noexcept
+        -> std::optional<Small>
+    {
+        if (0 == rhs) { return std::nullopt; }
+
+        return lhs % rhs;
+    }
+    template <typename T>
+    static auto small_shift_left(const T value) noexcept
+        -> std::optional<Small>
+    {
+        constexpr auto scale = Small{1} << amount::fractional_bits_;
+
+        return small_multiply(Small(value), scale);
+    }
+    static auto small_shift_right(const Small value) noexcept -> Small
+    {
+        const auto out = Small(magnitude(value) >> amount::fractional_bits_);
+
+        return (value < 0) ? -out : out;
+    }
+    static auto to_integer(const Small value) noexcept -> amount::Integer
+    {
+        constexpr auto bits = amount::fractional_bits_;
+        const auto mag = magnitude(value);
+        auto out = amount::Integer{static_cast<std::uint64_t>(mag >> bits)};
+        out <<= bits;
+        out |= amount::Integer{static_cast<std::uint64_t>(mag)};
+
+        return (value < 0) ? -out : out;
+    }
+    static auto to_small(const amount::Integer& value) noexcept
+        -> std::optional<Small>
+    {
+        constexpr auto bits = amount::fractional_bits_;
+        static const auto max = to_integer(small_max_);
+        static const auto min = to_integer(small_min_);
+
+        if ((value > max) || (value < min)) { return std::nullopt; }
+
+        const auto mag = (value < 0) ? amount::Integer{-value} : value;
+        const auto high = (mag >> bits).convert_to<std::uint64_t>();
+        const auto low =
+            (mag & std::numeric_limits<std::uint64_t>::max())
+                .convert_to<std::uint64_t>();
+        const auto out = Small((Magnitude{high} << bits) | Magnitude{low});
+
+        return (value < 0) ? -out : out;
+    }
+#else
+    // NOTE without a native 128 bit type every value uses the Integer backend
+    static auto small_add(const Small, const Small) noexcept
+        -> std::optional<Small>
+    {
+        return std::nullopt;
+    }
+    static auto small_subtract(const Small, const Small) noexcept
+        -> std::optional<Small>
+    {
+        return std::nullopt;
+    }
+    template <typename T>
+    static auto small_multiply(const Small, const T) noexcept
+        -> std::optional<Small>
+    {
+        return std::nullopt;
+    }
+    static auto small_multiply_fixed(const Small, const Small) noexcept
+        -> std::optional<Small>
+    {
+        return std::nullopt;
+    }
+    template <typename T>
+    static auto small_divide(const Small, const T) noexcept
+        -> std::optional<Small>
+    {
+        return std::nullopt;
+    }
+    static auto small_modulo(const Small, const Small) noexcept
+        -> std::optional<Small>
+    {
+        return std::nullopt;
+    }
+    template <typename T>
+    static auto small_shift_left(const T) noexcept -> std::optional<Small>
+    {
+        return std::nullopt;
+    }
+    static auto small_shift_right(const Small value) noexcept -> Small
+    {
+        return value;
+    }
+    static auto to_integer(const Small value) noexcept -> amount::Integer
+    {
+        return value;
+    }
+    static auto to_small(const amount::Integer&) noexcept
+        -> std::optional<Small>
+    {
+        return std::nullopt;
+    }
+#endif
+
+    auto integer() const noexcept -> amount::Integer
+    {
+        if (is_small()) { return to_integer(small_); }
+
+        return *big_;
+    }
+    auto is_small() const noexcept -> bool { return false == bool(big_); }
+    auto set(const amount::Integer& value) noexcept -> void
+    {
+        if (auto val = to_small(value); val) {
+            small_ = *val;
+            big_.reset();
+        } else if (big_) {
+            *big_ = value;
+        } else {
+            big_ = std::make_unique<amount::Integer>(value);
+        }
+    }
+
+    Imp(std::in_place_t, const Small value) noexcept
+        : small_{value}
+        , big_{}
+    {
+    }
 };
 }  // namespace opentxs
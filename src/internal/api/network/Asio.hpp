@@ -30,6 +30,14 @@ namespace opentxs  // NOLINT
 {
 // inline namespace v1
 // {
+namespace network
+{
+namespace zeromq
+{
+class Frame;
+}  // namespace zeromq
+}  // namespace network
+
 class Timer;
 // }  // namespace v1
 }  // namespace opentxs
@@ -80,6 +88,11 @@ public:
         const ReadView id,
         const ReadView bytes,
         Socket socket) noexcept -> bool = 0;
+    virtual auto Transmit(
+        const ReadView id,
+        opentxs::network::zeromq::Frame&& header,
+        opentxs::network::zeromq::Frame&& payload,
+        Socket socket) noexcept -> bool = 0;
 
     Asio(const Asio&) = delete;
     Asio(Asio&&) = delete;
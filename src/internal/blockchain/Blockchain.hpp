@@ -226,6 +226,16 @@ auto GCS(
     const ReadView key,
     const ReadView encoded,
     alloc::Default alloc) noexcept -> blockchain::GCS;
+/// Deserialize a cfilter produced by internal::GCS::SerializeCfilter
+///
+/// If view is true the encoded set is not copied and the returned object
+/// must not outlive the memory referenced by record. Copies of the returned
+/// object always own their data.
+auto GCSFromStorage(
+    const api::Session& api,
+    const ReadView record,
+    const bool view,
+    alloc::Default alloc) noexcept -> blockchain::GCS;
 #endif  // OT_BLOCKCHAIN
 auto NumericHash(const Data& hash) noexcept
     -> std::unique_ptr<blockchain::NumericHash>;
@@ -7,6 +7,19 @@
 
 #include "opentxs/blockchain/bitcoin/block/Block.hpp"
 
+// NOLINTBEGIN(modernize-concat-nested-namespaces)
+namespace opentxs  // NOLINT
+{
+// inline namespace v1
+// {
+namespace api
+{
+class Session;
+}  // namespace api
+// }  // namespace v1
+}  // namespace opentxs
+// NOLINTEND(modernize-concat-nested-namespaces)
+
 namespace opentxs::blockchain::bitcoin::block::internal
 {
 class Block : virtual public bitcoin::block::Block
@@ -14,4 +27,12 @@ class Block : virtual public bitcoin::block::Block
 public:
     ~Block() override = default;
 };
+
+/// Verify the BIP141 witness commitment in the coinbase transaction
+///
+/// Blocks without a commitment are only valid if no transaction carries
+/// witness data. Always succeeds for chains which do not support segwit.
+auto CheckWitnessCommitment(
+    const api::Session& api,
+    const bitcoin::block::Block& block) noexcept -> bool;
 }  // namespace opentxs::blockchain::bitcoin::block::internal
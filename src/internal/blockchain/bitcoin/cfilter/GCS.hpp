@@ -5,10 +5,14 @@
 
 #pragma once
 
+#include <boost/endian/buffers.hpp>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 
 #include "opentxs/blockchain/bitcoin/cfilter/GCS.hpp"
 #include "opentxs/util/Allocator.hpp"
+#include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
@@ -38,23 +42,52 @@ using Hash = std::uint64_t;
 using Hashes = Vector<Hash>;
 using Range = std::uint64_t;
 
+/// Decodes the Golomb-Rice coded set 64 bits at a time
 auto GolombDecode(
     const std::uint32_t N,
     const std::uint8_t P,
     const Vector<std::byte>& encoded,
     alloc::Default alloc) noexcept(false) -> Elements;
+auto GolombDecode(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const ReadView encoded,
+    alloc::Default alloc) noexcept(false) -> Elements;
+/// Reference implementation of GolombDecode which reads one bit at a time
+auto GolombDecodeScalar(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const Vector<std::byte>& encoded,
+    alloc::Default alloc) noexcept(false) -> Elements;
 auto GolombEncode(
     const std::uint8_t P,
     const Elements& hashedSet,
     alloc::Default alloc) noexcept(false) -> Vector<std::byte>;
+/// Merges sorted targets against the encoded set without decompressing it
+///
+/// Returns the subset of targets which are present in the set. Decoding stops
+/// as soon as the largest target has been passed.
+auto GolombMatch(
+    const std::uint32_t N,
+    const std::uint8_t P,
+    const ReadView encoded,
+    const Elements& targets,
+    alloc::Default alloc) noexcept(false) -> Elements;
 auto HashToRange(
     const api::Session& api,
     const ReadView key,
     const Range range,
     const ReadView item) noexcept(false) -> Element;
-auto HashToRange(const Range range, const Hash hash) noexcept(false) -> Element;
+auto HashToRange(const Range range, const Hash hash) noexcept -> Element;
+/// Reduces count hashes into [0, range) as specified by BIP-158
+///
+/// in and out may refer to the same array
+auto HashToRange(
+    const Range range,
+    const Hash* in,
+    const std::size_t count,
+    Element* out) noexcept -> void;
 auto HashedSetConstruct(
-    const api::Session& api,
     const ReadView key,
     const std::uint32_t N,
     const std::uint32_t M,
@@ -64,10 +97,45 @@ auto Siphash(
     const api::Session& api,
     const ReadView key,
     const ReadView item) noexcept(false) -> Hash;
+/// Calculates SipHash-2-4 of every item under a single key
+///
+/// out must have space for items.size() hashes
+auto Siphash(
+    const ReadView key,
+    const blockchain::GCS::Targets& items,
+    Hash* out) noexcept(false) -> void;
+auto Siphash(
+    const ReadView key,
+    const blockchain::GCS::Targets& items,
+    alloc::Default alloc) noexcept(false) -> Hashes;
 }  // namespace opentxs::gcs
 
 namespace opentxs::blockchain::internal
 {
+namespace be = boost::endian;
+
+// Fixed layout header for cfilters stored in bulk storage. The Golomb coded
+// set immediately follows the header. Protobuf encoded cfilters always begin
+// with 0x08 so the version field also distinguishes the two formats.
+struct SerializedCfilter {
+    static constexpr auto current_version_ = std::uint32_t{1};
+
+    be::little_uint32_buf_t version_;
+    be::little_uint32_buf_t fp_rate_;
+    be::little_uint32_buf_t count_;
+    be::little_uint8_buf_t bits_;
+    std::array<std::byte, 16> key_;
+
+    SerializedCfilter(
+        const std::uint8_t bits,
+        const std::uint32_t fpRate,
+        const std::uint32_t count,
+        const ReadView key) noexcept(false);
+    SerializedCfilter() noexcept;
+};
+
+auto IsSerializedCfilter(const ReadView bytes) noexcept -> bool;
+
 class GCS
 {
 public:
@@ -77,6 +145,9 @@ public:
         -> PrehashedMatches = 0;
     virtual auto Range() const noexcept -> gcs::Range = 0;
     virtual auto Serialize(proto::GCS& out) const noexcept -> bool = 0;
+    virtual auto SerializeCfilter(WritableView out) const noexcept
+        -> bool = 0;
+    virtual auto SerializedCfilterSize() const noexcept -> std::size_t = 0;
     virtual auto Test(const gcs::Hashes& targets) const noexcept -> bool = 0;
 
     virtual ~GCS() = default;
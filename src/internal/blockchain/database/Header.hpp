@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include "internal/blockchain/database/Types.hpp"
@@ -73,8 +74,11 @@ public:
     virtual auto TryLoadHeader(const block::Hash& hash) const noexcept
         -> std::unique_ptr<block::Header> = 0;
 
-    virtual auto ApplyUpdate(const node::UpdateTransaction& update) noexcept
-        -> bool = 0;
+    // NOTE committed is executed after the update is written and before any
+    // notifications about the new best chain are sent
+    virtual auto ApplyUpdate(
+        const node::UpdateTransaction& update,
+        const std::function<void()>& committed) noexcept -> bool = 0;
 
     virtual ~Header() = default;
 };
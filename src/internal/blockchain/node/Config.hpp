@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 
 #include "opentxs/blockchain/Types.hpp"
@@ -16,11 +17,30 @@
 
 namespace opentxs::blockchain::node::internal
 {
+/// Counters maintained by the block oracle's in-memory block cache
+struct BlockCacheMetrics {
+    std::atomic<std::size_t> hits_{};
+    std::atomic<std::size_t> misses_{};
+    std::atomic<std::size_t> evictions_{};
+    std::atomic<std::size_t> blocks_{};
+    std::atomic<std::size_t> bytes_{};
+
+    BlockCacheMetrics() noexcept = default;
+    BlockCacheMetrics(const BlockCacheMetrics& rhs) noexcept;
+    auto operator=(const BlockCacheMetrics& rhs) noexcept
+        -> BlockCacheMetrics&;
+};
+
 struct Config {
     BlockchainProfile profile_{BlockchainProfile::desktop};
     bool provide_sync_server_{false};
     bool disable_wallet_{false};
+    /// Byte budget for cached blocks. Zero selects a default based on profile_
+    std::size_t block_cache_bytes_{0};
+    mutable BlockCacheMetrics block_cache_{};
 
+    auto BlockCacheLimit() const noexcept -> std::size_t;
+    auto MempoolLimit() const noexcept -> std::size_t;
     auto PeerTarget(blockchain::Type) const noexcept -> std::size_t;
     auto Print(alloc::Default alloc = {}) const noexcept -> CString;
 };
@@ -5,7 +5,11 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <optional>
 
 #include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
@@ -31,18 +35,44 @@ class Transaction;
 
 namespace opentxs::blockchain::node::internal
 {
+// NOTE all fee rates are measured in satoshis per 1000 virtual bytes
 class Mempool
 {
 public:
+    using ShortID =
+        std::function<std::uint64_t(const bitcoin::block::Transaction&)>;
+    using ShortIDs = UnallocatedUnorderedMap<std::uint64_t, std::size_t>;
+    using Matches = UnallocatedVector<std::pair<
+        std::size_t,
+        std::shared_ptr<const bitcoin::block::Transaction>>>;
+
     virtual auto Dump() const noexcept
         -> UnallocatedSet<UnallocatedCString> = 0;
+    /// Returns a fee rate which would place a transaction in the next block,
+    /// or nothing if too few fees are known to make an estimate
+    virtual auto EstimateFeeRate() const noexcept
+        -> std::optional<std::uint64_t> = 0;
+    /// Returns nothing if the transaction is unknown or if the values of its
+    /// inputs are not known
+    virtual auto FeeRate(ReadView txid) const noexcept
+        -> std::optional<std::uint64_t> = 0;
+    /// Fee rate below which relayed transactions are currently rejected
+    virtual auto MinimumFeeRate() const noexcept -> std::uint64_t = 0;
+    /// Returns every pooled transaction whose short id is present in ids,
+    /// paired with the associated index. An index appears more than once if
+    /// several transactions share the same short id.
+    virtual auto Match(const ShortID& id, const ShortIDs& ids) const noexcept
+        -> Matches = 0;
     virtual auto Query(ReadView txid) const noexcept
         -> std::shared_ptr<const bitcoin::block::Transaction> = 0;
     virtual auto Submit(ReadView txid) const noexcept -> bool = 0;
     virtual auto Submit(const UnallocatedVector<ReadView>& txids) const noexcept
         -> UnallocatedVector<bool> = 0;
-    virtual auto Submit(std::unique_ptr<const bitcoin::block::Transaction> tx)
-        const noexcept -> void = 0;
+    /// Local transactions are never evicted to make room for other
+    /// transactions
+    virtual auto Submit(
+        std::unique_ptr<const bitcoin::block::Transaction> tx,
+        const bool local) const noexcept -> void = 0;
 
     virtual auto Heartbeat() noexcept -> void = 0;
 
@@ -79,6 +79,10 @@ public:
     virtual auto RequestBlocks(
         const UnallocatedVector<ReadView>& hashes) const noexcept -> bool = 0;
     virtual auto RequestHeaders() const noexcept -> bool = 0;
+    // NOTE returns true if the peer may ask the remote node to send BIP152
+    // compact blocks in high bandwidth mode. The grant is released when the
+    // peer disconnects.
+    virtual auto RequestHighBandwidth(const int id) const noexcept -> bool = 0;
     virtual auto VerifyPeer(const int id, const UnallocatedCString& address)
         const noexcept -> void = 0;
 
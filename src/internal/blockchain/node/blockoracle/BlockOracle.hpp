@@ -52,8 +52,10 @@ public:
         -> BitcoinBlockResult final;
     auto LoadBitcoin(const Vector<block::Hash>& hashes) const noexcept
         -> BitcoinBlockResults final;
+    auto Pin(const block::Hash& block) const noexcept -> void;
     auto SubmitBlock(const ReadView in) const noexcept -> void;
     auto Tip() const noexcept -> block::Position final;
+    auto Unpin(const block::Hash& block) const noexcept -> void;
     auto Validate(const bitcoin::block::Block& block) const noexcept
         -> bool final;
 
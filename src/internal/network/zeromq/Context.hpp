@@ -75,10 +75,17 @@ public:
         const std::optional<BatchID>& preallocated = std::nullopt,
         alloc::Default pmr = {}) const noexcept -> zeromq::Pipeline = 0;
     virtual auto RawSocket(socket::Type type) const noexcept -> socket::Raw = 0;
+    // NOTE runs a rebalance pass unless one already ran during the current
+    // interval
+    virtual auto Rebalance() const noexcept -> void = 0;
     virtual auto Start(
         BatchID id,
         StartArgs&& sockets,
         const std::string_view threadname = {}) const noexcept -> Thread* = 0;
+    virtual auto Statistics() const noexcept -> Vector<ThreadStatistics> = 0;
+    // NOTE batches may be migrated between threads to balance load so the
+    // return values of Thread() and ThreadID() are only valid at the time they
+    // are called
     virtual auto Thread(BatchID id) const noexcept -> Thread* = 0;
     virtual auto ThreadID(BatchID id) const noexcept -> std::thread::id = 0;
 
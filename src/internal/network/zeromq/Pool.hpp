@@ -26,6 +26,11 @@ class Handle;
 class Thread;
 }  // namespace internal
 
+namespace socket
+{
+class Raw;
+}  // namespace socket
+
 class Context;
 }  // namespace zeromq
 }  // namespace network
@@ -53,6 +58,11 @@ public:
     virtual auto MakeBatch(
         const BatchID preallocated,
         Vector<socket::Type>&& types) noexcept -> Handle = 0;
+    virtual auto Migrate(BatchID id, ThreadStartArgs&& sockets) noexcept
+        -> void = 0;
+    virtual auto MigrateSockets(BatchID id) noexcept
+        -> Map<void*, socket::Raw*> = 0;
+    virtual auto Rebalance() noexcept -> void = 0;
     virtual auto Shutdown() noexcept -> void = 0;
     virtual auto Start(
         BatchID id,
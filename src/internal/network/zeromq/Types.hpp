@@ -5,9 +5,12 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <future>
+#include <thread>
 #include <tuple>
 
 #include "opentxs/network/zeromq/socket/Types.hpp"
@@ -48,10 +51,25 @@ using EndpointArg = std::pair<CString, socket::Direction>;
 using EndpointArgs = Vector<EndpointArg>;
 using SocketData = std::pair<socket::Type, EndpointArgs>;
 
+struct ThreadStatistics {
+    std::thread::id id_{};
+    // Number of batches currently assigned to the thread
+    std::size_t batches_{};
+    // Number of sockets currently polled by the thread
+    std::size_t sockets_{};
+    // Total number of messages delivered to socket callbacks
+    std::uint64_t messages_{};
+    // Total time spent executing socket callbacks
+    std::chrono::nanoseconds busy_{};
+    // Number of batches migrated to or away from the thread
+    std::uint64_t migrations_{};
+};
+
 enum class Operation : OTZMQWorkType {
     add_socket = OT_ZMQ_INTERNAL_SIGNAL + 0,
     remove_socket = OT_ZMQ_INTERNAL_SIGNAL + 1,
     change_socket = OT_ZMQ_INTERNAL_SIGNAL + 2,
+    migrate_socket = OT_ZMQ_INTERNAL_SIGNAL + 3,
 };
 
 auto GetBatchID() noexcept -> BatchID;
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <irrxml/irrXML.hpp>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <tuple>
@@ -80,6 +81,8 @@ using mapOfTransactions =
 class Ledger : public OTTransactionType
 {
 public:
+    static constexpr auto default_receipt_cache_ = std::size_t{1024};
+
     ledgerType m_Type;
     // So the server can tell if it just loaded a legacy box or a hashed box.
     // (Legacy boxes stored ALL of the receipts IN the box. No more.)
@@ -88,6 +91,16 @@ public:
     inline auto GetType() const -> ledgerType { return m_Type; }
 
     auto LoadedLegacyData() const -> bool { return m_bLoadedLegacyData; }
+    auto IsLazy() const -> bool { return lazy_; }
+
+    // NOTE in lazy mode the ledger only holds the abbreviated records it was
+    // loaded with. LoadBoxReceipts only checks that a box receipt exists for
+    // each of them, and full receipts are loaded on demand by GetTransaction,
+    // GetTransactionByIndex, and the Get*Receipt functions, which keep up to
+    // cacheSize of them in memory. GetTransactionMap always returns the
+    // abbreviated records.
+    auto EnableLazyReceipts(
+        const std::size_t cacheSize = default_receipt_cache_) -> void;
 
     // This function assumes that this is an INBOX.
     // If you don't use an INBOX to call this method, then it will return
@@ -275,9 +288,39 @@ private:  // Private prevents erroneous use by other classes.
     friend api::session::imp::Factory;
 
     using ot_super = OTTransactionType;
+    using Position = mapOfTransactions::const_iterator;
+
+    struct Index {
+        bool valid_{};
+        UnallocatedVector<Position> position_{};
+        UnallocatedUnorderedMap<TransactionNumber, std::int32_t> number_{};
+    };
+    struct CachedReceipt {
+        std::shared_ptr<OTTransaction> receipt_{};
+        UnallocatedList<TransactionNumber>::iterator recent_{};
+    };
+    struct ReceiptCache {
+        std::size_t capacity_{};
+        UnallocatedUnorderedMap<TransactionNumber, CachedReceipt> receipts_{};
+        // NOTE most recently used first
+        UnallocatedList<TransactionNumber> recent_{};
+    };
 
     mapOfTransactions m_mapTransactions;  // a ledger contains a map of
                                           // transactions.
+    bool lazy_;
+    mutable Index index_;
+    mutable ReceiptCache receipt_cache_;
+
+    auto find(const TransactionNumber number) const -> Position;
+    auto get_index() const -> const Index&;
+    auto invalidate(const TransactionNumber number) const -> void;
+    // NOTE returns the full receipt for an abbreviated record in lazy mode,
+    // otherwise (or if the receipt can not be loaded) returns the argument
+    auto receipt(
+        const TransactionNumber number,
+        const std::shared_ptr<OTTransaction>& transaction) const
+        -> std::shared_ptr<OTTransaction>;
 
     auto make_filename(const ledgerType theType) -> std::
         tuple<bool, UnallocatedCString, UnallocatedCString, UnallocatedCString>;
@@ -22,6 +22,7 @@ Socket::Imp::Imp(const Endpoint& endpoint, Asio& asio) noexcept
     : endpoint_(endpoint)
     , asio_(asio)
     , socket_(asio_.IOContext())
+    , write_queue_()
 {
 }
 
@@ -29,6 +30,7 @@ Socket::Imp::Imp(Asio& asio, Endpoint&& endpoint, tcp::socket&& socket) noexcept
     : endpoint_(std::move(endpoint))
     , asio_(asio)
     , socket_(std::move(socket))
+    , write_queue_()
 {
 }
 
@@ -81,6 +83,15 @@ auto Socket::Imp::Transmit(const ReadView notify, const ReadView data) noexcept
     return asio_.Transmit(notify, data, shared_from_this());
 }
 
+auto Socket::Imp::Transmit(
+    const ReadView notify,
+    zeromq::Frame&& header,
+    zeromq::Frame&& payload) noexcept -> bool
+{
+    return asio_.Transmit(
+        notify, std::move(header), std::move(payload), shared_from_this());
+}
+
 Socket::Imp::~Imp() { Close(); }
 
 Socket::Socket(std::function<void*()>&& builder) noexcept
@@ -116,6 +127,15 @@ auto Socket::Transmit(const ReadView notify, const ReadView data) noexcept
     return Imp::Get(imp_).Transmit(notify, data);
 }
 
+auto Socket::Transmit(
+    const ReadView notify,
+    zeromq::Frame&& header,
+    zeromq::Frame&& payload) noexcept -> bool
+{
+    return Imp::Get(imp_).Transmit(
+        notify, std::move(header), std::move(payload));
+}
+
 Socket::~Socket()
 {
     if (nullptr != imp_) { Imp::Destroy(imp_); }
@@ -8,12 +8,15 @@
 #pragma once
 
 #include <boost/asio.hpp>
+#include <cs_plain_guarded.h>
 #include <cstddef>
 #include <iosfwd>
 #include <memory>
 
 #include "opentxs/network/asio/Socket.hpp"
+#include "opentxs/network/zeromq/message/Frame.hpp"
 #include "opentxs/util/Bytes.hpp"
+#include "opentxs/util/Container.hpp"
 #include "opentxs/util/WorkType.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
@@ -54,9 +57,21 @@ public:
     using Asio = api::network::internal::Asio;
     using tcp = ip::tcp;
 
+    struct Outgoing {
+        Space notify_{};
+        zeromq::Frame header_{};
+        zeromq::Frame payload_{};
+    };
+
+    struct WriteQueue {
+        UnallocatedDeque<Outgoing> queue_{};
+        bool writing_{};
+    };
+
     const Endpoint& endpoint_;
     api::network::internal::Asio& asio_;
     tcp::socket socket_;
+    libguarded::plain_guarded<WriteQueue> write_queue_;
 
     static auto Destroy(void* imp) noexcept -> void;
     static auto Get(void* imp) noexcept -> Imp&;
@@ -68,6 +83,10 @@ public:
         const OTZMQWorkType type,
         const std::size_t bytes) noexcept -> bool;
     auto Transmit(const ReadView notify, const ReadView data) noexcept -> bool;
+    auto Transmit(
+        const ReadView notify,
+        zeromq::Frame&& header,
+        zeromq::Frame&& payload) noexcept -> bool;
 
     Imp(const Endpoint& endpoint, Asio& asio) noexcept;
     Imp(Asio& asio, Endpoint&& endpoint, tcp::socket&& socket) noexcept;
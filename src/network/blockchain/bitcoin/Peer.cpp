@@ -11,8 +11,10 @@
 #include <boost/smart_ptr/shared_ptr.hpp>
 #include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <future>
 #include <iterator>
+#include <optional>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
@@ -27,8 +29,11 @@
 #include "blockchain/bitcoin/p2p/message/Merkleblock.hpp"
 #include "blockchain/bitcoin/p2p/message/Reject.hpp"
 #include "blockchain/bitcoin/p2p/message/Sendcmpct.hpp"
+#include "blockchain/node/MempoolPolicy.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/Params.hpp"
+#include "internal/blockchain/bitcoin/Bitcoin.hpp"
+#include "internal/blockchain/bitcoin/block/Block.hpp"
 #include "internal/blockchain/bitcoin/block/Transaction.hpp"
 #include "internal/blockchain/database/Peer.hpp"
 #include "internal/blockchain/node/Config.hpp"
@@ -48,7 +53,9 @@
 #include "internal/util/P0330.hpp"
 #include "network/blockchain/bitcoin/Peer.tpp"
 #include "opentxs/OT.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
 #include "opentxs/api/network/Network.hpp"
+#include "opentxs/api/session/Crypto.hpp"
 #include "opentxs/api/session/Factory.hpp"
 #include "opentxs/api/session/Session.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
@@ -68,6 +75,8 @@
 #include "opentxs/blockchain/node/Types.hpp"
 #include "opentxs/core/ByteArray.hpp"
 #include "opentxs/core/FixedByteArray.hpp"
+#include "opentxs/crypto/HashType.hpp"
+#include "opentxs/network/blockchain/bitcoin/CompactSize.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/message/Frame.hpp"
 #include "opentxs/network/zeromq/message/FrameSection.hpp"
@@ -80,6 +89,7 @@
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/Types.hpp"
 #include "util/ScopeGuard.hpp"
+#include "util/Sodium.hpp"
 #include "util/Work.hpp"
 
 namespace opentxs::factory
@@ -229,14 +239,39 @@ Peer::Peer(
             return Type::MsgTx;
         }
     }())
+    , cmpct_version_([&]() -> std::uint64_t {
+        const auto& segwit =
+            opentxs::blockchain::params::Chains().at(chain_).segwit_;
+
+        if (segwit) {
+
+            return 2u;
+        } else {
+
+            return 1u;
+        }
+    }())
     , protocol_((0 == protocol) ? default_protocol_version_ : protocol)
     , local_services_(get_local_services(protocol_, chain_, config))
     , relay_(true)
     , handshake_()
     , verification_()
+    , fee_filter_(0)
+    , fee_filter_sent_()
+    , cmpct_relay_()
+    , cmpct_block_()
 {
 }
 
+auto Peer::below_fee_filter(ReadView txid) const noexcept -> bool
+{
+    if (0u == fee_filter_) { return false; }
+
+    using opentxs::blockchain::node::MempoolPolicy;
+
+    return MempoolPolicy::BelowFeeFilter(mempool_.FeeRate(txid), fee_filter_);
+}
+
 auto Peer::check_handshake() noexcept -> void
 {
     if (handshake_.got_version_ && handshake_.got_verack_) {
@@ -253,6 +288,141 @@ auto Peer::check_verification() noexcept -> void
     if (verified) { transition_state_run(); }
 }
 
+auto Peer::cmpct_fill_from_mempool(
+    ReadView header,
+    ReadView nonce,
+    const UnallocatedUnorderedMap<std::uint64_t, std::size_t>& shortIDs,
+    CompactBlock& block) const noexcept -> void
+{
+    const auto key = [&] {
+        auto preimage = Space{};
+        preimage.reserve(header.size() + nonce.size());
+
+        for (const auto& view : {header, nonce}) {
+            const auto* it = reinterpret_cast<const std::byte*>(view.data());
+            preimage.insert(preimage.end(), it, std::next(it, view.size()));
+        }
+        auto digest = Space{};
+        api_.Crypto().Hash().Digest(
+            opentxs::crypto::HashType::Sha256,
+            reader(preimage),
+            writer(digest));
+
+        return crypto::sodium::MakeSiphashKey(reader(digest));
+    }();
+    // NOTE a short id which matches more than one mempool transaction is
+    // treated as missing so the correct transaction is downloaded instead
+    auto collisions = UnallocatedSet<std::size_t>{};
+
+    const auto matches = mempool_.Match(
+        [&](const auto& tx) { return cmpct_short_id(key, tx); }, shortIDs);
+
+    for (const auto& [index, tx] : matches) {
+        OT_ASSERT(tx);
+
+        auto& slot = block.transactions_.at(index);
+
+        if (slot.has_value()) {
+            collisions.emplace(index);
+
+            continue;
+        }
+
+        auto bytes = Space{};
+
+        if (tx->Internal().Serialize(writer(bytes)).has_value()) {
+            slot.emplace(std::move(bytes));
+        }
+    }
+
+    for (const auto index : collisions) {
+        block.transactions_.at(index).reset();
+    }
+
+    block.missing_.clear();
+
+    for (auto i = 0_uz, stop = block.transactions_.size(); i < stop; ++i) {
+        if (false == block.transactions_.at(i).has_value()) {
+            block.missing_.emplace_back(i);
+        }
+    }
+}
+
+auto Peer::cmpct_finish() noexcept -> void
+{
+    OT_ASSERT(cmpct_block_.has_value());
+
+    const auto compact = std::move(*cmpct_block_);
+    cmpct_block_.reset();
+
+    OT_ASSERT(compact.missing_.empty());
+
+    const auto serialized = [&] {
+        const auto count =
+            CompactSize{compact.transactions_.size()}.Encode();
+        auto out = Space{};
+        out.insert(out.end(), compact.header_.begin(), compact.header_.end());
+        out.insert(out.end(), count.begin(), count.end());
+
+        for (const auto& tx : compact.transactions_) {
+            OT_ASSERT(tx.has_value());
+
+            out.insert(out.end(), tx->begin(), tx->end());
+        }
+
+        return out;
+    }();
+
+    // NOTE the parser verifies the merkle root which only commits to txids. A
+    // short id which matched a mempool transaction with the right txid but
+    // different witness data is only detected by the witness commitment.
+    const auto valid = [&] {
+        const auto block =
+            api_.Factory().BitcoinBlock(chain_, reader(serialized));
+
+        if (false == bool(block)) { return false; }
+
+        using opentxs::blockchain::bitcoin::block::internal::
+            CheckWitnessCommitment;
+
+        return CheckWitnessCommitment(api_, *block);
+    }();
+
+    if (false == valid) {
+        log_(OT_PRETTY_CLASS())(name_)(": failed to reconstruct block ")
+            .asHex(compact.hash_)(", requesting full block")
+            .Flush();
+        using Inv = opentxs::blockchain::bitcoin::Inventory;
+        transmit_protocol_getdata(Inv{inv_block_, compact.hash_});
+
+        return;
+    }
+
+    log_(OT_PRETTY_CLASS())(name_)(": reconstructed block ")
+        .asHex(compact.hash_)
+        .Flush();
+    update_block_job(reader(serialized));
+    using Task = opentxs::blockchain::node::ManagerJobs;
+    network_.Submit([&] {
+        auto work = MakeWork(Task::SubmitBlock);
+        work.AddFrame(serialized.data(), serialized.size());
+
+        return work;
+    }());
+}
+
+auto Peer::cmpct_short_id(
+    const crypto::sodium::SiphashKey& key,
+    const opentxs::blockchain::bitcoin::block::Transaction& tx) const noexcept
+    -> std::uint64_t
+{
+    const auto& id = (1u < cmpct_version_) ? tx.WTXID() : tx.ID();
+    static constexpr auto mask =
+        (std::uint64_t{1} << (8u * cmpct_short_id_bytes_)) - 1u;
+
+    return crypto::sodium::Siphash(key, id.Bytes()) & mask;
+}
+
 auto Peer::commands() noexcept -> const CommandMap&
 {
     static const auto map = CommandMap{
@@ -558,8 +728,64 @@ auto Peer::process_protocol_blocktxn(
     using Type = opentxs::blockchain::p2p::bitcoin::message::internal::Blocktxn;
     const auto pMessage = instantiate<Type>(
         std::move(header), protocol_, payload.data(), payload.size());
-    [[maybe_unused]] const auto& message = *pMessage;
-    // TODO
+    const auto& message = *pMessage;
+    const auto bytes = message.BlockTransactions();
+    const auto total = bytes.size();
+    const auto* it = reinterpret_cast<ByteIterator>(bytes.data());
+    auto expected = opentxs::blockchain::block::Hash::payload_size_ + 1_uz;
+
+    if (expected > total) {
+        throw std::runtime_error{"blocktxn message too small"};
+    }
+
+    const auto hash = opentxs::blockchain::block::Hash{ReadView{
+        reinterpret_cast<const char*>(it),
+        opentxs::blockchain::block::Hash::payload_size_}};
+    std::advance(it, opentxs::blockchain::block::Hash::payload_size_);
+
+    if ((false == cmpct_block_.has_value()) || (cmpct_block_->hash_ != hash)) {
+        log_(OT_PRETTY_CLASS())(name_)(": ignoring unrequested transactions "
+                                       "for block ")
+            .asHex(hash)
+            .Flush();
+
+        return;
+    }
+
+    auto& compact = *cmpct_block_;
+    auto count = 0_uz;
+
+    if (false == DecodeSize(it, expected, total, count)) {
+        throw std::runtime_error{"invalid transaction count"};
+    }
+
+    if (count != compact.missing_.size()) {
+        log_(OT_PRETTY_CLASS())(name_)(": wrong number of transactions for "
+                                       "block ")
+            .asHex(hash)(", requesting full block")
+            .Flush();
+        using Inv = opentxs::blockchain::bitcoin::Inventory;
+        transmit_protocol_getdata(Inv{inv_block_, hash});
+        cmpct_block_.reset();
+
+        return;
+    }
+
+    for (const auto index : compact.missing_) {
+        const auto tx = opentxs::blockchain::bitcoin::EncodedTransaction::
+            Deserialize(
+                api_,
+                chain_,
+                ReadView{
+                    reinterpret_cast<const char*>(it), total - expected});
+        const auto txBytes = tx.size();
+        compact.transactions_.at(index).emplace(it, std::next(it, txBytes));
+        std::advance(it, txBytes);
+        expected += txBytes;
+    }
+
+    compact.missing_.clear();
+    cmpct_finish();
 }
 
 auto Peer::process_protocol_cfcheckpt(
@@ -751,7 +977,165 @@ auto Peer::process_protocol_cmpctblock(
     const auto pMessage = instantiate<Type>(
         std::move(header), protocol_, payload.data(), payload.size());
     [[maybe_unused]] const auto& message = *pMessage;
-    // TODO
+    // NOTE Cmpctblock only holds the raw payload so it is decoded here
+    const auto total = payload.size();
+    const auto* it = reinterpret_cast<ByteIterator>(payload.data());
+    auto expected = cmpct_header_bytes_ + cmpct_nonce_bytes_ + 1_uz;
+
+    if (expected > total) {
+        throw std::runtime_error{"cmpctblock message too small"};
+    }
+
+    const auto headerBytes =
+        ReadView{reinterpret_cast<const char*>(it), cmpct_header_bytes_};
+    std::advance(it, cmpct_header_bytes_);
+    const auto nonce =
+        ReadView{reinterpret_cast<const char*>(it), cmpct_nonce_bytes_};
+    std::advance(it, cmpct_nonce_bytes_);
+    const auto pBlockHeader = api_.Factory().BlockHeader(chain_, headerBytes);
+
+    if (false == bool(pBlockHeader)) {
+        throw std::runtime_error{"invalid block header in cmpctblock"};
+    }
+
+    const auto& hash = pBlockHeader->Hash();
+    add_known_block(hash);
+
+    if (cmpct_block_.has_value()) {
+        if (cmpct_block_->hash_ == hash) { return; }
+
+        // NOTE only one block per peer may be awaiting a blocktxn response
+        using Inv = opentxs::blockchain::bitcoin::Inventory;
+        transmit_protocol_getdata(Inv{inv_block_, cmpct_block_->hash_});
+        cmpct_block_.reset();
+    }
+
+    auto compact = CompactBlock{};
+    compact.hash_ = hash;
+    copy(headerBytes, writer(compact.header_));
+    auto shortIDCount = 0_uz;
+
+    if (false == DecodeSize(it, expected, total, shortIDCount)) {
+        throw std::runtime_error{"invalid short id count"};
+    }
+
+    expected += shortIDCount * cmpct_short_id_bytes_;
+
+    if (expected > total) { throw std::runtime_error{"short ids incomplete"}; }
+
+    auto shortIDs = UnallocatedVector<std::uint64_t>{};
+    shortIDs.reserve(shortIDCount);
+
+    for (auto i = 0_uz; i < shortIDCount; ++i) {
+        auto id = std::uint64_t{0};
+
+        for (auto b = 0_uz; b < cmpct_short_id_bytes_; ++b) {
+            const auto byte = std::to_integer<std::uint64_t>(*it);
+            id |= byte << (8u * b);
+            std::advance(it, 1);
+        }
+
+        shortIDs.emplace_back(id);
+    }
+
+    expected += 1_uz;
+
+    if (expected > total) {
+        throw std::runtime_error{"prefilled transactions missing"};
+    }
+
+    auto prefilledCount = 0_uz;
+
+    if (false == DecodeSize(it, expected, total, prefilledCount)) {
+        throw std::runtime_error{"invalid prefilled transaction count"};
+    }
+
+    const auto txCount = shortIDCount + prefilledCount;
+
+    if ((0_uz == txCount) || (prefilledCount > total)) {
+        throw std::runtime_error{"invalid transaction count"};
+    }
+
+    compact.transactions_.resize(txCount);
+
+    for (auto i = 0_uz, next = 0_uz; i < prefilledCount; ++i) {
+        expected += 1_uz;
+
+        if (expected > total) {
+            throw std::runtime_error{"prefilled transactions incomplete"};
+        }
+
+        auto offset = 0_uz;
+
+        if (false == DecodeSize(it, expected, total, offset)) {
+            throw std::runtime_error{"invalid prefilled transaction index"};
+        }
+
+        // NOTE indices are differentially encoded
+        const auto index = next + offset;
+
+        if ((index < next) || (index >= txCount)) {
+            throw std::runtime_error{"prefilled transaction index overflow"};
+        }
+
+        const auto tx = opentxs::blockchain::bitcoin::EncodedTransaction::
+            Deserialize(
+                api_,
+                chain_,
+                ReadView{
+                    reinterpret_cast<const char*>(it), total - expected});
+        const auto txBytes = tx.size();
+        compact.transactions_.at(index).emplace(it, std::next(it, txBytes));
+        std::advance(it, txBytes);
+        expected += txBytes;
+        next = index + 1_uz;
+    }
+
+    const auto slots = [&] {
+        auto out = UnallocatedUnorderedMap<std::uint64_t, std::size_t>{};
+        auto id = shortIDs.begin();
+
+        for (auto i = 0_uz; i < txCount; ++i) {
+            if (compact.transactions_.at(i).has_value()) { continue; }
+
+            OT_ASSERT(shortIDs.end() != id);
+
+            if (false == out.try_emplace(*id, i).second) {
+                // NOTE BIP152 requires falling back to a full block
+                // download if the short ids of a block are not unique
+
+                return std::optional<decltype(out)>{};
+            }
+
+            ++id;
+        }
+
+        return std::make_optional(std::move(out));
+    }();
+
+    if (false == slots.has_value()) {
+        log_(OT_PRETTY_CLASS())(name_)(": short id collision in block ")
+            .asHex(hash)(", requesting full block")
+            .Flush();
+        using Inv = opentxs::blockchain::bitcoin::Inventory;
+        transmit_protocol_getdata(Inv{inv_block_, hash});
+
+        return;
+    }
+
+    cmpct_fill_from_mempool(headerBytes, nonce, *slots, compact);
+    log_(OT_PRETTY_CLASS())(name_)(": received compact block ")
+        .asHex(hash)(" with ")(txCount)(" transactions, ")(
+            compact.missing_.size())(" not found in mempool")
+        .Flush();
+    const auto complete = compact.missing_.empty();
+    cmpct_block_.emplace(std::move(compact));
+
+    if (complete) {
+        cmpct_finish();
+    } else {
+        transmit_protocol_getblocktxn(hash, cmpct_block_->missing_);
+    }
 }
 
 auto Peer::process_protocol_feefilter(
@@ -761,8 +1145,11 @@ auto Peer::process_protocol_feefilter(
     using Type = opentxs::blockchain::p2p::bitcoin::message::Feefilter;
     const auto pMessage = instantiate<Type>(
         std::move(header), protocol_, payload.data(), payload.size());
-    [[maybe_unused]] const auto& message = *pMessage;
-    // TODO
+    const auto& message = *pMessage;
+    fee_filter_ = message.feeRate();
+    log_(OT_PRETTY_CLASS())(name_)(": peer requested minimum fee rate of ")(
+        fee_filter_)
+        .Flush();
 }
 
 auto Peer::process_protocol_filteradd(
@@ -828,8 +1215,58 @@ auto Peer::process_protocol_getblocktxn(
     using Type = opentxs::blockchain::p2p::bitcoin::message::Getblocktxn;
     const auto pMessage = instantiate<Type>(
         std::move(header), protocol_, payload.data(), payload.size());
-    [[maybe_unused]] const auto& message = *pMessage;
-    // TODO
+    const auto& message = *pMessage;
+    const auto hash =
+        opentxs::blockchain::block::Hash{message.getBlockHash().Bytes()};
+    auto future = block_oracle_.LoadBitcoin(hash);
+
+    if (false == IsReady(future)) {
+        log_(OT_PRETTY_CLASS())(name_)(": block ")
+            .asHex(hash)(" is not available")
+            .Flush();
+
+        return;
+    }
+
+    const auto pBlock = future.get();
+
+    OT_ASSERT(pBlock);
+
+    const auto& block = *pBlock;
+    const auto& indices = message.getIndices();
+    auto serialized = Space{};
+    copy(hash.Bytes(), writer(serialized));
+    const auto count = CompactSize{indices.size()}.Encode();
+    serialized.insert(serialized.end(), count.begin(), count.end());
+
+    auto next = 0_uz;
+
+    // NOTE indices are differentially encoded
+    for (const auto offset : indices) {
+        const auto index = next + offset;
+
+        if ((index < next) || (index >= block.size())) {
+            disconnect("requested transaction index out of range");
+
+            return;
+        }
+
+        const auto& tx = block.at(index);
+
+        OT_ASSERT(tx);
+
+        auto bytes = Space{};
+
+        if (false == tx->Internal().Serialize(writer(bytes)).has_value()) {
+            throw std::runtime_error{"failed to serialize transaction"};
+        }
+
+        serialized.insert(serialized.end(), bytes.begin(), bytes.end());
+        next = index + 1_uz;
+    }
+
+    transmit_protocol_blocktxn(
+        api_.Factory().DataFromBytes(reader(serialized)));
 }
 
 auto Peer::process_protocol_getcfcheckpt(
@@ -1252,7 +1689,14 @@ auto Peer::process_protocol_inv(
                                 ": downloading block ")
                                 .asHex(block)
                                 .Flush();
-                            transmit_protocol_getdata(Inv{inv.type_, block});
+
+                            if (0u < cmpct_relay_.version_) {
+                                transmit_protocol_getdata(
+                                    Inv{Kind::MsgCmpctBlock, block});
+                            } else {
+                                transmit_protocol_getdata(
+                                    Inv{inv.type_, block});
+                            }
                         }
                     } break;
                     default: {
@@ -1379,8 +1823,13 @@ auto Peer::process_protocol_sendcmpct(
     using Type = opentxs::blockchain::p2p::bitcoin::message::Sendcmpct;
     const auto pMessage = instantiate<Type>(
         std::move(header), protocol_, payload.data(), payload.size());
-    [[maybe_unused]] const auto& message = *pMessage;
-    // TODO
+    const auto& message = *pMessage;
+
+    // NOTE peers announce every version they support, in order of preference
+    if (message.version() != cmpct_version_) { return; }
+
+    cmpct_relay_.version_ = message.version();
+    cmpct_relay_.high_bandwidth_ = message.announce();
 }
 
 auto Peer::process_protocol_sendheaders(
@@ -1405,7 +1854,7 @@ auto Peer::process_protocol_tx(
 
     if (auto tx = message.Transaction(); tx) {
         add_known_tx(Txid{tx->ID().Bytes()});
-        mempool_.Submit(std::move(tx));
+        mempool_.Submit(std::move(tx), false);
     }
 }
 
@@ -1491,7 +1940,11 @@ auto Peer::reconcile_mempool() noexcept -> void
     transmit_protocol_inv([&] {
         auto out = UnallocatedVector<Inv>{};
 
-        for (const auto& hash : missing) { out.emplace_back(inv_tx_, hash); }
+        for (const auto& hash : missing) {
+            if (below_fee_filter(hash.Bytes())) { continue; }
+
+            out.emplace_back(inv_tx_, hash);
+        }
 
         return out;
     }());
@@ -1523,6 +1976,10 @@ auto Peer::transition_state_verify() noexcept -> void
 {
     Imp::transition_state_verify();
 
+    if (cmpct_min_protocol_ <= protocol_) { transmit_protocol_sendcmpct(); }
+
+    transmit_protocol_feefilter();
+
     if (Dir::incoming == dir_) {
         log_(OT_PRETTY_CLASS())(name_)(
             " is not required to validate checkpoints")
@@ -1549,7 +2006,12 @@ auto Peer::transmit_block_hash(opentxs::blockchain::block::Hash&& hash) noexcept
     transmit_protocol_inv(Inv{inv_block_, std::move(hash)});
 }
 
-auto Peer::transmit_ping() noexcept -> void { transmit_protocol_ping(); }
+auto Peer::transmit_ping() noexcept -> void
+{
+    transmit_protocol_ping();
+    // NOTE the ping interval also paces updates to the local fee filter
+    transmit_protocol_feefilter();
+}
 
 auto Peer::transmit_protocol_block(const Data& serialized) noexcept -> void
 {
@@ -1557,6 +2019,12 @@ auto Peer::transmit_protocol_block(const Data& serialized) noexcept -> void
     transmit_protocol<Type>(serialized);
 }
 
+auto Peer::transmit_protocol_blocktxn(const Data& serialized) noexcept -> void
+{
+    using Type = opentxs::blockchain::p2p::bitcoin::message::internal::Blocktxn;
+    transmit_protocol<Type>(serialized);
+}
+
 auto Peer::transmit_protocol_cfheaders(
     opentxs::blockchain::cfilter::Type type,
     const opentxs::blockchain::block::Hash& stop,
@@ -1577,12 +2045,52 @@ auto Peer::transmit_protocol_cfilter(
     transmit_protocol<Type>(type, hash, filter);
 }
 
+auto Peer::transmit_protocol_feefilter() noexcept -> void
+{
+    if (feefilter_min_protocol_ > protocol_) { return; }
+
+    const auto rate = mempool_.MinimumFeeRate();
+
+    if (fee_filter_sent_.has_value() && (fee_filter_sent_.value() == rate)) {
+
+        return;
+    }
+
+    using Type = opentxs::blockchain::p2p::bitcoin::message::Feefilter;
+    transmit_protocol<Type>(rate);
+    fee_filter_sent_ = rate;
+}
+
 auto Peer::transmit_protocol_getaddr() noexcept -> void
 {
     using Type = opentxs::blockchain::p2p::bitcoin::message::internal::Getaddr;
     transmit_protocol<Type>();
 }
 
+auto Peer::transmit_protocol_getblocktxn(
+    const opentxs::blockchain::block::Hash& block,
+    const UnallocatedVector<std::size_t>& indices) noexcept -> void
+{
+    using Type = opentxs::blockchain::p2p::bitcoin::message::Getblocktxn;
+    // NOTE the message serializes indices as given, so they must be
+    // differentially encoded here
+    const auto encoded = [&] {
+        auto out = UnallocatedVector<std::size_t>{};
+        out.reserve(indices.size());
+        auto next = 0_uz;
+
+        for (const auto index : indices) {
+            OT_ASSERT(index >= next);
+
+            out.emplace_back(index - next);
+            next = index + 1_uz;
+        }
+
+        return out;
+    }();
+    transmit_protocol<Type>(block, encoded);
+}
+
 auto Peer::transmit_protocol_getcfheaders(
     const opentxs::blockchain::block::Height start,
     const opentxs::blockchain::block::Hash& stop) noexcept -> void
@@ -1714,6 +2222,19 @@ auto Peer::transmit_protocol_pong(
     transmit_protocol<Type>(nonce);
 }
 
+auto Peer::transmit_protocol_sendcmpct() noexcept -> void
+{
+    // NOTE only the server profile downloads every new block. High bandwidth
+    // mode is only requested from outgoing peers since those were selected
+    // locally, and from no more than three of them at a time as required by
+    // BIP152. The remaining peers announce new blocks with inv or headers.
+    if (BlockchainProfile::server != config_.profile_) { return; }
+
+    const auto announce = (Dir::outgoing == dir_) && request_high_bandwidth();
+    using Type = opentxs::blockchain::p2p::bitcoin::message::Sendcmpct;
+    transmit_protocol<Type>(announce, cmpct_version_);
+}
+
 auto Peer::transmit_protocol_tx(ReadView serialized) noexcept -> void
 {
     using Type = opentxs::blockchain::p2p::bitcoin::message::internal::Tx;
@@ -1801,6 +2322,8 @@ auto Peer::transmit_request_peers() noexcept -> void
 
 auto Peer::transmit_txid(const Txid& txid) noexcept -> void
 {
+    if (below_fee_filter(txid.Bytes())) { return; }
+
     using Inv = opentxs::blockchain::bitcoin::Inventory;
     transmit_protocol_inv(Inv{inv_tx_, txid});
 }
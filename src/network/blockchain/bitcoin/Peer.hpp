@@ -7,7 +7,9 @@
 
 #include <robin_hood.h>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <string_view>
 
 #include "blockchain/bitcoin/Inventory.hpp"
@@ -30,6 +32,7 @@
 #include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
 #include "util/Actor.hpp"
+#include "util/Sodium.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs  // NOLINT
@@ -48,6 +51,7 @@ namespace bitcoin
 namespace block
 {
 class Header;
+class Transaction;
 }  // namespace block
 
 class Inventory;
@@ -147,6 +151,19 @@ private:
         void (Peer::*)(std::unique_ptr<HeaderType>, zeromq::Frame&&);
     using CommandMap = robin_hood::unordered_flat_map<Command, CommandFunction>;
 
+    // NOTE block being reconstructed from a BIP152 cmpctblock message
+    struct CompactBlock {
+        opentxs::blockchain::block::Hash hash_{};
+        Space header_{};
+        UnallocatedVector<std::optional<Space>> transactions_{};
+        // NOTE absolute indices of the empty elements of transactions_
+        UnallocatedVector<std::size_t> missing_{};
+    };
+    struct CompactRelay {
+        // NOTE zero if the peer has not offered a compatible version
+        std::uint64_t version_{0};
+        bool high_bandwidth_{false};
+    };
     struct Handshake {
         bool got_version_{false};
         bool got_verack_{false};
@@ -179,6 +196,13 @@ private:
     static constexpr auto default_protocol_version_ =
         opentxs::blockchain::p2p::bitcoin::ProtocolVersion{70015};
     static constexpr auto max_inv_ = 50000_uz;
+    static constexpr auto feefilter_min_protocol_ =
+        opentxs::blockchain::p2p::bitcoin::ProtocolVersion{70013};
+    static constexpr auto cmpct_min_protocol_ =
+        opentxs::blockchain::p2p::bitcoin::ProtocolVersion{70014};
+    static constexpr auto cmpct_header_bytes_ = 80_uz;
+    static constexpr auto cmpct_nonce_bytes_ = 8_uz;
+    static constexpr auto cmpct_short_id_bytes_ = 6_uz;
 
     const opentxs::blockchain::node::internal::Mempool& mempool_;
     const CString user_agent_;
@@ -186,11 +210,17 @@ private:
     const opentxs::blockchain::p2p::bitcoin::Nonce nonce_;
     const opentxs::blockchain::bitcoin::Inventory::Type inv_block_;
     const opentxs::blockchain::bitcoin::Inventory::Type inv_tx_;
+    const std::uint64_t cmpct_version_;
     opentxs::blockchain::p2p::bitcoin::ProtocolVersion protocol_;
     UnallocatedSet<opentxs::blockchain::p2p::Service> local_services_;
     bool relay_;
     Handshake handshake_;
     Verification verification_;
+    // NOTE minimum fee rate requested by the remote peer
+    std::uint64_t fee_filter_;
+    std::optional<std::uint64_t> fee_filter_sent_;
+    CompactRelay cmpct_relay_;
+    std::optional<CompactBlock> cmpct_block_;
 
     static auto commands() noexcept -> const CommandMap&;
     static auto get_local_services(
@@ -204,7 +234,18 @@ private:
         noexcept(false) -> std::unique_ptr<Incoming>;
 
     auto check_handshake() noexcept -> void final;
+    auto cmpct_fill_from_mempool(
+        ReadView header,
+        ReadView nonce,
+        const UnallocatedUnorderedMap<std::uint64_t, std::size_t>& shortIDs,
+        CompactBlock& block) const noexcept -> void;
+    auto cmpct_finish() noexcept -> void;
+    auto cmpct_short_id(
+        const crypto::sodium::SiphashKey& key,
+        const opentxs::blockchain::bitcoin::block::Transaction& tx)
+        const noexcept -> std::uint64_t;
     auto check_verification() noexcept -> void;
+    auto below_fee_filter(ReadView txid) const noexcept -> bool;
     auto extract_body_size(const zeromq::Frame& header) const noexcept
         -> std::size_t final;
     auto not_implemented(
@@ -332,6 +373,7 @@ private:
     template <typename Outgoing, typename... Args>
     auto transmit_protocol(Args&&... args) noexcept -> void;
     auto transmit_protocol_block(const Data& serialized) noexcept -> void;
+    auto transmit_protocol_blocktxn(const Data& serialized) noexcept -> void;
     auto transmit_protocol_cfheaders(
         opentxs::blockchain::cfilter::Type type,
         const opentxs::blockchain::block::Hash& stop,
@@ -341,6 +383,7 @@ private:
         opentxs::blockchain::cfilter::Type type,
         const opentxs::blockchain::block::Hash& hash,
         const opentxs::blockchain::GCS& filter) noexcept -> void;
+    auto transmit_protocol_feefilter() noexcept -> void;
     auto transmit_protocol_getaddr() noexcept -> void;
     auto transmit_protocol_getcfheaders(
         const opentxs::blockchain::block::Height start,
@@ -348,6 +391,9 @@ private:
     auto transmit_protocol_getcfilters(
         const opentxs::blockchain::block::Height start,
         const opentxs::blockchain::block::Hash& stop) noexcept -> void;
+    auto transmit_protocol_getblocktxn(
+        const opentxs::blockchain::block::Hash& block,
+        const UnallocatedVector<std::size_t>& indices) noexcept -> void;
     auto transmit_protocol_getdata(
         opentxs::blockchain::bitcoin::Inventory&& item) noexcept -> void;
     auto transmit_protocol_getdata(
@@ -378,6 +424,7 @@ private:
     auto transmit_protocol_ping() noexcept -> void;
     auto transmit_protocol_pong(
         const opentxs::blockchain::p2p::bitcoin::Nonce& nonce) noexcept -> void;
+    auto transmit_protocol_sendcmpct() noexcept -> void;
     auto transmit_protocol_tx(ReadView serialized) noexcept -> void;
     auto transmit_protocol_verack() noexcept -> void;
     auto transmit_protocol_version() noexcept -> void;
@@ -537,6 +537,23 @@ struct Peer::ToWire<
     }
 };
 template <>
+struct Peer::ToWire<
+    opentxs::blockchain::p2p::bitcoin::message::internal::Blocktxn> {
+    static auto Name() noexcept { return print(Command::blocktxn); }
+
+    template <typename... Args>
+    auto operator()(
+        const api::Session& api,
+        opentxs::blockchain::Type chain,
+        Args&&... args) const
+    {
+        return std::unique_ptr<
+            opentxs::blockchain::p2p::bitcoin::message::internal::Blocktxn>{
+            factory::BitcoinP2PBlocktxn(
+                api, chain, std::forward<Args>(args)...)};
+    }
+};
+template <>
 struct Peer::ToWire<
     opentxs::blockchain::p2p::bitcoin::message::internal::Cfheaders> {
     static auto Name() noexcept { return print(Command::cfheaders); }
@@ -571,6 +588,22 @@ struct Peer::ToWire<
     }
 };
 template <>
+struct Peer::ToWire<opentxs::blockchain::p2p::bitcoin::message::Feefilter> {
+    static auto Name() noexcept { return print(Command::feefilter); }
+
+    template <typename... Args>
+    auto operator()(
+        const api::Session& api,
+        opentxs::blockchain::Type chain,
+        Args&&... args) const
+    {
+        return std::unique_ptr<
+            opentxs::blockchain::p2p::bitcoin::message::Feefilter>{
+            factory::BitcoinP2PFeefilter(
+                api, chain, std::forward<Args>(args)...)};
+    }
+};
+template <>
 struct Peer::ToWire<
     opentxs::blockchain::p2p::bitcoin::message::internal::Getaddr> {
     static auto Name() noexcept { return print(Command::getaddr); }
@@ -588,6 +621,22 @@ struct Peer::ToWire<
     }
 };
 template <>
+struct Peer::ToWire<opentxs::blockchain::p2p::bitcoin::message::Getblocktxn> {
+    static auto Name() noexcept { return print(Command::getblocktxn); }
+
+    template <typename... Args>
+    auto operator()(
+        const api::Session& api,
+        opentxs::blockchain::Type chain,
+        Args&&... args) const
+    {
+        return std::unique_ptr<
+            opentxs::blockchain::p2p::bitcoin::message::Getblocktxn>{
+            factory::BitcoinP2PGetblocktxn(
+                api, chain, std::forward<Args>(args)...)};
+    }
+};
+template <>
 struct Peer::ToWire<
     opentxs::blockchain::p2p::bitcoin::message::internal::Getcfheaders> {
     static auto Name() noexcept { return print(Command::getcfheaders); }
@@ -754,6 +803,22 @@ struct Peer::ToWire<
     }
 };
 template <>
+struct Peer::ToWire<opentxs::blockchain::p2p::bitcoin::message::Sendcmpct> {
+    static auto Name() noexcept { return print(Command::sendcmpct); }
+
+    template <typename... Args>
+    auto operator()(
+        const api::Session& api,
+        opentxs::blockchain::Type chain,
+        Args&&... args) const
+    {
+        return std::unique_ptr<
+            opentxs::blockchain::p2p::bitcoin::message::Sendcmpct>{
+            factory::BitcoinP2PSendcmpct(
+                api, chain, std::forward<Args>(args)...)};
+    }
+};
+template <>
 struct Peer::ToWire<opentxs::blockchain::p2p::bitcoin::message::internal::Tx> {
     static auto Name() noexcept { return print(Command::tx); }
 
@@ -11,6 +11,7 @@
 #include <chrono>
 #include <cstddef>
 #include <type_traits>
+#include <utility>
 
 #include "internal/blockchain/p2p/P2P.hpp"
 #include "internal/network/blockchain/Types.hpp"
@@ -201,8 +202,8 @@ struct TCPConnectionManager : virtual public ConnectionManager {
         std::unique_ptr<SendPromise> promise) noexcept
         -> std::optional<zeromq::Message> final
     {
-        header += payload;
-        socket_.Transmit(reader(connection_id_), header.Bytes());
+        socket_.Transmit(
+            reader(connection_id_), std::move(header), std::move(payload));
 
         return std::nullopt;
     }
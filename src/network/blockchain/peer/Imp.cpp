@@ -1068,6 +1068,11 @@ auto Peer::Imp::reset_job_timer() noexcept -> void
     reset_timer(job_timeout_, job_timer_, Work::jobtimeout);
 }
 
+auto Peer::Imp::request_high_bandwidth() const noexcept -> bool
+{
+    return parent_.RequestHighBandwidth(id_);
+}
+
 auto Peer::Imp::reset_peers_timer() noexcept -> void
 {
     reset_peers_timer(peers_interval_);
@@ -173,6 +173,7 @@ protected:
         return connection_;
     }
     auto get_known_tx(alloc::Default alloc = {}) const noexcept -> Set<Txid>;
+    auto request_high_bandwidth() const noexcept -> bool;
     auto state() const noexcept -> State { return state_; }
 
     auto add_known_block(opentxs::blockchain::block::Hash) noexcept -> bool;
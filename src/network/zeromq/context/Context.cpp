@@ -228,6 +228,8 @@ auto Context::RawSocket(socket::Type type) const noexcept -> socket::Raw
     return factory::ZMQSocket(*this, type);
 }
 
+auto Context::Rebalance() const noexcept -> void { pool_.Rebalance(); }
+
 auto Context::ReplySocket(
     const ReplyCallback& callback,
     const socket::Direction direction,
@@ -259,6 +261,11 @@ auto Context::Start(
     return pool_.Start(id, std::move(sockets), threadname);
 }
 
+auto Context::Statistics() const noexcept -> Vector<ThreadStatistics>
+{
+    return pool_.Statistics();
+}
+
 auto Context::Stop(BatchID id) const noexcept -> void { pool_.Stop(id); }
 
 auto Context::SubscribeSocket(
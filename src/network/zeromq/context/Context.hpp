@@ -147,6 +147,7 @@ public:
     auto PushSocket(const socket::Direction direction) const noexcept
         -> OTZMQPushSocket final;
     auto RawSocket(socket::Type type) const noexcept -> socket::Raw final;
+    auto Rebalance() const noexcept -> void final;
     auto ReplySocket(
         const ReplyCallback& callback,
         const socket::Direction direction,
@@ -163,6 +164,7 @@ public:
         StartArgs&& sockets,
         const std::string_view threadname) const noexcept
         -> internal::Thread* final;
+    auto Statistics() const noexcept -> Vector<ThreadStatistics> final;
     auto Stop(BatchID id) const noexcept -> void final;
     auto SubscribeSocket(
         const ListenCallback& callback,
@@ -10,10 +10,13 @@
 #include <zmq.h>  // IWYU pragma: keep
 #include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <thread>
 #include <type_traits>
@@ -48,7 +51,20 @@ Pool::Pool(const Context& parent) noexcept
     , start_args_()
     , stop_args_()
     , modify_args_()
+    , balance_()
+    , version_(next_version())
+    , next_rebalance_(Clock::now() + rebalance_interval_)
 {
+    {
+        auto handle = balance_.lock();
+        auto& data = *handle;
+        data.batches_.assign(count_, 0_uz);
+        data.migrations_.assign(count_, 0u);
+        data.last_busy_.assign(count_, 0);
+        data.recent_busy_.assign(count_, 0);
+        data.version_ = version_.load();
+    }
+
     for (unsigned int n{0}; n < count_; ++n) {
         auto [i, rc] = notify_.try_emplace(
             n,
@@ -67,9 +83,25 @@ Pool::Pool(const Context& parent) noexcept
     }
 }
 
+Pool::Slot::Slot(Pool& pool, unsigned int thread) noexcept
+    : pool_(pool)
+    , thread_(thread)
+{
+}
+
+auto Pool::Slot::Alloc() noexcept -> alloc::Resource*
+{
+    return pool_.threads_.at(thread_.load()).Alloc();
+}
+
+auto Pool::Slot::ID() const noexcept -> std::thread::id
+{
+    return pool_.threads_.at(thread_.load()).ID();
+}
+
 auto Pool::Alloc(BatchID id) noexcept -> alloc::Resource*
 {
-    return get(id).Alloc();
+    return slot(id).Alloc();
 }
 
 auto Pool::BelongsToThreadPool(const std::thread::id id) const noexcept -> bool
@@ -180,14 +212,22 @@ auto Pool::GetStopArgs(BatchID id) noexcept -> Set<void*>
     return args;
 }
 
-auto Pool::get(BatchID id) const noexcept -> const context::Thread&
+auto Pool::least_loaded(const Balance& data) const noexcept -> unsigned int
 {
-    return threads_.at(id % count_);
-}
+    auto out = 0u;
 
-auto Pool::get(BatchID id) noexcept -> context::Thread&
-{
-    return threads_.at(id % count_);
+    for (auto n = 1u; n < count_; ++n) {
+        const auto& load = data.recent_busy_;
+        const auto& batches = data.batches_;
+
+        if (load[n] < load[out]) {
+            out = n;
+        } else if ((load[n] == load[out]) && (batches[n] < batches[out])) {
+            out = n;
+        }
+    }
+
+    return out;
 }
 
 auto Pool::MakeBatch(Vector<socket::Type>&& types) noexcept -> internal::Handle
@@ -232,6 +272,74 @@ auto Pool::MakeBatch(const BatchID id, Vector<socket::Type>&& types) noexcept
     return {parent_.Internal(), batch};
 }
 
+auto Pool::Migrate(BatchID id, ThreadStartArgs&& sockets) noexcept -> void
+{
+    auto handle = balance_.lock();
+    auto& data = *handle;
+    auto i = data.batch_.find(id);
+
+    assert(data.batch_.end() != i);
+
+    auto& batch = i->second;
+
+    assert(batch.migrating_);
+
+    {
+        auto args = StartArgs{};
+        args.reserve(sockets.size());
+
+        for (auto& [socket, cb] : sockets) {
+            args.emplace_back(socket->ID(), socket, std::move(cb));
+        }
+
+        auto startHandle = start_args_.lock();
+        auto& map = *startHandle;
+        const auto [_, rc] = map.try_emplace(id, std::move(args));
+
+        assert(rc);
+    }
+
+    const auto from = batch.thread_;
+    const auto to = batch.target_;
+    --data.batches_[from];
+    ++data.batches_[to];
+    ++data.migrations_[from];
+    ++data.migrations_[to];
+    batch.thread_ = to;
+    batch.slot_->thread_.store(to);
+    batch.migrating_ = false;
+    send(to, [&] {
+        auto out = MakeWork(Operation::add_socket);
+        out.AddFrame(id);
+        out.AddFrame(batch.name_.data(), batch.name_.size());
+
+        return out;
+    }());
+
+    for (auto& message : batch.pending_) { send(to, std::move(message)); }
+
+    batch.pending_.clear();
+}
+
+auto Pool::MigrateSockets(BatchID id) noexcept -> Map<void*, socket::Raw*>
+{
+    auto out = Map<void*, socket::Raw*>{};
+
+    try {
+        auto handle = index_.lock_shared();
+        const auto& [bIndex, sIndex] = *handle;
+
+        for (const auto& sID : bIndex.at(id)) {
+            auto* socket = sIndex.at(sID).second;
+            out.emplace(socket->Native(), socket);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << OT_PRETTY_CLASS() << e.what() << std::endl;
+    }
+
+    return out;
+}
+
 auto Pool::Modify(SocketID id, ModifyCallback cb) noexcept -> void
 {
     const auto ticket = gate_.get();
@@ -245,8 +353,7 @@ auto Pool::Modify(SocketID id, ModifyCallback cb) noexcept -> void
             auto& map = *handle;
             map[id].emplace_back(std::move(cb));
         }
-        auto& notify = socket(batchID);
-        const auto rc = notify.Send([&] {
+        const auto rc = send(*balance_.lock(), batchID, [&] {
             auto out = MakeWork(Operation::change_socket);
             out.AddFrame(id);
 
@@ -262,15 +369,156 @@ auto Pool::Modify(SocketID id, ModifyCallback cb) noexcept -> void
     }
 }
 
+auto Pool::next_version() noexcept -> std::uint64_t
+{
+    // NOTE versions are unique across every pool in the process so a per
+    // thread snapshot can never be mistaken for one belonging to a different
+    // pool
+    static auto counter = std::atomic<std::uint64_t>{0};
+
+    return ++counter;
+}
+
+auto Pool::placement(Balance& data, BatchID id) const noexcept -> Placement&
+{
+    if (auto i = data.batch_.find(id); data.batch_.end() != i) {
+
+        return i->second;
+    }
+
+    const auto thread = least_loaded(data);
+    auto& out = data.batch_[id];
+    out.thread_ = thread;
+    out.slot_ = std::make_shared<Slot>(const_cast<Pool&>(*this), thread);
+    ++data.batches_[thread];
+    publish(data);
+
+    return out;
+}
+
 auto Pool::PreallocateBatch() const noexcept -> BatchID { return GetBatchID(); }
 
-auto Pool::Shutdown() noexcept -> void { stop(); }
+auto Pool::publish(Balance& data) const noexcept -> void
+{
+    auto next = Snapshot{};
+    next.reserve(data.batch_.size());
+
+    for (const auto& [id, batch] : data.batch_) {
+        next.emplace(id, batch.slot_);
+    }
+
+    data.snapshot_ = std::make_shared<const Snapshot>(std::move(next));
+    data.version_ = next_version();
+    version_.store(data.version_, std::memory_order_release);
+}
 
-auto Pool::socket(BatchID id) noexcept -> socket::Raw&
+auto Pool::Rebalance() noexcept -> void
 {
-    return notify_.at(id % count_).second;
+    const auto now = Clock::now();
+    auto next = next_rebalance_.load();
+
+    if (now < next) { return; }
+
+    if (false == next_rebalance_.compare_exchange_strong(
+                     next, now + rebalance_interval_)) {
+
+        return;
+    }
+
+    const auto ticket = gate_.get();
+
+    if (ticket) { return; }
+
+    rebalance(*balance_.lock());
 }
 
+auto Pool::rebalance(Balance& data) noexcept -> void
+{
+    for (auto n = 0u; n < count_; ++n) {
+        const auto busy = threads_.at(n).Statistics().busy_.count();
+        data.recent_busy_[n] = busy - data.last_busy_[n];
+        data.last_busy_[n] = busy;
+    }
+
+    for (auto& [id, batch] : data.batch_) {
+        const auto busy = batch.load_->busy_.load();
+        batch.recent_busy_ = busy - batch.last_busy_;
+        batch.last_busy_ = busy;
+    }
+
+    const auto& load = data.recent_busy_;
+    const auto hot = static_cast<unsigned int>(std::distance(
+        load.begin(), std::max_element(load.begin(), load.end())));
+    const auto cold = least_loaded(data);
+    static constexpr auto threshold =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            rebalance_interval_)
+            .count() /
+        10;
+
+    // NOTE only move work away from a thread which spent a significant part of
+    // the last interval executing callbacks and which is at least twice as
+    // busy as the least loaded thread
+    if (hot == cold) { return; }
+    if (threshold > load[hot]) { return; }
+    if (load[hot] < (2 * load[cold])) { return; }
+
+    // NOTE moving a batch which accounts for more than half of the difference
+    // would just swap which thread is overloaded
+    const auto limit = (load[hot] - load[cold]) / 2;
+    auto candidate = std::optional<BatchID>{};
+    auto best = std::int64_t{0};
+
+    for (const auto& [id, batch] : data.batch_) {
+        if (hot != batch.thread_) { continue; }
+        if (false == batch.started_) { continue; }
+        if (batch.stopping_ || batch.migrating_) { continue; }
+        if (batch.recent_busy_ > limit) { continue; }
+
+        if (batch.recent_busy_ > best) {
+            best = batch.recent_busy_;
+            candidate = id;
+        }
+    }
+
+    if (false == candidate.has_value()) { return; }
+
+    const auto id = candidate.value();
+    auto& batch = data.batch_.at(id);
+    const auto rc = send(hot, [&] {
+        auto out = MakeWork(Operation::migrate_socket);
+        out.AddFrame(id);
+
+        return out;
+    }());
+
+    if (rc) {
+        batch.target_ = cold;
+        batch.migrating_ = true;
+    }
+}
+
+auto Pool::send(Balance& data, BatchID id, Message&& message) noexcept -> bool
+{
+    auto& batch = placement(data, id);
+
+    if (batch.migrating_) {
+        batch.pending_.emplace_back(std::move(message));
+
+        return true;
+    } else {
+
+        return send(batch.thread_, std::move(message));
+    }
+}
+
+auto Pool::send(unsigned int thread, Message&& message) noexcept -> bool
+{
+    return notify_.at(thread).second.Send(std::move(message));
+}
+
+auto Pool::Shutdown() noexcept -> void { stop(); }
+
 auto Pool::Start(
     BatchID id,
     StartArgs&& sockets,
@@ -282,6 +530,27 @@ auto Pool::Start(
 
     try {
         {
+            auto load = [&] {
+                auto handle = balance_.lock();
+
+                return placement(*handle, id).load_;
+            }();
+
+            for (auto& socket : sockets) {
+                auto& cb = std::get<2>(socket);
+                cb = [load, callback = std::move(cb)](auto&& message) {
+                    const auto start = Clock::now();
+                    callback(std::move(message));
+                    const auto elapsed =
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            Clock::now() - start);
+                    load->messages_.fetch_add(1u, std::memory_order_relaxed);
+                    load->busy_.fetch_add(
+                        std::max<std::int64_t>(elapsed.count(), 0),
+                        std::memory_order_relaxed);
+                };
+            }
+
             auto handle = start_args_.lock();
             auto& map = *handle;
             auto [i, rc] = map.try_emplace(id, std::move(sockets));
@@ -291,9 +560,12 @@ auto Pool::Start(
             }
         }
 
-        auto& thread = get(id);
-        auto& notify = socket(id);
-        const auto rc = notify.Send([&] {
+        auto handle = balance_.lock();
+        auto& data = *handle;
+        auto& batch = placement(data, id);
+        batch.name_ = threadname;
+        batch.started_ = true;
+        const auto rc = send(batch.thread_, [&] {
             auto out = MakeWork(Operation::add_socket);
             out.AddFrame(id);
             out.AddFrame(threadname.data(), threadname.size());
@@ -303,7 +575,7 @@ auto Pool::Start(
 
         if (rc) {
 
-            return std::addressof(thread);
+            return batch.slot_.get();
         } else {
             throw std::runtime_error{"failed to add batch to thread"};
         }
@@ -338,8 +610,10 @@ auto Pool::Stop(BatchID id) noexcept -> void
                 throw std::runtime_error{"failed queue socket list"};
             }
         }
-        auto& notify = socket(id);
-        const auto rc = notify.Send([&] {
+        auto handle = balance_.lock();
+        auto& data = *handle;
+        placement(data, id).stopping_ = true;
+        const auto rc = send(data, id, [&] {
             auto out = MakeWork(Operation::remove_socket);
             out.AddFrame(id);
 
@@ -357,7 +631,11 @@ auto Pool::stop() noexcept -> void
     if (auto running = running_.exchange(false); running) {
         gate_.shutdown();
 
-        for (auto& [id, data] : notify_) { data.second.Close(); }
+        {
+            auto handle = balance_.lock();
+
+            for (auto& [id, data] : notify_) { data.second.Close(); }
+        }
 
         for (auto& [id, thread] : threads_) { thread.Shutdown(); }
 
@@ -387,20 +665,68 @@ auto Pool::stop_batch(BatchID id) noexcept -> void
 
         for (const auto& socketID : deletedSockets) { map.erase(socketID); }
     }
+    {
+        auto handle = balance_.lock();
+        auto& data = *handle;
+
+        if (auto i = data.batch_.find(id); data.batch_.end() != i) {
+            --data.batches_[i->second.thread_];
+            data.batch_.erase(i);
+            publish(data);
+        }
+    }
     batches_.modify([&](auto& batch) { batch.erase(id); });
 }
 
-auto Pool::Thread(BatchID id) const noexcept -> zeromq::internal::Thread*
+auto Pool::Statistics() const noexcept -> Vector<ThreadStatistics>
+{
+    auto out = Vector<ThreadStatistics>{};
+    out.reserve(count_);
+    auto handle = balance_.lock();
+    const auto& data = *handle;
+
+    for (auto n = 0u; n < count_; ++n) {
+        auto& stats = out.emplace_back(threads_.at(n).Statistics());
+        stats.batches_ = data.batches_[n];
+        stats.migrations_ = data.migrations_[n];
+    }
+
+    return out;
+}
+
+auto Pool::slot(BatchID id) const noexcept -> Slot&
 {
-    auto& thread = static_cast<zeromq::internal::Thread&>(
-        const_cast<Pool*>(this)->get(id));
+    struct Cache {
+        std::uint64_t version_{};
+        std::shared_ptr<const Snapshot> snapshot_{};
+    };
+
+    static thread_local auto cache = Cache{};
+
+    if (version_.load(std::memory_order_acquire) != cache.version_) {
+        auto handle = balance_.lock();
+        cache.snapshot_ = handle->snapshot_;
+        cache.version_ = handle->version_;
+    }
+
+    const auto& snapshot = *cache.snapshot_;
+
+    if (auto i = snapshot.find(id); snapshot.end() != i) { return *i->second; }
+
+    // NOTE the first lookup of a batch assigns it to a thread
+    auto handle = balance_.lock();
 
-    return &thread;
+    return *placement(*handle, id).slot_;
+}
+
+auto Pool::Thread(BatchID id) const noexcept -> zeromq::internal::Thread*
+{
+    return std::addressof(slot(id));
 }
 
 auto Pool::ThreadID(BatchID id) const noexcept -> std::thread::id
 {
-    return get(id).ID();
+    return slot(id).ID();
 }
 
 Pool::~Pool() { stop(); }
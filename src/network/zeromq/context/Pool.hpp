@@ -9,7 +9,11 @@
 #include <cs_plain_guarded.h>
 #include <robin_hood.h>
 #include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <future>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <string_view>
@@ -26,9 +30,11 @@
 #include "internal/network/zeromq/socket/Raw.hpp"
 #include "network/zeromq/context/Thread.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/network/zeromq/message/Message.hpp"
 #include "opentxs/network/zeromq/socket/Types.hpp"
 #include "opentxs/util/Allocator.hpp"
 #include "opentxs/util/Container.hpp"
+#include "opentxs/util/Time.hpp"
 #include "util/Gatekeeper.hpp"
 
 #pragma once
@@ -86,15 +92,21 @@ public:
     auto MakeBatch(Vector<socket::Type>&& types) noexcept -> internal::Handle;
     auto MakeBatch(const BatchID id, Vector<socket::Type>&& types) noexcept
         -> internal::Handle final;
+    auto Migrate(BatchID id, ThreadStartArgs&& sockets) noexcept
+        -> void final;
+    auto MigrateSockets(BatchID id) noexcept
+        -> Map<void*, socket::Raw*> final;
     auto Modify(SocketID id, ModifyCallback cb) noexcept -> void;
     auto DoModify(SocketID id) noexcept -> void final;
     auto PreallocateBatch() const noexcept -> BatchID final;
+    auto Rebalance() noexcept -> void final;
     auto Shutdown() noexcept -> void final;
     auto Start(
         BatchID id,
         StartArgs&& sockets,
         const std::string_view threadname) noexcept
         -> zeromq::internal::Thread* final;
+    auto Statistics() const noexcept -> Vector<ThreadStatistics>;
     auto Stop(BatchID id) noexcept -> void final;
 
     Pool(const Context& parent) noexcept;
@@ -128,6 +140,71 @@ private:
         }
     };
 
+    // NOTE updated by the socket callbacks of a batch on whichever thread is
+    // currently polling it
+    struct Load {
+        std::atomic<std::uint64_t> messages_{};
+        std::atomic<std::int64_t> busy_{};
+    };
+
+    // NOTE stable handle for a batch which forwards to whichever thread is
+    // currently polling it. The allocator of every thread is synchronized and
+    // lives as long as the pool, so allocations made before a batch migrates
+    // remain valid afterwards.
+    struct Slot final : public zeromq::internal::Thread {
+        Pool& pool_;
+        std::atomic<unsigned int> thread_;
+
+        auto ID() const noexcept -> std::thread::id final;
+
+        auto Alloc() noexcept -> alloc::Resource* final;
+        auto Shutdown() noexcept -> void final {}
+
+        Slot(Pool& pool, unsigned int thread) noexcept;
+        Slot() = delete;
+        Slot(const Slot&) = delete;
+        Slot(Slot&&) = delete;
+        auto operator=(const Slot&) -> Slot& = delete;
+        auto operator=(Slot&&) -> Slot& = delete;
+
+        ~Slot() final = default;
+    };
+
+    // NOTE copy on write index of every placed batch. Readers keep a per
+    // thread reference to the most recent snapshot and only take the balance
+    // lock when a new snapshot has been published.
+    using Snapshot =
+        robin_hood::unordered_flat_map<BatchID, std::shared_ptr<Slot>>;
+
+    struct Placement {
+        unsigned int thread_{};
+        unsigned int target_{};
+        CString name_{};
+        std::shared_ptr<Slot> slot_{};
+        std::shared_ptr<Load> load_{std::make_shared<Load>()};
+        std::int64_t last_busy_{};
+        std::int64_t recent_busy_{};
+        bool started_{};
+        bool stopping_{};
+        bool migrating_{};
+        // NOTE control messages for a batch which is in the process of
+        // migrating are held until the destination thread owns the batch
+        Vector<Message> pending_{};
+    };
+
+    struct Balance {
+        robin_hood::unordered_node_map<BatchID, Placement> batch_{};
+        Vector<std::size_t> batches_{};
+        Vector<std::uint64_t> migrations_{};
+        Vector<std::int64_t> last_busy_{};
+        Vector<std::int64_t> recent_busy_{};
+        std::shared_ptr<const Snapshot> snapshot_{
+            std::make_shared<const Snapshot>()};
+        std::uint64_t version_{};
+    };
+
+    static constexpr auto rebalance_interval_ = std::chrono::seconds{5};
+
     const Context& parent_;
     const unsigned int count_;
     std::atomic<bool> running_;
@@ -139,11 +216,20 @@ private:
     libguarded::plain_guarded<StartMap> start_args_;
     libguarded::plain_guarded<StopMap> stop_args_;
     libguarded::plain_guarded<ModifyMap> modify_args_;
+    mutable libguarded::plain_guarded<Balance> balance_;
+    mutable std::atomic<std::uint64_t> version_;
+    std::atomic<Time> next_rebalance_;
+
+    static auto next_version() noexcept -> std::uint64_t;
 
-    auto get(BatchID id) const noexcept -> const context::Thread&;
+    auto least_loaded(const Balance& data) const noexcept -> unsigned int;
+    auto placement(Balance& data, BatchID id) const noexcept -> Placement&;
+    auto publish(Balance& data) const noexcept -> void;
+    auto slot(BatchID id) const noexcept -> Slot&;
 
-    auto get(BatchID id) noexcept -> context::Thread&;
-    auto socket(BatchID id) noexcept -> socket::Raw&;
+    auto rebalance(Balance& data) noexcept -> void;
+    auto send(Balance& data, BatchID id, Message&& message) noexcept -> bool;
+    auto send(unsigned int thread, Message&& message) noexcept -> bool;
     auto stop() noexcept -> void;
     auto stop_batch(BatchID id) noexcept -> void;
 };
@@ -10,9 +10,11 @@
 #include "network/zeromq/context/Thread.hpp"  // IWYU pragma: associated
 
 #include <zmq.h>
+#include <algorithm>
 #include <cassert>
 #include <cerrno>
 #include <chrono>
+#include <cstdint>
 #include <cstdlib>
 #include <functional>
 #include <iostream>
@@ -33,6 +35,7 @@
 #include "opentxs/network/zeromq/socket/SocketType.hpp"
 #include "opentxs/util/Bytes.hpp"
 #include "opentxs/util/Container.hpp"
+#include "opentxs/util/Time.hpp"
 #include "util/Thread.hpp"
 
 namespace opentxs::network::zeromq::context
@@ -64,6 +67,9 @@ Thread::Thread(
     : parent_(parent)
     , alloc_()
     , shutdown_(false)
+    , messages_(0u)
+    , busy_(0)
+    , sockets_(0_uz)
     , control_([&] {
         auto out = parent_.Parent().Internal().RawSocket(socket::Type::Pull);
         const auto rc = out.Connect(endpoint.data());
@@ -93,6 +99,29 @@ auto Thread::join() noexcept -> void
     if (thread_.joinable()) { thread_.join(); }
 }
 
+auto Thread::migrate(BatchID batch) noexcept -> void
+{
+    const auto sockets = parent_.MigrateSockets(batch);
+    auto out = ThreadStartArgs{};
+    auto s = data_.items_.begin();
+    auto c = data_.data_.begin();
+
+    while ((s != data_.items_.end()) && (c != data_.data_.end())) {
+        if (auto i = sockets.find(s->socket); sockets.end() == i) {
+            ++s;
+            ++c;
+        } else {
+            out.emplace_back(i->second, std::move(*c));
+            s = data_.items_.erase(s);
+            c = data_.data_.erase(c);
+        }
+    }
+
+    assert(data_.items_.size() == data_.data_.size());
+
+    parent_.Migrate(batch, std::move(out));
+}
+
 auto Thread::modify(Message&& message) noexcept -> void
 {
     const auto body = message.Body();
@@ -139,10 +168,15 @@ auto Thread::modify(Message&& message) noexcept -> void
             const auto socketID = body.at(1).as<SocketID>();
             parent_.DoModify(socketID);
         } break;
+        case Operation::migrate_socket: {
+            migrate(body.at(1).as<BatchID>());
+        } break;
         default: {
             std::abort();
         }
     }
+
+    update_sockets();
 }
 
 auto Thread::poll() noexcept -> void
@@ -187,11 +221,20 @@ auto Thread::poll() noexcept -> void
 
                 if (receive_message(socket, message)) {
                     const auto& callback = *c;
+                    const auto start = Clock::now();
 
                     try {
                         callback(std::move(message));
                     } catch (...) {
                     }
+
+                    const auto elapsed =
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            Clock::now() - start);
+                    messages_.fetch_add(1u, std::memory_order_relaxed);
+                    busy_.fetch_add(
+                        std::max<std::int64_t>(elapsed.count(), 0),
+                        std::memory_order_relaxed);
                 }
             }
         }
@@ -264,7 +307,10 @@ auto Thread::run() noexcept -> void
 {
     Signals::Block();
 
-    while (false == shutdown_) { poll(); }
+    while (false == shutdown_) {
+        poll();
+        parent_.Rebalance();
+    }
 
     data_.items_.clear();
     data_.data_.clear();
@@ -277,5 +323,23 @@ auto Thread::Shutdown() noexcept -> void
     join();
 }
 
+auto Thread::Statistics() const noexcept -> ThreadStatistics
+{
+    auto out = ThreadStatistics{};
+    out.id_ = ID();
+    out.sockets_ = sockets_.load();
+    out.messages_ = messages_.load();
+    out.busy_ = std::chrono::nanoseconds{busy_.load()};
+
+    return out;
+}
+
+auto Thread::update_sockets() noexcept -> void
+{
+    // NOTE the first item is the control socket
+    const auto count = data_.items_.size();
+    sockets_.store((0_uz < count) ? count - 1_uz : 0_uz);
+}
+
 Thread::~Thread() { Shutdown(); }
 }  // namespace opentxs::network::zeromq::context
@@ -7,6 +7,8 @@
 
 #include <zmq.h>
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <future>
 #include <mutex>
 #include <queue>
@@ -64,6 +66,7 @@ public:
         return thread_.get_id();
     }
     auto Shutdown() noexcept -> void final;
+    auto Statistics() const noexcept -> ThreadStatistics;
 
     Thread(zeromq::internal::Pool& parent, std::string_view endpoint) noexcept;
     Thread() = delete;
@@ -91,15 +94,20 @@ private:
     zeromq::internal::Pool& parent_;
     alloc::BoostPoolSync alloc_;
     std::atomic_bool shutdown_;
+    std::atomic<std::uint64_t> messages_;
+    std::atomic<std::int64_t> busy_;
+    std::atomic<std::size_t> sockets_;
     socket::Raw control_;
     Items data_;
     CString thread_name_;
     std::thread thread_;
 
     auto join() noexcept -> void;
+    auto migrate(BatchID batch) noexcept -> void;
     auto poll() noexcept -> void;
     auto receive_message(void* socket, Message& message) noexcept -> bool;
     auto modify(Message&& message) noexcept -> void;
     auto run() noexcept -> void;
+    auto update_sockets() noexcept -> void;
 };
 }  // namespace opentxs::network::zeromq::context
@@ -8,6 +8,7 @@
 #include "internal/otx/common/Ledger.hpp"  // IWYU pragma: associated
 
 #include <irrxml/irrXML.hpp>
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 #include <filesystem>
@@ -86,6 +87,9 @@ Ledger::Ledger(
     , m_Type(ledgerType::message)
     , m_bLoadedLegacyData(false)
     , m_mapTransactions()
+    , lazy_(false)
+    , index_()
+    , receipt_cache_()
 {
     InitLedger();
 }
@@ -103,6 +107,9 @@ Ledger::Ledger(
     , m_Type(ledgerType::message)
     , m_bLoadedLegacyData(false)
     , m_mapTransactions()
+    , lazy_(false)
+    , index_()
+    , receipt_cache_()
 {
     InitLedger();
     SetRealAccountID(theAccountID);
@@ -115,6 +122,9 @@ Ledger::Ledger(const api::Session& api)
     , m_Type(ledgerType::message)
     , m_bLoadedLegacyData(false)
     , m_mapTransactions()
+    , lazy_(false)
+    , index_()
+    , receipt_cache_()
 {
     InitLedger();
 }
@@ -125,6 +135,112 @@ auto Ledger::GetTypeString(ledgerType theType) -> char const*
     return TypeStringsLedger[nType];
 }
 
+auto Ledger::EnableLazyReceipts(const std::size_t cacheSize) -> void
+{
+    lazy_ = true;
+    auto& cache = receipt_cache_;
+    cache.capacity_ = std::max<std::size_t>(cacheSize, 1u);
+
+    while (cache.receipts_.size() > cache.capacity_) {
+        cache.receipts_.erase(cache.recent_.back());
+        cache.recent_.pop_back();
+    }
+}
+
+auto Ledger::find(const TransactionNumber number) const -> Position
+{
+    if (false == index_.valid_) { return m_mapTransactions.find(number); }
+
+    const auto& index = index_;
+
+    if (auto i = index.number_.find(number); index.number_.end() != i) {
+
+        return index.position_[static_cast<std::size_t>(i->second)];
+    }
+
+    return m_mapTransactions.end();
+}
+
+auto Ledger::get_index() const -> const Index&
+{
+    auto& index = index_;
+
+    if (index.valid_) { return index; }
+
+    index.position_.clear();
+    index.number_.clear();
+    index.position_.reserve(m_mapTransactions.size());
+    index.number_.reserve(m_mapTransactions.size());
+
+    for (auto i = m_mapTransactions.cbegin(); m_mapTransactions.cend() != i;
+         ++i) {
+        index.number_.emplace(
+            i->first, static_cast<std::int32_t>(index.position_.size()));
+        index.position_.emplace_back(i);
+    }
+
+    index.valid_ = true;
+
+    return index;
+}
+
+auto Ledger::invalidate(const TransactionNumber number) const -> void
+{
+    index_.valid_ = false;
+    auto& cache = receipt_cache_;
+
+    if (auto i = cache.receipts_.find(number); cache.receipts_.end() != i) {
+        cache.recent_.erase(i->second.recent_);
+        cache.receipts_.erase(i);
+    }
+}
+
+auto Ledger::receipt(
+    const TransactionNumber number,
+    const std::shared_ptr<OTTransaction>& transaction) const
+    -> std::shared_ptr<OTTransaction>
+{
+    OT_ASSERT(transaction);
+
+    if ((false == lazy_) || (false == transaction->IsAbbreviated())) {
+
+        return transaction;
+    }
+
+    auto& cache = receipt_cache_;
+
+    if (auto i = cache.receipts_.find(number); cache.receipts_.end() != i) {
+        auto& cached = i->second;
+        cache.recent_.splice(
+            cache.recent_.begin(), cache.recent_, cached.recent_);
+
+        return cached.receipt_;
+    }
+
+    auto loaded = std::shared_ptr<OTTransaction>{
+        ::opentxs::LoadBoxReceipt(
+            api_, *transaction, static_cast<std::int64_t>(m_Type))
+            .release()};
+
+    if (false == bool(loaded)) {
+        LogDebug()(OT_PRETTY_CLASS())("unable to load box receipt ")(number)
+            .Flush();
+
+        return transaction;
+    }
+
+    cache.recent_.emplace_front(number);
+    cache.receipts_.emplace(
+        number, CachedReceipt{loaded, cache.recent_.begin()});
+
+    while (cache.receipts_.size() > cache.capacity_) {
+        cache.receipts_.erase(cache.recent_.back());
+        cache.recent_.pop_back();
+    }
+
+    return loaded;
+}
+
 // This calls OTTransactionType::VerifyAccount(), which calls
 // VerifyContractID() as well as VerifySignature().
 //
@@ -247,6 +363,43 @@ auto Ledger::DeleteBoxReceipt(const std::int64_t& lTransactionNum) -> bool
 // if psetUnloaded passed in, then use it to return the #s that weren't there.
 auto Ledger::LoadBoxReceipts(UnallocatedSet<std::int64_t>* psetUnloaded) -> bool
 {
+    if (lazy_) {
+        // NOTE box receipts for a lazy ledger are loaded on demand so this
+        // only checks that a receipt exists in storage for each abbreviated
+        // record
+        const auto type = static_cast<std::int32_t>(GetType());
+        auto bRetVal = true;
+
+        for (const auto& [number, pTransaction] : m_mapTransactions) {
+            OT_ASSERT(pTransaction);
+
+            if (false == pTransaction->IsAbbreviated()) { continue; }
+
+            const auto exists = VerifyBoxReceiptExists(
+                api_,
+                api_.DataFolder(),
+                pTransaction->GetRealNotaryID(),
+                pTransaction->GetNymID(),
+                pTransaction->GetRealAccountID(),
+                type,
+                number);
+
+            if (exists) { continue; }
+
+            bRetVal = false;
+            auto& log = (nullptr != psetUnloaded) ? LogDebug() : LogConsole();
+            log(OT_PRETTY_CLASS())("missing box receipt for abbreviated "
+                                   "transaction number: ")(number)
+                .Flush();
+
+            if (nullptr == psetUnloaded) { break; }
+
+            psetUnloaded->insert(number);
+        }
+
+        return bRetVal;
+    }
+
     // Grab a copy of all the transaction #s stored inside this ledger.
     //
     UnallocatedSet<std::int64_t> the_set;
@@ -351,6 +504,12 @@ auto Ledger::LoadBoxReceipt(const std::int64_t& lTransactionNum) -> bool
     //  otOut << "DEBUGGING:  OTLedger::LoadBoxReceipt: ledger type: %s \n",
     // GetTypeString());
 
+    if (lazy_) {
+        // NOTE the abbreviated record stays in the ledger and the full
+        // receipt is cached
+        return false == receipt(lTransactionNum, pTransaction)->IsAbbreviated();
+    }
+
     // LoadBoxReceipt already checks pTransaction to see if it's
     // abbreviated
     // (which it must be.) So I don't bother checking twice.
@@ -1042,6 +1201,8 @@ auto Ledger::GetTransactionMap() const -> const mapOfTransactions&
 ///
 auto Ledger::RemoveTransaction(const TransactionNumber number) -> bool
 {
+    invalidate(number);
+
     if (0 == m_mapTransactions.erase(number)) {
         LogError()(OT_PRETTY_CLASS())(
             "Attempt to remove Transaction from ledger, when "
@@ -1058,6 +1219,7 @@ auto Ledger::AddTransaction(std::shared_ptr<OTTransaction> theTransaction)
     -> bool
 {
     const auto number = theTransaction->GetTransactionNum();
+    invalidate(number);
     const auto [it, added] = m_mapTransactions.emplace(number, theTransaction);
 
     if (false == added) {
@@ -1082,7 +1244,10 @@ auto Ledger::GetTransaction(transactionType theType)
         auto pTransaction = it.second;
         OT_ASSERT(pTransaction);
 
-        if (theType == pTransaction->GetType()) { return pTransaction; }
+        if (theType == pTransaction->GetType()) {
+
+            return receipt(it.first, pTransaction);
+        }
     }
 
     return nullptr;
@@ -1091,18 +1256,11 @@ auto Ledger::GetTransaction(transactionType theType)
 // if not found, returns -1
 auto Ledger::GetTransactionIndex(const TransactionNumber target) -> std::int32_t
 {
-    // loop through the transactions inside this ledger
-    // If a specific transaction is found, returns its index inside the ledger
-    //
-    std::int32_t output{0};
+    const auto& index = get_index();
 
-    for (const auto& [number, pTransaction] : m_mapTransactions) {
-        if (target == number) {
+    if (auto i = index.number_.find(target); index.number_.end() != i) {
 
-            return output;
-        } else {
-            ++output;
-        }
+        return i->second;
     }
 
     return -1;
@@ -1116,13 +1274,12 @@ auto Ledger::GetTransactionIndex(const TransactionNumber target) -> std::int32_t
 auto Ledger::GetTransaction(const TransactionNumber number) const
     -> std::shared_ptr<OTTransaction>
 {
-    try {
-
-        return m_mapTransactions.at(number);
-    } catch (...) {
+    if (auto i = find(number); m_mapTransactions.end() != i) {
 
-        return {};
+        return receipt(number, i->second);
     }
+
+    return {};
 }
 
 // Return a count of all the transactions in this ledger that are IN REFERENCE
@@ -1154,19 +1311,11 @@ auto Ledger::GetTransactionByIndex(std::int32_t nIndex) const
     // Out of bounds.
     if ((nIndex < 0) || (nIndex >= GetTransactionCount())) { return nullptr; }
 
-    std::int32_t nIndexCount = -1;
-
-    for (const auto& it : m_mapTransactions) {
-        nIndexCount++;  // On first iteration, this is now 0, same as nIndex.
-        auto pTransaction = it.second;
-        OT_ASSERT(pTransaction);  // Should always be good.
+    const auto& [number, pTransaction] =
+        *get_index().position_[static_cast<std::size_t>(nIndex)];
+    OT_ASSERT(pTransaction);  // Should always be good.
 
-        // If this transaction is the one at the requested index
-        if (nIndexCount == nIndex) { return pTransaction; }
-    }
-
-    return nullptr;  // Should never reach this point, since bounds are checked
-                     // at the top.
+    return receipt(number, pTransaction);
 }
 
 // Nymbox-only.
@@ -1202,6 +1351,7 @@ auto Ledger::GetTransferReceipt(std::int64_t lNumberOfOrigin)
         OT_ASSERT(pTransaction);
 
         if (transactionType::transferReceipt == pTransaction->GetType()) {
+            pTransaction = receipt(it.first, pTransaction);
             auto strReference = String::Factory();
             pTransaction->GetReferenceString(strReference);
 
@@ -1282,6 +1432,7 @@ auto Ledger::GetChequeReceipt(std::int64_t lChequeNum)
             continue;
         }
 
+        pCurrentReceipt = receipt(it.first, pCurrentReceipt);
         auto strDepositChequeMsg = String::Factory();
         pCurrentReceipt->GetReferenceString(strDepositChequeMsg);
 
@@ -1376,7 +1527,7 @@ auto Ledger::GetFinalReceipt(std::int64_t lReferenceNum)
         }
 
         if (pTransaction->GetReferenceToNum() == lReferenceNum) {
-            return pTransaction;
+            return receipt(it.first, pTransaction);
         }
     }
 
@@ -2107,6 +2258,7 @@ auto Ledger::ProcessXMLNode(irr::io::IrrXMLReader*& xml) -> std::int32_t
                         //
                         std::shared_ptr<OTTransaction> transaction{
                             pTransaction.release()};
+                        invalidate(transaction->GetTransactionNum());
                         m_mapTransactions[transaction->GetTransactionNum()] =
                             transaction;
                         transaction->SetParent(*this);
@@ -2272,6 +2424,7 @@ auto Ledger::ProcessXMLNode(irr::io::IrrXMLReader*& xml) -> std::int32_t
                 // It's not already there on this ledger -- so add it!
                 std::shared_ptr<OTTransaction> transaction{
                     pTransaction.release()};
+                invalidate(transaction->GetTransactionNum());
                 m_mapTransactions[transaction->GetTransactionNum()] =
                     transaction;
                 transaction->SetParent(*this);
@@ -2374,6 +2527,9 @@ void Ledger::ReleaseTransactions()
     // If there were any dynamically allocated objects, clean them up here.
 
     m_mapTransactions.clear();
+    index_ = {};
+    receipt_cache_.receipts_.clear();
+    receipt_cache_.recent_.clear();
 }
 
 void Ledger::Release_Ledger() { ReleaseTransactions(); }
@@ -2307,6 +2307,9 @@ void Server::need_box_items(
 
     OT_ASSERT(nymbox);
 
+    // NOTE only the abbreviated records are needed to find the box receipts
+    // which have not been downloaded yet, so none of them are loaded here
+    nymbox->EnableLazyReceipts();
     const auto loaded = nymbox->LoadNymbox();
 
     if (false == loaded) {
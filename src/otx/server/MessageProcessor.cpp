@@ -10,10 +10,14 @@
 #include <OTXPush.pb.h>
 #include <ServerReply.pb.h>
 #include <ServerRequest.pb.h>
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <functional>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string_view>
@@ -22,6 +26,7 @@
 
 #include "Proto.hpp"
 #include "Proto.tpp"
+#include "internal/api/network/Asio.hpp"
 #include "internal/api/session/Endpoints.hpp"
 #include "internal/api/session/FactoryAPI.hpp"
 #include "internal/api/session/Notary.hpp"
@@ -30,13 +35,20 @@
 #include "internal/network/zeromq/Types.hpp"
 #include "internal/network/zeromq/message/Message.hpp"  // IWYU pragma: keep
 #include "internal/network/zeromq/socket/Raw.hpp"
+#include "internal/otx/Types.hpp"
+#include "internal/otx/common/Item.hpp"
+#include "internal/otx/common/Ledger.hpp"
 #include "internal/otx/common/Message.hpp"
+#include "internal/otx/common/OTTransaction.hpp"
 #include "internal/otx/server/Types.hpp"
 #include "internal/serialization/protobuf/Check.hpp"
 #include "internal/serialization/protobuf/verify/ServerRequest.hpp"
 #include "internal/util/LogMacros.hpp"
 #include "internal/util/Mutex.hpp"
+#include "internal/util/P0330.hpp"
+#include "opentxs/api/network/Asio.hpp"
 #include "opentxs/api/network/Network.hpp"
+#include "opentxs/api/session/Crypto.hpp"
 #include "opentxs/api/session/Endpoints.hpp"
 #include "opentxs/api/session/Factory.hpp"
 #include "opentxs/api/session/Notary.hpp"
@@ -46,6 +58,7 @@
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/Secret.hpp"
 #include "opentxs/core/String.hpp"
+#include "opentxs/core/identifier/Generic.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
 #include "opentxs/identity/Nym.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
@@ -120,6 +133,9 @@ MessageProcessor::Imp::Imp(
     , drop_outgoing_(0)
     , active_connections_()
     , connection_map_lock_()
+    , locks_()
+    , shards_(std::max(std::thread::hardware_concurrency(), 1u))
+    , gate_()
 {
     zmq_batch_.listen_callbacks_.emplace_back(zmq::ListenCallback::Factory(
         [this](auto&& m) { old_pipeline(std::move(m)); }));
@@ -196,9 +212,87 @@ auto MessageProcessor::Imp::associate_connection(
 auto MessageProcessor::Imp::cleanup() noexcept -> void
 {
     running_ = false;
+    gate_.shutdown();
     zmq_handle_.Release();
 }
 
+auto MessageProcessor::Imp::dispatch(Job&& job) noexcept -> void
+{
+    const auto shard =
+        std::hash<std::string_view>{}(job.request_->m_strNymID->Bytes()) %
+        shards_.size();
+    const auto start = [&] {
+        auto handle = shards_[shard].lock();
+        auto& data = *handle;
+        data.queue_.emplace_back(std::move(job));
+
+        if (data.running_) { return false; }
+
+        data.running_ = true;
+
+        return true;
+    }();
+
+    if (false == start) { return; }
+
+    auto ticket = std::make_shared<Ticket>(gate_.get());
+
+    if (*ticket) { return; }
+
+    const auto posted = api_.Network().Asio().Internal().Post(
+        ThreadPool::General,
+        [this, shard, ticket] {
+            if (false == *ticket) { drain(shard); }
+        },
+        "MessageProcessor");
+
+    if (false == posted) {
+        LogError()(OT_PRETTY_CLASS())("failed to schedule shard ")(shard)
+            .Flush();
+        auto jobs = [&] {
+            auto handle = shards_[shard].lock();
+            auto& data = *handle;
+            auto out = std::deque<Job>{};
+            out.swap(data.queue_);
+            data.running_ = false;
+
+            return out;
+        }();
+
+        // NOTE nothing will drain these jobs so answer them with an error
+        // reply rather than leaving the clients waiting
+        for (auto& job : jobs) {
+            send_reply(process_backend(
+                job.tagged_, nullptr, std::move(job.incoming_)));
+        }
+    }
+}
+
+auto MessageProcessor::Imp::drain(const std::size_t shard) noexcept -> void
+{
+    while (running_) {
+        auto job = [&]() -> std::optional<Job> {
+            auto handle = shards_[shard].lock();
+            auto& data = *handle;
+
+            if (data.queue_.empty()) {
+                data.running_ = false;
+
+                return std::nullopt;
+            }
+
+            auto out = std::make_optional<Job>(std::move(data.queue_.front()));
+            data.queue_.pop_front();
+
+            return out;
+        }();
+
+        if (false == job.has_value()) { return; }
+
+        execute(std::move(job.value()));
+    }
+}
+
 auto MessageProcessor::Imp::DropIncoming(const int count) const noexcept -> void
 {
     Lock lock(counter_lock_);
@@ -211,6 +305,37 @@ auto MessageProcessor::Imp::DropOutgoing(const int count) const noexcept -> void
     drop_outgoing_ = count;
 }
 
+auto MessageProcessor::Imp::execute(Job&& job) noexcept -> void
+{
+    const auto& request = *job.request_;
+    const auto type = opentxs::Message::Type(request.m_strCommand->Get());
+    auto reply = [&] {
+        if (RequestLocks::IsParallel(type)) {
+            const auto lock = locks_.Shared(resources(request));
+
+            return process_backend(
+                job.tagged_, &request, std::move(job.incoming_));
+        }
+
+        if (RequestLocks::IsTransaction(type)) {
+            auto processing = locks_.Processing();
+
+            if (const auto accounts = transaction_accounts(request); accounts) {
+                const auto lock = locks_.Shared(
+                    std::move(processing), resources(request, *accounts));
+
+                return process_backend(
+                    job.tagged_, &request, std::move(job.incoming_));
+            }
+        }
+
+        const auto lock = locks_.Exclusive();
+
+        return process_backend(job.tagged_, &request, std::move(job.incoming_));
+    }();
+    send_reply(std::move(reply));
+}
+
 auto MessageProcessor::Imp::extract_proto(
     const zmq::Frame& incoming) const noexcept -> proto::ServerRequest
 {
@@ -269,6 +394,80 @@ auto MessageProcessor::Imp::init(
         });
 }
 
+auto MessageProcessor::Imp::inbox_accounts(
+    const identifier::Nym& nymID,
+    const identifier::Generic& accountID,
+    OTTransaction& processInbox,
+    AccountIDs& out) const noexcept -> bool
+{
+    const auto& factory = api_.Factory().InternalSession();
+    const auto& notaryID = server_.GetServerID();
+    auto inbox = factory.Ledger(nymID, accountID, notaryID);
+
+    OT_ASSERT(inbox);
+
+    // NOTE only the receipts named by the request are needed so they are
+    // loaded on demand
+    inbox->EnableLazyReceipts();
+
+    // NOTE the inbox is read before its account stripe is locked. This is only
+    // used to choose which stripes to lock, and a stale view is safe for that:
+    // - a receipt is identified by a transaction number which is never reused,
+    //   and the accounts it involves are taken from the original item embedded
+    //   in it, so they can not change after the receipt is read
+    // - a receipt which arrives after this read is not found here, which sends
+    //   the whole request down the exclusive path
+    // - a receipt which another request removes after this read only causes an
+    //   extra stripe to be locked, and the Notary rejects the item since it
+    //   reloads the inbox once the locks are held
+    if (false == inbox->LoadInbox()) { return false; }
+
+    for (const auto& item : processInbox.GetItemList()) {
+        if (false == bool(item)) { return false; }
+
+        switch (item->GetType()) {
+            case itemType::balanceStatement: {
+                continue;
+            }
+            case itemType::acceptPending:
+            case itemType::rejectPending:
+            case itemType::acceptItemReceipt: {
+            } break;
+            default: {
+                // NOTE cron, final, and basket receipts involve cron items
+                // and contexts which are not named by the receipt
+
+                return false;
+            }
+        }
+
+        const auto receipt = inbox->GetTransaction(item->GetReferenceToNum());
+
+        if ((false == bool(receipt)) || receipt->IsAbbreviated()) {
+
+            return false;
+        }
+
+        auto serialized = String::Factory();
+        receipt->GetReferenceString(serialized);
+        const auto original = factory.Item(
+            serialized, notaryID, receipt->GetReferenceToNum());
+
+        if (false == bool(original)) { return false; }
+
+        for (const auto* id : {
+                 &original->GetPurportedAccountID(),
+                 &original->GetDestinationAcctID(),
+             }) {
+            if (false == id->empty()) {
+                out.emplace_back(id->asBase58(api_.Crypto()));
+            }
+        }
+    }
+
+    return true;
+}
+
 auto MessageProcessor::Imp::old_pipeline(zmq::Message&& message) noexcept
     -> void
 {
@@ -290,25 +489,57 @@ auto MessageProcessor::Imp::old_pipeline(zmq::Message&& message) noexcept
     }
 }
 
+auto MessageProcessor::Imp::parse_request(
+    const zmq::Message& incoming) const noexcept
+    -> std::shared_ptr<const opentxs::Message>
+{
+    const auto messageString = [&] {
+        auto out = UnallocatedCString{};
+        const auto body = incoming.Body();
+
+        if (0u < body.size()) { out = body.at(0).Bytes(); }
+
+        return out;
+    }();
+
+    if (messageString.size() < 1) { return {}; }
+
+    if (std::numeric_limits<std::uint32_t>::max() < messageString.size()) {
+        return {};
+    }
+
+    auto armored = Armored::Factory();
+    armored->MemSet(
+        messageString.data(), static_cast<std::uint32_t>(messageString.size()));
+    auto serialized = String::Factory();
+    armored->GetString(serialized);
+    auto request = std::shared_ptr<opentxs::Message>{
+        api_.Factory().InternalSession().Message()};
+
+    if (false == serialized->Exists()) {
+        LogError()(OT_PRETTY_CLASS())("Empty serialized request.").Flush();
+
+        return {};
+    }
+
+    if (false == request->LoadContractFromString(serialized)) {
+        LogError()(OT_PRETTY_CLASS())("Failed to deserialized request.")
+            .Flush();
+
+        return {};
+    }
+
+    return request;
+}
+
 auto MessageProcessor::Imp::process_backend(
     const bool tagged,
+    const opentxs::Message* request,
     zmq::Message&& incoming) noexcept -> network::zeromq::Message
 {
     auto reply = UnallocatedCString{};
-    const auto error = [&] {
-        // ProcessCron and process_backend must not run simultaneously
-        auto lock = Lock{lock_};
-        const auto request = [&] {
-            auto out = UnallocatedCString{};
-            const auto body = incoming.Body();
-
-            if (0u < body.size()) { out = body.at(0).Bytes(); }
-
-            return out;
-        }();
-
-        return process_message(request, reply);
-    }();
+    const auto error =
+        (nullptr == request) || process_message(*request, reply);
 
     if (error) { reply = ""; }
 
@@ -449,55 +680,35 @@ auto MessageProcessor::Imp::process_legacy(
 {
     LogTrace()(OT_PRETTY_CLASS())("Processing request via ")(id.asHex())
         .Flush();
-    process_internal(process_backend(tagged, std::move(incoming)));
+    auto request = parse_request(incoming);
+
+    if (request) {
+        dispatch(Job{std::move(incoming), tagged, std::move(request)});
+    } else {
+        process_internal(process_backend(tagged, nullptr, std::move(incoming)));
+    }
 }
 
 auto MessageProcessor::Imp::process_message(
-    const UnallocatedCString& messageString,
+    const opentxs::Message& request,
     UnallocatedCString& reply) noexcept -> bool
 {
-    if (messageString.size() < 1) { return true; }
-
-    if (std::numeric_limits<std::uint32_t>::max() < messageString.size()) {
-        return true;
-    }
-
-    auto armored = Armored::Factory();
-    armored->MemSet(
-        messageString.data(), static_cast<std::uint32_t>(messageString.size()));
-    auto serialized = String::Factory();
-    armored->GetString(serialized);
-    auto request{api_.Factory().InternalSession().Message()};
-
-    if (false == serialized->Exists()) {
-        LogError()(OT_PRETTY_CLASS())("Empty serialized request.").Flush();
-
-        return true;
-    }
-
-    if (false == request->LoadContractFromString(serialized)) {
-        LogError()(OT_PRETTY_CLASS())("Failed to deserialized request.")
-            .Flush();
-
-        return true;
-    }
-
     auto replymsg{api_.Factory().InternalSession().Message()};
 
     OT_ASSERT(false != bool(replymsg));
 
     const bool processed =
-        server_.CommandProcessor().ProcessUserCommand(*request, *replymsg);
+        server_.CommandProcessor().ProcessUserCommand(request, *replymsg);
 
     if (false == processed) {
         LogDetail()(OT_PRETTY_CLASS())("Failed to process user command ")(
-            request->m_strCommand.get())
+            request.m_strCommand.get())
             .Flush();
-        LogVerbose()(OT_PRETTY_CLASS())(String::Factory(*request).get())
+        LogVerbose()(OT_PRETTY_CLASS())(String::Factory(request).get())
             .Flush();
     } else {
         LogDetail()(OT_PRETTY_CLASS())("Successfully processed user command ")(
-            request->m_strCommand.get())
+            request.m_strCommand.get())
             .Flush();
     }
 
@@ -650,6 +861,81 @@ auto MessageProcessor::Imp::query_connection(const identifier::Nym& id) noexcept
     }
 }
 
+auto MessageProcessor::Imp::transaction_accounts(
+    const opentxs::Message& request) const noexcept
+    -> std::optional<AccountIDs>
+{
+    const auto& factory = api_.Factory();
+    const auto nymID = factory.NymIDFromBase58(request.m_strNymID->Bytes());
+    const auto accountID =
+        factory.IdentifierFromBase58(request.m_strAcctID->Bytes());
+    auto input = factory.InternalSession().Ledger(
+        nymID, accountID, server_.GetServerID());
+
+    OT_ASSERT(input);
+
+    if (false ==
+        input->LoadLedgerFromString(String::Factory(request.m_ascPayload))) {
+
+        return std::nullopt;
+    }
+
+    auto out = AccountIDs{};
+
+    for (const auto& it : input->GetTransactionMap()) {
+        const auto& transaction = it.second;
+
+        // NOTE the Notary loads the account named by the transaction, which
+        // is only locked if it matches the request header
+        if ((false == bool(transaction)) ||
+            (accountID != transaction->GetPurportedAccountID())) {
+
+            return std::nullopt;
+        }
+
+        switch (transaction->GetType()) {
+            case transactionType::transfer: {
+                for (const auto& item : transaction->GetItemList()) {
+                    if (false == bool(item)) { return std::nullopt; }
+
+                    const auto& id = item->GetDestinationAcctID();
+
+                    if (false == id.empty()) {
+                        out.emplace_back(id.asBase58(api_.Crypto()));
+                    }
+                }
+            } break;
+            case transactionType::processInbox: {
+                if (false == inbox_accounts(
+                                 nymID, accountID, *transaction, out)) {
+
+                    return std::nullopt;
+                }
+            } break;
+            default: {
+
+                return std::nullopt;
+            }
+        }
+    }
+
+    return out;
+}
+
+auto MessageProcessor::Imp::resources(
+    const opentxs::Message& request,
+    const AccountIDs& accounts) noexcept -> RequestLocks::Resources
+{
+    auto out = RequestLocks::Resources{};
+    out.reserve(3_uz + accounts.size());
+    out.emplace_back(request.m_strNymID->Bytes());
+    out.emplace_back(request.m_strNymID2->Bytes());
+    out.emplace_back(request.m_strAcctID->Bytes());
+    std::copy(accounts.begin(), accounts.end(), std::back_inserter(out));
+
+    return out;
+}
+
 auto MessageProcessor::Imp::run() noexcept -> void
 {
     SetThisThreadsName("MessageProcessor");
@@ -659,8 +945,9 @@ auto MessageProcessor::Imp::run() noexcept -> void
         const auto timeout = server_.ComputeTimeout();
 
         if (timeout.count() <= 0) {
-            // ProcessCron and process_backend must not run simultaneously
-            auto lock = Lock{lock_};
+            // NOTE cron items may modify any account so cron excludes all
+            // request processing
+            const auto lock = locks_.Exclusive();
             server_.ProcessCron();
         }
 
@@ -668,6 +955,15 @@ auto MessageProcessor::Imp::run() noexcept -> void
     }
 }
 
+auto MessageProcessor::Imp::send_reply(zmq::Message&& reply) noexcept -> void
+{
+    // NOTE the frontend socket may only be used by the thread which owns it
+    api_.Network().ZeroMQ().Internal().Modify(
+        frontend_id_, [this, message = std::move(reply)](auto&) mutable {
+            process_internal(std::move(message));
+        });
+}
+
 auto MessageProcessor::Imp::Start() noexcept -> void
 {
     thread_ = std::thread(&Imp::run, this);
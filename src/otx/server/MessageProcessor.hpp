@@ -6,10 +6,13 @@
 #pragma once
 
 #include <ServerRequest.pb.h>
+#include <cs_plain_guarded.h>
 #include <atomic>
 #include <cstddef>
+#include <deque>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
 #include <thread>
 #include <utility>
@@ -18,7 +21,7 @@
 #include "internal/network/zeromq/Handle.hpp"
 #include "internal/otx/server/MessageProcessor.hpp"
 #include "internal/otx/server/Types.hpp"
-#include "internal/util/Lockable.hpp"
+#include "internal/util/Mutex.hpp"
 #include "opentxs/Version.hpp"
 #include "opentxs/core/ByteArray.hpp"
 #include "opentxs/network/zeromq/ListenCallback.hpp"
@@ -32,6 +35,8 @@
 #include "opentxs/network/zeromq/socket/Sender.hpp"
 #include "opentxs/network/zeromq/socket/Socket.hpp"
 #include "opentxs/util/Container.hpp"
+#include "otx/server/RequestLocks.hpp"
+#include "util/Gatekeeper.hpp"
 
 // NOLINTBEGIN(modernize-concat-nested-namespaces)
 namespace opentxs  // NOLINT
@@ -48,6 +53,7 @@ class Notary;
 
 namespace identifier
 {
+class Generic;
 class Nym;
 }  // namespace identifier
 
@@ -76,6 +82,8 @@ class Server;
 }  // namespace server
 
 class Data;
+class Message;
+class OTTransaction;
 class PasswordPrompt;
 class Secret;
 // }  // namespace v1
@@ -86,7 +94,20 @@ namespace zmq = opentxs::network::zeromq;
 
 namespace opentxs::server
 {
-class MessageProcessor::Imp final : Lockable
+// NOTE legacy requests are parsed on the frontend thread and routed by nym ID
+// to one of several shards. Each shard executes its requests serially on
+// ThreadPool::General so requests from unrelated nyms run in parallel while
+// requests from any one nym are processed in the order they arrived.
+//
+// Commands which only modify state belonging to the nyms and account named in
+// the request header hold processing_lock_ in shared mode and lock those
+// resources in a fixed order. Transfers, and inbox processing which only
+// involves pending transfers and item receipts, do the same after the
+// accounts named in the request payload and in the referenced inbox receipts
+// are added to the resources. Cron, and every other command which may modify
+// state that is only identified once the Notary parses the request payload,
+// holds processing_lock_ exclusively.
+class MessageProcessor::Imp final
 {
 public:
     auto DropIncoming(const int count) const noexcept -> void;
@@ -106,12 +127,26 @@ public:
     auto operator=(const Imp&) -> Imp& = delete;
     auto operator=(Imp&&) -> Imp& = delete;
 
-    ~Imp() final;
+    ~Imp();
 
 private:
     // connection identifier, old format
     using ConnectionData = std::pair<ByteArray, bool>;
 
+    struct Job {
+        zmq::Message incoming_;
+        bool tagged_;
+        std::shared_ptr<const opentxs::Message> request_;
+    };
+
+    struct Shard {
+        std::deque<Job> queue_{};
+        bool running_{};
+    };
+
+    using AccountIDs = UnallocatedVector<UnallocatedCString>;
+    using GuardedShard = libguarded::plain_guarded<Shard>;
+
     static constexpr auto zap_domain_{"opentxs-otx"};
 
     const api::session::Notary& api_;
@@ -130,20 +165,39 @@ private:
     mutable int drop_outgoing_;
     UnallocatedMap<identifier::Nym, ConnectionData> active_connections_;
     mutable std::shared_mutex connection_map_lock_;
+    RequestLocks locks_;
+    UnallocatedVector<GuardedShard> shards_;
+    Gatekeeper gate_;
 
     static auto get_connection(
         const network::zeromq::Message& incoming) noexcept -> ByteArray;
+    static auto resources(
+        const opentxs::Message& request,
+        const AccountIDs& accounts = {}) noexcept -> RequestLocks::Resources;
 
     auto extract_proto(const network::zeromq::Frame& incoming) const noexcept
         -> proto::ServerRequest;
+    auto inbox_accounts(
+        const identifier::Nym& nymID,
+        const identifier::Generic& accountID,
+        OTTransaction& processInbox,
+        AccountIDs& out) const noexcept -> bool;
+    auto parse_request(const zmq::Message& incoming) const noexcept
+        -> std::shared_ptr<const opentxs::Message>;
+    auto transaction_accounts(const opentxs::Message& request) const noexcept
+        -> std::optional<AccountIDs>;
 
     auto associate_connection(
         const bool oldFormat,
         const identifier::Nym& nymID,
         const Data& connection) noexcept -> void;
+    auto dispatch(Job&& job) noexcept -> void;
+    auto drain(const std::size_t shard) noexcept -> void;
+    auto execute(Job&& job) noexcept -> void;
     auto old_pipeline(zmq::Message&& message) noexcept -> void;
     auto process_backend(
         const bool tagged,
+        const opentxs::Message* request,
         network::zeromq::Message&& incoming) noexcept
         -> network::zeromq::Message;
     auto process_command(
@@ -156,7 +210,7 @@ private:
         const bool tagged,
         network::zeromq::Message&& incoming) noexcept -> void;
     auto process_message(
-        const UnallocatedCString& messageString,
+        const opentxs::Message& request,
         UnallocatedCString& reply) noexcept -> bool;
     auto process_notification(network::zeromq::Message&& incoming) noexcept
         -> void;
@@ -167,5 +221,6 @@ private:
     auto query_connection(const identifier::Nym& nymID) noexcept
         -> const ConnectionData&;
     auto run() noexcept -> void;
+    auto send_reply(zmq::Message&& reply) noexcept -> void;
 };
 }  // namespace opentxs::server
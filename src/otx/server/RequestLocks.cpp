@@ -0,0 +1,121 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                 // IWYU pragma: associated
+#include "1_Internal.hpp"               // IWYU pragma: associated
+#include "otx/server/RequestLocks.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+#include "internal/util/LogMacros.hpp"
+
+namespace opentxs::server
+{
+RequestLocks::RequestLocks() noexcept
+    : processing_lock_()
+    , resource_locks_()
+{
+}
+
+auto RequestLocks::Exclusive() const noexcept -> eLock
+{
+    return eLock{processing_lock_};
+}
+
+auto RequestLocks::IsParallel(const MessageType type) noexcept -> bool
+{
+    // NOTE these commands only modify the sender's context and nymbox, plus
+    // the nymbox of the recipient named in the request header in the case of
+    // sendNymMessage. Everything they read from shared server state is only
+    // ever modified while the processing lock is held exclusively, with the
+    // exception of transaction number issuance which Transactor serializes.
+    switch (type) {
+        case MessageType::pingNotary:
+        case MessageType::registerNym:
+        case MessageType::getRequestNumber:
+        case MessageType::getTransactionNumbers:
+        case MessageType::checkNym:
+        case MessageType::sendNymMessage:
+        case MessageType::getNymbox:
+        case MessageType::processNymbox:
+        case MessageType::getBoxReceipt:
+        case MessageType::getAccountData:
+        case MessageType::queryInstrumentDefinitions:
+        case MessageType::getInstrumentDefinition:
+        case MessageType::getMint:
+        case MessageType::getMarketList:
+        case MessageType::getMarketOffers:
+        case MessageType::getMarketRecentTrades:
+        case MessageType::getNymMarketOffers: {
+
+            return true;
+        }
+        default: {
+
+            return false;
+        }
+    }
+}
+
+auto RequestLocks::IsTransaction(const MessageType type) noexcept -> bool
+{
+    switch (type) {
+        case MessageType::notarizeTransaction:
+        case MessageType::processInbox: {
+
+            return true;
+        }
+        default: {
+
+            return false;
+        }
+    }
+}
+
+auto RequestLocks::Processing() const noexcept -> sLock
+{
+    return sLock{processing_lock_};
+}
+
+auto RequestLocks::Shared(const Resources& resources) const noexcept
+    -> SharedLock
+{
+    return Shared(Processing(), resources);
+}
+
+auto RequestLocks::Shared(sLock&& processing, const Resources& resources)
+    const noexcept -> SharedLock
+{
+    OT_ASSERT(processing.owns_lock());
+
+    auto stripes = UnallocatedVector<std::size_t>{};
+    stripes.reserve(resources.size());
+
+    for (const auto& id : resources) {
+        if (false == id.empty()) { stripes.emplace_back(Stripe(id)); }
+    }
+
+    std::sort(stripes.begin(), stripes.end());
+    stripes.erase(std::unique(stripes.begin(), stripes.end()), stripes.end());
+    auto out = SharedLock{std::move(processing), {}};
+    out.resources_.reserve(stripes.size());
+
+    for (const auto stripe : stripes) {
+        out.resources_.emplace_back(resource_locks_[stripe]);
+    }
+
+    return out;
+}
+
+auto RequestLocks::Stripe(const std::string_view resource) noexcept
+    -> std::size_t
+{
+    return std::hash<std::string_view>{}(resource) % stripes_;
+}
+
+RequestLocks::~RequestLocks() = default;
+}  // namespace opentxs::server
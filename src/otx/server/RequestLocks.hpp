@@ -0,0 +1,60 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+
+#include "internal/otx/Types.hpp"
+#include "internal/util/Mutex.hpp"
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs::server
+{
+// NOTE requests which only involve the nyms and accounts they name hold the
+// processing lock shared plus one mutex per stripe those resources hash to.
+// Everything else, including cron, holds the processing lock exclusively.
+class RequestLocks
+{
+public:
+    using Resources = UnallocatedVector<std::string_view>;
+
+    struct SharedLock {
+        sLock processing_;
+        UnallocatedVector<Lock> resources_;
+    };
+
+    static constexpr auto stripes_ = std::size_t{256};
+
+    static auto IsParallel(const MessageType type) noexcept -> bool;
+    static auto IsTransaction(const MessageType type) noexcept -> bool;
+    static auto Stripe(const std::string_view resource) noexcept
+        -> std::size_t;
+
+    auto Exclusive() const noexcept -> eLock;
+    auto Processing() const noexcept -> sLock;
+    // NOTE stripes are locked in ascending order so requests which name the
+    // same resources in a different order can not deadlock
+    auto Shared(const Resources& resources) const noexcept -> SharedLock;
+    auto Shared(sLock&& processing, const Resources& resources) const noexcept
+        -> SharedLock;
+
+    RequestLocks() noexcept;
+    RequestLocks(const RequestLocks&) = delete;
+    RequestLocks(RequestLocks&&) = delete;
+    auto operator=(const RequestLocks&) -> RequestLocks& = delete;
+    auto operator=(RequestLocks&&) -> RequestLocks& = delete;
+
+    ~RequestLocks();
+
+private:
+    mutable std::shared_mutex processing_lock_;
+    mutable std::array<std::mutex, stripes_> resource_locks_;
+};
+}  // namespace opentxs::server
@@ -32,6 +32,7 @@ namespace opentxs::server
 Transactor::Transactor(Server& server, const PasswordPrompt& reason)
     : server_(server)
     , reason_(reason)
+    , number_lock_()
     , transactionNumber_(0)
     , idToBasketMap_()
     , contractIdToBasketAccountId_()
@@ -50,6 +51,17 @@ Transactor::Transactor(Server& server, const PasswordPrompt& reason)
 auto Transactor::issueNextTransactionNumber(
     TransactionNumber& lTransactionNumber) -> bool
 {
+    const auto lock = Lock{number_lock_};
+
+    return issue_next_number(lock, lTransactionNumber);
+}
+
+auto Transactor::issue_next_number(
+    const Lock& lock,
+    TransactionNumber& lTransactionNumber) -> bool
+{
+    OT_ASSERT(lock.owns_lock());
+
     // transactionNumber_ stores the last VALID AND ISSUED transaction number.
     // So first, we increment that, since we don't want to issue the same number
     // twice.
@@ -73,7 +85,9 @@ auto Transactor::issueNextTransactionNumberToNym(
     otx::context::Client& context,
     TransactionNumber& lTransactionNumber) -> bool
 {
-    if (!issueNextTransactionNumber(lTransactionNumber)) { return false; }
+    const auto lock = Lock{number_lock_};
+
+    if (!issue_next_number(lock, lTransactionNumber)) { return false; }
 
     // Each Nym stores the transaction numbers that have been issued to it.
     // (On client AND server side.)
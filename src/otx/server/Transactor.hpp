@@ -7,10 +7,12 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 
 #include "internal/api/session/Wallet.hpp"
 #include "internal/otx/AccountList.hpp"
 #include "internal/otx/common/Account.hpp"
+#include "internal/util/Mutex.hpp"
 #include "opentxs/util/Container.hpp"
 #include "opentxs/util/Numbers.hpp"
 
@@ -104,6 +106,9 @@ private:
 
     Server& server_;
     const PasswordPrompt& reason_;
+    // Serializes transaction number issuance, which may be requested by
+    // several MessageProcessor shards at once
+    std::mutex number_lock_;
     // This stores the last VALID AND ISSUED transaction number.
     TransactionNumber transactionNumber_;
     // maps basketId with basketAccountId
@@ -114,5 +119,8 @@ private:
     BasketsMap contractIdToBasketAccountId_;
     // The list of voucher accounts (see GetVoucherAccount below for details)
     otx::internal::AccountList voucherAccounts_;
+
+    auto issue_next_number(const Lock& lock, TransactionNumber& txNumber)
+        -> bool;
 };
 }  // namespace opentxs::server
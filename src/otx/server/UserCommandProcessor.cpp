@@ -902,7 +902,12 @@ auto UserCommandProcessor::cmd_get_box_receipt(ReplyMessage& reply) const
         return false;
     }
 
-    auto transaction = box->GetTransaction(number);
+    // NOTE the box is only read so the requested receipt is loaded on demand
+    // rather than replacing the abbreviated record. If the receipt can not be
+    // loaded, perhaps because it is legacy data which is not abbreviated, the
+    // record from the box is returned instead.
+    box->EnableLazyReceipts();
+    const auto transaction = box->GetTransaction(number);
 
     if (nullptr == transaction) {
         LogError()(OT_PRETTY_CLASS())("Transaction not found: ")(number)(".")
@@ -911,16 +916,6 @@ auto UserCommandProcessor::cmd_get_box_receipt(ReplyMessage& reply) const
         return false;
     }
 
-    box->LoadBoxReceipt(number);
-    // The above call will replace transaction, inside box, with the full
-    // version (instead of the abbreviated version) of that transaction, meaning
-    // that the transaction pointer is now a bad pointer, if that call was
-    // successful. Therefore we just call GetTransaction() AGAIN. This way,
-    // whether LoadBoxReceipt() failed or not (perhaps it's legacy data and is
-    // already not abbreviated, and thus the LoadBoxReceipt call failed, but
-    // that's doesn't mean we're going to fail HERE, now does it?)
-    transaction = box->GetTransaction(number);
-
     if (false == verify_transaction(transaction.get(), serverNym)) {
         LogError()(OT_PRETTY_CLASS())("Invalid box item.").Flush();
 
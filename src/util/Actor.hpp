@@ -8,8 +8,12 @@
 #pragma once
 
 #include <boost/system/error_code.hpp>
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <functional>
 #include <future>
@@ -64,6 +68,33 @@ class Timer;
 
 namespace opentxs
 {
+struct ActorMetrics {
+    // Bucket 0 counts zero values and bucket n counts values in the range
+    // [2^(n-1), 2^n). The last bucket also counts all larger values.
+    using Histogram = std::array<std::atomic<std::uint64_t>, 32>;
+
+    // Number of messages waiting in the deferral cache when a message arrives
+    Histogram queue_depth_{};
+    // Time spent executing the state machine, in microseconds
+    Histogram state_machine_{};
+    // Number of times execution of the state machine was postponed by the
+    // rate limiter
+    std::atomic<std::uint64_t> rate_limited_{};
+
+    static auto Record(Histogram& histogram, std::uint64_t value) noexcept
+        -> void
+    {
+        auto bucket = std::size_t{0};
+
+        while ((0u < value) && ((bucket + 1u) < histogram.size())) {
+            value >>= 1u;
+            ++bucket;
+        }
+
+        histogram[bucket].fetch_add(1u, std::memory_order_relaxed);
+    }
+};
+
 template <typename CRTP, typename JobType>
 class Actor : virtual public Allocated
 {
@@ -76,6 +107,7 @@ public:
     {
         return pipeline_.get_allocator();
     }
+    auto Metrics() const noexcept -> const ActorMetrics& { return metrics_; }
 
 protected:
     using Work = JobType;
@@ -133,21 +165,32 @@ protected:
     }
     auto do_work() noexcept -> void
     {
-        rate_limit_state_machine();
+        if (rate_limit_state_machine()) { return; }
+
         state_machine_queued_.store(false);
-        repeat(downcast().work());
+        const auto start = Clock::now();
+        const auto again = downcast().work();
+        const auto elapsed =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                Clock::now() - start);
+        ActorMetrics::Record(
+            metrics_.state_machine_,
+            static_cast<std::uint64_t>(
+                std::max(elapsed, decltype(elapsed)::zero()).count()));
+        repeat(again);
     }
     auto flush_cache() noexcept -> void
     {
+        const auto count = cache_.size();
+
+        if (0u == count) { return; }
+
         retry_.Cancel();
 
-        const auto count = cache_.size();
+        if (state_machine_deferred_) { schedule_state_machine(); }
 
-        if (0u < count) {
-            log_(name_)(" ")(__FUNCTION__)(": flushing ")(cache_.size())(
-                " cached messages")
-                .Flush();
-        }
+        log_(name_)(" ")(__FUNCTION__)(": flushing ")(count)(" cached messages")
+            .Flush();
 
         while (0u < cache_.size()) {
             auto message = Message{std::move(cache_.front())};
@@ -215,7 +258,9 @@ protected:
         , last_executed_(Clock::now())
         , cache_(alloc)
         , state_machine_queued_(false)
+        , state_machine_deferred_(false)
         , retry_(api.Network().Asio().Internal().GetTimer())
+        , metrics_()
     {
         log_(name_)(" ")(__FUNCTION__)(": using ZMQ batch ")(
             pipeline_.BatchID())
@@ -233,20 +278,50 @@ private:
     Time last_executed_;
     std::queue<Message, Deque<Message>> cache_;
     mutable std::atomic<bool> state_machine_queued_;
+    bool state_machine_deferred_;
     Timer retry_;
+    ActorMetrics metrics_;
 
-    auto rate_limit_state_machine() const noexcept
+    auto rate_limit() const noexcept -> std::chrono::microseconds
     {
-        const auto wait = std::chrono::duration_cast<std::chrono::microseconds>(
+        return std::chrono::duration_cast<std::chrono::microseconds>(
             rate_limit_ - (Clock::now() - last_executed_));
+    }
+    // NOTE rather than blocking the thread, which is shared with other actors,
+    // postpone the state machine and continue processing incoming messages
+    auto rate_limit_state_machine() noexcept -> bool
+    {
+        const auto wait = rate_limit();
 
         if (0 < wait.count()) {
             log_(name_)(" ")(__FUNCTION__)(": rate limited for ")(wait.count())(
                 " microseconds")
                 .Flush();
-            Sleep(wait);
+            metrics_.rate_limited_.fetch_add(1u, std::memory_order_relaxed);
+            state_machine_deferred_ = true;
+            schedule_state_machine(wait);
+
+            return true;
+        } else {
+            state_machine_deferred_ = false;
+
+            return false;
         }
     }
+    auto schedule_state_machine() noexcept -> void
+    {
+        schedule_state_machine(
+            std::max(rate_limit(), std::chrono::microseconds{0}));
+    }
+    auto schedule_state_machine(const std::chrono::microseconds& wait) noexcept
+        -> void
+    {
+        retry_.Cancel();
+        retry_.SetRelative(wait);
+        retry_.Wait([this](const auto& ec) {
+            if (!ec) { pipeline_.Push(MakeWork(OT_ZMQ_STATE_MACHINE_SIGNAL)); }
+        });
+    }
 
     auto decode_message_type(const network::zeromq::Message& in) noexcept(false)
     {
@@ -390,6 +465,7 @@ private:
         try {
             const auto [work, type, isInit, canDrop, initFinished] =
                 decode_message_type(in);
+            ActorMetrics::Record(metrics_.queue_depth_, cache_.size());
             auto lock = std::unique_lock<std::timed_mutex>{reorg_lock_, 1s};
 
             if (false == lock.owns_lock()) {
@@ -400,10 +476,10 @@ private:
                         log)(" until reorg is processed")
                         .Flush();
                     defer(std::move(in));
-                    retry_.SetRelative(1s);
-                    retry_.Wait([this](const auto& e) {
-                        if (!e) { trigger(); }
-                    });
+                    // NOTE the state machine signal is sent directly since
+                    // trigger() has no effect while a rate limited execution
+                    // is pending, and this timer replaces that deferral
+                    schedule_state_machine(1s);
                 };
 
                 if (false == initFinished) {
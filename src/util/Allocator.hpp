@@ -10,10 +10,10 @@ extern "C" {
 }
 
 #include <cstddef>
-#include <cstdlib>
 #include <limits>
+#include <new>
 
-#include "opentxs/util/Log.hpp"
+#include "util/SecureArena.hpp"
 
 namespace opentxs
 {
@@ -21,6 +21,8 @@ template <typename T>
 struct SecureAllocator {
     using value_type = T;
 
+    static_assert(alignof(T) <= SecureArena::min_chunk_);
+
     SecureAllocator()
     {
         if (0 > ::sodium_init()) { throw std::bad_alloc(); }
@@ -39,31 +41,12 @@ struct SecureAllocator {
 
         if (items > limit) { throw std::bad_alloc(); }
 
-        const auto bytes = items * sizeof(value_type);
-        auto* output = std::malloc(bytes);
-
-        if (nullptr == output) { throw std::bad_alloc(); }
-
-        static auto warn{false};
-
-        if (0 > ::sodium_mlock(output, bytes)) {
-            if (false == warn) {
-                LogVerbose()("Unable to lock memory. Passwords and/or secret "
-                             "keys may be swapped to disk")
-                    .Flush();
-            }
-
-            warn = true;
-        } else {
-            warn = false;
-        }
-
-        return static_cast<value_type*>(output);
+        return static_cast<value_type*>(
+            SecureArena::Get().Allocate(items * sizeof(value_type)));
     }
-    auto deallocate(value_type* in, const std::size_t bytes) -> void
+    auto deallocate(value_type* in, const std::size_t items) -> void
     {
-        ::sodium_munlock(in, bytes);
-        std::free(in);
+        SecureArena::Get().Release(in, items * sizeof(value_type));
     }
 };
 
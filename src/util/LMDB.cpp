@@ -11,50 +11,60 @@ extern "C" {
 #include <lmdb.h>
 }
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
+#include <exception>
 #include <limits>
 #include <mutex>
 #include <stdexcept>
+#include <thread>
 #include <tuple>
 
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
 #include "opentxs/util/Log.hpp"
 #include "opentxs/util/Types.hpp"
 #include "util/FileSize.hpp"
 #include "util/ScopeGuard.hpp"
+#include "util/Thread.hpp"
 
 namespace opentxs::storage::lmdb
 {
 struct LMDB::Imp {
-    auto Commit() const noexcept -> bool
+    auto Batch(BatchCallback&& cb) const noexcept -> std::future<bool>
     {
+        auto promise = std::promise<bool>{};
+        auto output = promise.get_future();
+
         try {
-            auto lock = Lock{pending_lock_};
-            auto tx = TransactionRW(nullptr);
-            auto& success = tx.success_;
-            auto post = ScopeGuard{[&] { pending_.clear(); }};
+            std::call_once(writer_started_, [this] {
+                writer_ = std::thread{&Imp::write_batches, this};
+            });
+            auto lock = Lock{batch_lock_};
+            batch_.emplace_back(std::move(cb), std::move(promise), false);
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+            promise.set_value(false);
 
-            for (auto& [table, mode, index, data] : pending_) {
-                auto dbi = db_.at(table);
-                auto key =
-                    MDB_val{index.size(), const_cast<char*>(index.data())};
-                auto value =
-                    MDB_val{data.size(), const_cast<char*>(data.data())};
+            return output;
+        }
 
-                if (const auto rc = ::mdb_put(tx, dbi, &key, &value, 0);
-                    0 != rc) {
-                    throw std::runtime_error{::mdb_strerror(rc)};
-                } else {
-                    success = true;
-                }
-            }
+        batch_cv_.notify_one();
 
-            return success;
-        } catch (const std::exception& e) {
-            LogTrace()(OT_PRETTY_CLASS())(e.what()).Flush();
+        return output;
+    }
+    auto Commit() const noexcept -> bool
+    {
+        auto lock = Lock{pending_lock_};
+        auto post = ScopeGuard{[&] { pending_.clear(); }};
 
-            return false;
-        }
+        if (commit(lock)) { return true; }
+
+        // NOTE the failed transaction was aborted so the pending items may be
+        // written again once the map has been enlarged
+        return grow_pending() && commit(lock);
     }
     auto Delete(const Table table, MDB_txn* parent) const noexcept -> bool
     {
@@ -257,6 +267,13 @@ struct LMDB::Imp {
             return false;
         }
     }
+    // NOTE nested transactions are not available in MDB_WRITEMAP mode so a
+    // write transaction with a parent shares the parent's transaction. Any
+    // failure is then resolved when the parent is finalized.
+    auto Nests(MDB_txn* parent) const noexcept -> bool
+    {
+        return (nullptr == parent) || (0u == (flags_ & MDB_WRITEMAP));
+    }
     auto Queue(
         const Table table,
         const ReadView key,
@@ -440,6 +457,289 @@ struct LMDB::Imp {
         const ReadView data,
         MDB_txn* parent,
         const Flags flags) const noexcept -> Result
+    {
+        const auto output = store(table, index, data, parent, flags);
+
+        if (retry(output, parent)) {
+
+            return store(table, index, data, parent, flags);
+        }
+
+        return output;
+    }
+    auto StoreOrUpdate(
+        const Table table,
+        const ReadView index,
+        const UpdateCallback cb,
+        MDB_txn* parent,
+        const Flags flags) const noexcept -> Result
+    {
+        const auto output = store_or_update(table, index, cb, parent, flags);
+
+        if (retry(output, parent)) {
+
+            return store_or_update(table, index, cb, parent, flags);
+        }
+
+        return output;
+    }
+    auto TransactionRO() const noexcept(false) -> Transaction
+    {
+        return {*this, false, nullptr};
+    }
+    auto TransactionRW(MDB_txn* parent) const noexcept(false) -> Transaction
+    {
+        return {
+            *this,
+            true,
+            (nullptr == parent) ? std::make_unique<Lock>(write_lock_)
+                                : std::make_unique<Lock>(),
+            parent};
+    }
+
+    auto begin_transaction(const bool rw, MDB_txn* parent) const
+        noexcept(false) -> MDB_txn*
+    {
+        const auto counted = (nullptr == parent);
+
+        if (counted) { start_transaction(); }
+
+        auto* output = static_cast<MDB_txn*>(nullptr);
+        const Flags flags = rw ? 0u : MDB_RDONLY;
+
+        if (0 != ::mdb_txn_begin(env_, parent, flags, &output)) {
+            if (counted) { finish_transaction(); }
+
+            throw std::runtime_error("Failed to start transaction");
+        }
+
+        return output;
+    }
+    auto end_transaction(MDB_txn* tx, const bool commit, const bool counted)
+        const noexcept -> bool
+    {
+        auto output{true};
+
+        if (commit) {
+            output = 0 == check(::mdb_txn_commit(tx));
+        } else {
+            ::mdb_txn_abort(tx);
+        }
+
+        if (counted) { finish_transaction(); }
+
+        return output;
+    }
+
+    Imp(const TableNames& names,
+        const std::filesystem::path& folder,
+        const TablesToInit init,
+        const Flags flags,
+        const std::size_t extraTables) noexcept
+        : names_(names)
+        , flags_(flags)
+        , env_(nullptr)
+        , db_()
+        , pending_()
+        , pending_lock_()
+        , write_lock_()
+        , batch_()
+        , batch_lock_()
+        , batch_cv_()
+        , batch_running_(true)
+        , writer_started_()
+        , writer_()
+        , active_(0)
+        , grow_(false)
+        , resizing_(false)
+        , resize_lock_()
+        , resize_cv_()
+    {
+        init_environment(folder, init.size() + extraTables, flags);
+        init_tables(init);
+    }
+    Imp(const Imp&) = delete;
+    Imp(Imp&&) = delete;
+    auto operator=(const Imp&) -> Imp& = delete;
+    auto operator=(Imp&&) -> Imp& = delete;
+
+    ~Imp()
+    {
+        {
+            auto lock = Lock{batch_lock_};
+            batch_running_ = false;
+        }
+
+        batch_cv_.notify_one();
+
+        if (writer_.joinable()) { writer_.join(); }
+
+        close_env();
+    }
+
+private:
+    using NewKey =
+        std::tuple<Table, Mode, UnallocatedCString, UnallocatedCString>;
+    using Pending = UnallocatedVector<NewKey>;
+    using BatchJob = std::tuple<BatchCallback, std::promise<bool>, bool>;
+    using BatchQueue = UnallocatedVector<BatchJob>;
+
+    static constexpr auto batch_interval_ = std::chrono::milliseconds{2};
+    static constexpr auto batch_limit_ = std::size_t{256};
+    static constexpr auto resize_timeout_ = std::chrono::milliseconds{250};
+
+    const TableNames& names_;
+    const Flags flags_;
+    mutable MDB_env* env_;
+    mutable Databases db_;
+    mutable Pending pending_;
+    mutable std::mutex pending_lock_;
+    mutable std::mutex write_lock_;
+    mutable BatchQueue batch_;
+    mutable std::mutex batch_lock_;
+    mutable std::condition_variable batch_cv_;
+    bool batch_running_;
+    mutable std::once_flag writer_started_;
+    mutable std::thread writer_;
+    mutable std::atomic<std::size_t> active_;
+    mutable std::atomic<bool> grow_;
+    mutable std::atomic<bool> resizing_;
+    mutable std::mutex resize_lock_;
+    mutable std::condition_variable resize_cv_;
+
+    auto check(const int rc) const noexcept -> int
+    {
+        if (MDB_MAP_FULL == rc) { grow_.store(true); }
+
+        return rc;
+    }
+    auto commit(const Lock&) const noexcept -> bool
+    {
+        try {
+            auto tx = TransactionRW(nullptr);
+            auto& success = tx.success_;
+
+            for (auto& [table, mode, index, data] : pending_) {
+                auto dbi = db_.at(table);
+                auto key =
+                    MDB_val{index.size(), const_cast<char*>(index.data())};
+                auto value =
+                    MDB_val{data.size(), const_cast<char*>(data.data())};
+
+                const auto rc = check(::mdb_put(tx, dbi, &key, &value, 0));
+
+                if (0 != rc) {
+                    success = false;
+
+                    throw std::runtime_error{::mdb_strerror(rc)};
+                } else {
+                    success = true;
+                }
+            }
+
+            return success;
+        } catch (const std::exception& e) {
+            LogTrace()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            return false;
+        }
+    }
+    auto finish_transaction() const noexcept -> void
+    {
+        if (auto& open = open_transactions(); 0_uz < open) { --open; }
+
+        if ((1_uz == active_.fetch_sub(1)) && resizing_.load()) {
+            auto lock = Lock{resize_lock_};
+            resize_cv_.notify_all();
+        }
+    }
+    // WARNING resize_lock_ must be held
+    auto grow(Lock& lock) const noexcept -> void
+    {
+        resizing_.store(true);
+        const auto drained = resize_cv_.wait_for(
+            lock, resize_timeout_, [this] { return 0_uz == active_.load(); });
+
+        if (drained) {
+            auto info = MDB_envinfo{};
+            ::mdb_env_info(env_, &info);
+            const auto target = 2_uz * info.me_mapsize;
+
+            if (const auto rc = ::mdb_env_set_mapsize(env_, target); 0 == rc) {
+                grow_.store(false);
+                LogDetail()(OT_PRETTY_CLASS())("map size increased to ")(
+                    target)(" bytes")
+                    .Flush();
+            } else {
+                LogError()(OT_PRETTY_CLASS())("failed to increase map size: ")(
+                    ::mdb_strerror(rc))
+                    .Flush();
+            }
+        } else {
+            LogDetail()(OT_PRETTY_CLASS())(
+                "map resize deferred due to active transactions")
+                .Flush();
+        }
+
+        resizing_.store(false);
+        resize_cv_.notify_all();
+    }
+    auto grow_pending() const noexcept -> bool
+    {
+        return grow_.load() && (0_uz == open_transactions());
+    }
+    // NOTE number of outstanding top level transactions opened by the
+    // current thread in this environment
+    auto open_transactions() const noexcept -> std::size_t&
+    {
+        static thread_local auto map =
+            UnallocatedMap<const Imp*, std::size_t>{};
+
+        return map[this];
+    }
+    auto retry(const Result& result, MDB_txn* parent) const noexcept -> bool
+    {
+        return (nullptr == parent) && (MDB_MAP_FULL == result.second) &&
+               grow_pending();
+    }
+    // NOTE the map size may only be changed while no transactions are active
+    // in this process. A thread which already holds a transaction is allowed
+    // to open another one immediately, otherwise new transactions wait for a
+    // pending resize to complete.
+    auto start_transaction() const noexcept -> void
+    {
+        auto& open = open_transactions();
+
+        if (0_uz < open) {
+            ++active_;
+            ++open;
+
+            return;
+        }
+
+        ++active_;
+
+        if ((false == grow_.load()) && (false == resizing_.load())) {
+            ++open;
+
+            return;
+        }
+
+        finish_transaction();
+        auto lock = Lock{resize_lock_};
+        resize_cv_.wait(lock, [this] { return false == resizing_.load(); });
+
+        if (grow_.load()) { grow(lock); }
+
+        ++active_;
+        ++open;
+    }
+    auto store(
+        const Table table,
+        const ReadView index,
+        const ReadView data,
+        MDB_txn* parent,
+        const Flags flags) const noexcept -> Result
     {
         auto output = Result{false, MDB_LAST_ERRCODE};
         auto& [success, code] = output;
@@ -448,12 +748,12 @@ struct LMDB::Imp {
         const auto dbi = db_.at(table);
         auto key = MDB_val{index.size(), const_cast<char*>(index.data())};
         auto value = MDB_val{data.size(), const_cast<char*>(data.data())};
-        code = ::mdb_put(transaction, dbi, &key, &value, flags);
+        code = check(::mdb_put(transaction, dbi, &key, &value, flags));
         success = 0 == code;
 
         return output;
     }
-    auto StoreOrUpdate(
+    auto store_or_update(
         const Table table,
         const ReadView index,
         const UpdateCallback cb,
@@ -495,7 +795,7 @@ struct LMDB::Imp {
             const auto bytes = cb(previous);
             auto replace =
                 MDB_val{bytes.size(), const_cast<std::byte*>(bytes.data())};
-            code = ::mdb_put(tx, dbi, &key, &replace, flags);
+            code = check(::mdb_put(tx, dbi, &key, &replace, flags));
             success = 0 == code;
         } catch (const std::exception& e) {
             LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
@@ -503,54 +803,132 @@ struct LMDB::Imp {
 
         return output;
     }
-    auto TransactionRO() const noexcept(false) -> Transaction
+    auto commit_batch(BatchQueue& jobs) const noexcept -> void
     {
-        return {env_, false, nullptr};
+        auto committed = write_batch(jobs, false);
+
+        if ((false == committed) && grow_pending()) {
+            // NOTE the shared transaction was aborted so every callback may be
+            // executed again once the map has been enlarged
+            committed = write_batch(jobs, false);
+        } else if (committed && grow_pending()) {
+            // NOTE a callback which filled the map was aborted by itself, so
+            // only the failed callbacks are executed again once the map has
+            // been enlarged
+            committed = write_batch(jobs, true);
+        }
+
+        if (false == committed) {
+            LogError()(OT_PRETTY_CLASS())("failed to commit batch of ")(
+                jobs.size())(" transactions")
+                .Flush();
+        }
+
+        for (auto& [cb, promise, result] : jobs) {
+            promise.set_value(committed && result);
+        }
     }
-    auto TransactionRW(MDB_txn* parent) const noexcept(false) -> Transaction
+    auto execute(const BatchCallback& cb, Transaction& tx) const noexcept
+        -> bool
     {
-        return {
-            env_,
-            true,
-            (nullptr == parent) ? std::make_unique<Lock>(write_lock_)
-                                : std::make_unique<Lock>(),
-            parent};
-    }
+        try {
 
-    Imp(const TableNames& names,
-        const std::filesystem::path& folder,
-        const TablesToInit init,
-        const Flags flags,
-        const std::size_t extraTables) noexcept
-        : names_(names)
-        , env_(nullptr)
-        , db_()
-        , pending_()
-        , pending_lock_()
-        , write_lock_()
-    {
-        init_environment(folder, init.size() + extraTables, flags);
-        init_tables(init);
+            return bool(cb) && cb(tx);
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            return false;
+        }
     }
-    Imp(const Imp&) = delete;
-    Imp(Imp&&) = delete;
-    auto operator=(const Imp&) -> Imp& = delete;
-    auto operator=(Imp&&) -> Imp& = delete;
+    auto write_batch(BatchQueue& jobs, const bool failedOnly) const noexcept
+        -> bool
+    {
+        // NOTE nested transactions are not available in MDB_WRITEMAP mode. In
+        // that case a failed callback aborts the shared transaction and every
+        // callback in the batch is repeated in its own transaction.
+        const auto nested = 0u == (flags_ & MDB_WRITEMAP);
+        auto failed{false};
 
-    ~Imp() { close_env(); }
+        try {
+            auto tx = TransactionRW(nullptr);
 
-private:
-    using NewKey =
-        std::tuple<Table, Mode, UnallocatedCString, UnallocatedCString>;
-    using Pending = UnallocatedVector<NewKey>;
+            for (auto& [cb, promise, result] : jobs) {
+                if (failedOnly && result) { continue; }
 
-    const TableNames& names_;
-    mutable MDB_env* env_;
-    mutable Databases db_;
-    mutable Pending pending_;
-    mutable std::mutex pending_lock_;
-    mutable std::mutex write_lock_;
+                if (nested) {
+                    auto child = TransactionRW(tx);
+                    result = execute(cb, child);
+
+                    if (false == child.Finalize(result)) { result = false; }
+                } else {
+                    result = execute(cb, tx);
+
+                    if (false == result) {
+                        failed = true;
+
+                        break;
+                    }
+                }
+            }
+
+            if (false == failed) { return tx.Finalize(true); }
+
+            tx.Finalize(false);
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+
+            return false;
+        }
+
+        for (auto& [cb, promise, result] : jobs) {
+            if (failedOnly && result) { continue; }
 
+            try {
+                auto tx = TransactionRW(nullptr);
+                result = execute(cb, tx) && tx.Finalize(true);
+            } catch (const std::exception& e) {
+                LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+                result = false;
+            }
+        }
+
+        return true;
+    }
+    auto write_batches() const noexcept -> void
+    {
+        SetThisThreadsName("LMDB writer");
+        auto lock = Lock{batch_lock_};
+        auto last = std::chrono::steady_clock::time_point{};
+
+        while (true) {
+            batch_cv_.wait(lock, [this] {
+                return (false == batch_.empty()) || (false == batch_running_);
+            });
+
+            if (batch_.empty()) { return; }
+
+            // NOTE a writer which arrives shortly after the previous commit is
+            // likely to be followed by others, so give them a chance to join
+            // this batch and share the cost of a single commit. A write which
+            // arrives while the writer is idle is committed immediately.
+            const auto busy =
+                (std::chrono::steady_clock::now() - last) < batch_interval_;
+
+            if (busy) {
+                batch_cv_.wait_for(lock, batch_interval_, [this] {
+                    return (batch_limit_ <= batch_.size()) ||
+                           (false == batch_running_);
+                });
+            }
+
+            auto jobs = BatchQueue{};
+            jobs.swap(batch_);
+            lock.unlock();
+            commit_batch(jobs);
+            last = std::chrono::steady_clock::now();
+            lock.lock();
+        }
+    }
     auto init_db(const Table table, unsigned int flags) noexcept -> MDB_dbi
     {
         MDB_txn* transaction{nullptr};
@@ -667,23 +1045,24 @@ LMDB::LMDB(LMDB&& rhs) noexcept
 }
 
 LMDB::Transaction::Transaction(
-    MDB_env* env,
+    const Imp& imp,
     const bool rw,
     std::unique_ptr<Lock> lock,
     MDB_txn* parent) noexcept(false)
     : success_(false)
+    , imp_(&imp)
+    , counted_(nullptr == parent)
+    , owned_(imp_->Nests(parent))
     , lock_(std::move(lock))
-    , ptr_(nullptr)
+    , ptr_(owned_ ? imp_->begin_transaction(rw, parent) : parent)
 {
-    const Flags flags = rw ? 0u : MDB_RDONLY;
-
-    if (0 != ::mdb_txn_begin(env, parent, flags, &ptr_)) {
-        throw std::runtime_error("Failed to start transaction");
-    }
 }
 
 LMDB::Transaction::Transaction(Transaction&& rhs) noexcept
     : success_(rhs.success_)
+    , imp_(rhs.imp_)
+    , counted_(rhs.counted_)
+    , owned_(rhs.owned_)
     , lock_(std::move(rhs.lock_))
     , ptr_(rhs.ptr_)
 {
@@ -710,14 +1089,9 @@ auto LMDB::Transaction::Finalize(const std::optional<bool> success) noexcept
 
         auto cleanup = Cleanup{ptr_};
 
-        if (success_) {
-
-            return 0 == ::mdb_txn_commit(ptr_);
-        } else {
-            ::mdb_txn_abort(ptr_);
+        if (false == owned_) { return success_; }
 
-            return true;
-        }
+        return imp_->end_transaction(ptr_, success_, counted_);
     }
 
     return false;
@@ -725,6 +1099,26 @@ auto LMDB::Transaction::Finalize(const std::optional<bool> success) noexcept
 
 LMDB::Transaction::~Transaction() { Finalize(); }
 
+auto EnvironmentOptions::Flags() const noexcept -> lmdb::Flags
+{
+    auto output = lmdb::Flags{0};
+
+    if (no_sync_) { output |= MDB_NOSYNC; }
+
+    if (no_meta_sync_) { output |= MDB_NOMETASYNC; }
+
+    if (write_map_) { output |= MDB_WRITEMAP; }
+
+    if (no_read_ahead_) { output |= MDB_NORDAHEAD; }
+
+    return output;
+}
+
+auto LMDB::Batch(BatchCallback&& cb) const noexcept -> std::future<bool>
+{
+    return imp_->Batch(std::move(cb));
+}
+
 auto LMDB::Commit() const noexcept -> bool { return imp_->Commit(); }
 
 auto LMDB::Delete(const Table table, MDB_txn* parent) const noexcept -> bool
@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <filesystem>
 #include <functional>
+#include <future>
 #include <iosfwd>
 #include <memory>
 #include <mutex>
@@ -39,8 +40,20 @@ using TablesToInit = UnallocatedVector<std::pair<Table, unsigned int>>;
 using TableNames = UnallocatedMap<Table, const UnallocatedCString>;
 using UpdateCallback = std::function<Space(const ReadView data)>;
 
+struct EnvironmentOptions {
+    bool no_sync_{false};
+    bool no_meta_sync_{false};
+    bool write_map_{false};
+    bool no_read_ahead_{false};
+
+    auto Flags() const noexcept -> lmdb::Flags;
+};
+
 class LMDB
 {
+private:
+    struct Imp;
+
 public:
     enum class Dir : bool { Forward = false, Backward = true };
     enum class Mode : bool { One = false, Multiple = true };
@@ -53,7 +66,7 @@ public:
         auto Finalize(const std::optional<bool> success = {}) noexcept -> bool;
 
         Transaction(
-            MDB_env* env,
+            const Imp& imp,
             const bool rw,
             std::unique_ptr<Lock> lock,
             MDB_txn* parent = nullptr) noexcept(false);
@@ -65,10 +78,27 @@ public:
         ~Transaction();
 
     private:
+        const Imp* imp_;
+        bool counted_;
+        // NOTE false if this object shares its parent's transaction because
+        // the environment does not support nested transactions
+        bool owned_;
         std::unique_ptr<Lock> lock_;
         MDB_txn* ptr_;
     };
 
+    using BatchCallback = std::function<bool(Transaction& tx)>;
+
+    // NOTE batched callbacks are executed by a dedicated writer thread, each
+    // in a nested transaction, and callbacks which are queued together are
+    // committed together. A callback submitted while the writer is idle is
+    // committed without delay. The future is satisfied once the shared
+    // transaction has been committed or aborted.
+    //
+    // The callback must only write through the supplied transaction. The
+    // future must not be waited on while holding a write transaction or a
+    // mutex which another batched callback may need to acquire.
+    auto Batch(BatchCallback&& cb) const noexcept -> std::future<bool>;
     auto Commit() const noexcept -> bool;
     auto Delete(const Table table, MDB_txn* parent = nullptr) const noexcept
         -> bool;
@@ -183,8 +213,6 @@ public:
     ~LMDB();
 
 private:
-    struct Imp;
-
     std::unique_ptr<Imp> imp_;
 
     auto read(const MDB_dbi dbi, const ReadCallback cb, const Dir dir)
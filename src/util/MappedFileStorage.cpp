@@ -9,10 +9,14 @@
 
 #include <boost/iostreams/device/mapped_file.hpp>
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cstring>
 #include <filesystem>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <utility>
 
@@ -48,17 +52,54 @@ constexpr auto get_start_position(const std::size_t file) noexcept
     return file * mapped_file_size();
 }
 
+constexpr auto get_size_class(std::size_t bytes) noexcept -> std::size_t
+{
+    auto output = 0_uz;
+
+    while (1_uz < bytes) {
+        bytes >>= 1_uz;
+        ++output;
+    }
+
+    return output;
+}
+
 struct MappedFileStorage::Imp {
     using FileCounter = std::size_t;
+    // NOTE ordered by size first so lower_bound finds the best fit
+    using Extent = std::pair<IndexData::ItemSize, IndexData::MemoryPosition>;
+    using SizeClass = UnallocatedSet<Extent>;
+    using FreeList = std::array<SizeClass, 64>;
+    using FreeIndex =
+        UnallocatedMap<IndexData::MemoryPosition, IndexData::ItemSize>;
+    using Relocations = UnallocatedMap<IndexData::MemoryPosition, IndexData>;
+
+    // NOTE remainders smaller than this are not worth tracking
+    static constexpr auto min_fragment_ = 64_uz;
+    // NOTE bounds the search for an extent located before a given position
+    static constexpr auto scan_limit_ = 64_uz;
 
     LMDB& lmdb_;
     const std::filesystem::path path_prefix_;
     const std::filesystem::path filename_prefix_;
     const int table_;
     const std::size_t key_;
+    const int free_table_;
+    // NOTE extents which were free when the storage was opened, grouped by
+    // size class. Extents released during this session are recorded in
+    // free_table_ but do not become reusable until the next session.
+    mutable FreeList free_;
+    mutable FreeIndex free_index_;
+    mutable Relocations moved_;
     mutable IndexData::MemoryPosition next_position_;
     mutable UnallocatedVector<boost::iostreams::mapped_file> files_;
 
+    auto add_free(const Extent& extent) noexcept -> void
+    {
+        const auto& [size, position] = extent;
+        free_.at(get_size_class(size)).emplace(extent);
+        free_index_.emplace(position, size);
+    }
     auto calculate_file_name(
         const std::filesystem::path& prefix,
         const FileCounter index) noexcept -> std::filesystem::path
@@ -72,6 +113,60 @@ struct MappedFileStorage::Imp {
 
         return prefix / filename;
     }
+    auto claim(
+        LMDB::Transaction& tx,
+        const Extent& extent,
+        const std::size_t bytes) noexcept -> bool
+    {
+        if (false == claim_stored(tx, extent, bytes)) { return false; }
+
+        claimed(extent, bytes);
+
+        return true;
+    }
+    auto claim_stored(
+        LMDB::Transaction& tx,
+        const Extent& extent,
+        const std::size_t bytes) noexcept -> bool
+    {
+        const auto& [size, position] = extent;
+
+        OT_ASSERT(bytes <= size);
+
+        const auto remainder = size - bytes;
+
+        if (false == lmdb_.Delete(free_table_, position, tx)) {
+            LogError()(OT_PRETTY_CLASS())("Failed to remove free extent")
+                .Flush();
+
+            return false;
+        }
+
+        if (min_fragment_ <= remainder) {
+            const auto result = lmdb_.Store(
+                free_table_, position + bytes, tsv(remainder), tx);
+
+            if (false == result.first) {
+                LogError()(OT_PRETTY_CLASS())("Failed to split free extent")
+                    .Flush();
+
+                return false;
+            }
+        }
+
+        return true;
+    }
+    auto claimed(const Extent& extent, const std::size_t bytes) noexcept
+        -> void
+    {
+        const auto& [size, position] = extent;
+        const auto remainder = size - bytes;
+        remove_free(extent);
+
+        if (min_fragment_ <= remainder) {
+            add_free(Extent{remainder, position + bytes});
+        }
+    }
     auto check_file(const FileCounter position) noexcept -> void
     {
         while (files_.size() < (position + 1)) {
@@ -120,8 +215,41 @@ struct MappedFileStorage::Imp {
             OT_FAIL;
         }
     }
-    auto get_read_view(const IndexData& index) noexcept -> ReadView
+    auto find_extent(
+        const std::size_t bytes,
+        const IndexData::MemoryPosition before =
+            std::numeric_limits<IndexData::MemoryPosition>::max()) noexcept
+        -> std::optional<Extent>
     {
+        const auto first = get_size_class(bytes);
+
+        for (auto n = first; n < free_.size(); ++n) {
+            const auto& extents = free_.at(n);
+            auto i = (n == first) ? extents.lower_bound(Extent{bytes, 0_uz})
+                                  : extents.begin();
+
+            for (auto count = 0_uz;
+                 (extents.end() != i) && (count < scan_limit_);
+                 ++i, ++count) {
+                if (i->second < before) { return *i; }
+            }
+        }
+
+        return std::nullopt;
+    }
+    auto forward(IndexData& index) const noexcept -> void
+    {
+        for (auto i = moved_.find(index.position_); moved_.end() != i;
+             i = moved_.find(index.position_)) {
+            if (i->second.size_ != index.size_) { break; }
+
+            index = i->second;
+        }
+    }
+    auto get_read_view(const IndexData& in) noexcept -> ReadView
+    {
+        auto index{in};
+        forward(index);
         const auto [file, offset] = get_offset(index.position_);
         check_file(file);
 
@@ -135,6 +263,7 @@ struct MappedFileStorage::Imp {
     {
         if (0 == bytes) { return {}; }
 
+        forward(index);
         const auto replace = bytes == index.size_;
         const auto output = [&] {
             const auto [file, offset] = get_offset(index.position_);
@@ -149,22 +278,38 @@ struct MappedFileStorage::Imp {
             return output();
         }
 
-        increment_index(index, bytes);
-        LogDebug()(OT_PRETTY_CLASS())("Storing new item at position ")(
-            index.position_)
-            .Flush();
-        const auto nextPosition = index.position_ + bytes;
+        const auto old{index};
 
-        if (cb && (false == cb(tx))) { return {}; }
+        if (const auto extent = find_extent(bytes); extent.has_value()) {
+            index.size_ = bytes;
+            index.position_ = extent->second;
+            LogDebug()(OT_PRETTY_CLASS())(
+                "Storing new item in free extent at position ")(index.position_)
+                .Flush();
 
-        if (false == update_next_position(nextPosition, tx)) {
-            LogError()(OT_PRETTY_CLASS())(
-                "Failed to update next write position")
+            if (cb && (false == cb(tx))) { return {}; }
+
+            if (false == claim(tx, *extent, bytes)) { return {}; }
+        } else {
+            increment_index(index, bytes);
+            LogDebug()(OT_PRETTY_CLASS())("Storing new item at position ")(
+                index.position_)
                 .Flush();
+            const auto nextPosition = index.position_ + bytes;
 
-            return {};
+            if (cb && (false == cb(tx))) { return {}; }
+
+            if (false == update_next_position(nextPosition, tx)) {
+                LogError()(OT_PRETTY_CLASS())(
+                    "Failed to update next write position")
+                    .Flush();
+
+                return {};
+            }
         }
 
+        if (false == release(tx, old)) { return {}; }
+
         return output();
     }
     auto increment_index(IndexData& index, std::size_t bytes) noexcept -> void
@@ -200,6 +345,100 @@ struct MappedFileStorage::Imp {
 
         return output;
     }
+    auto load_free_space(IndexData::MemoryPosition& next) noexcept -> void
+    {
+        auto stored = FreeIndex{};
+        lmdb_.Read(
+            free_table_,
+            [&](const auto key, const auto value) {
+                auto position = IndexData::MemoryPosition{};
+                auto size = IndexData::ItemSize{};
+
+                if ((sizeof(position) != key.size()) ||
+                    (sizeof(size) != value.size())) {
+                    LogError()(OT_PRETTY_CLASS())("Invalid free extent")
+                        .Flush();
+
+                    return true;
+                }
+
+                std::memcpy(&position, key.data(), key.size());
+                std::memcpy(&size, value.data(), value.size());
+                stored.emplace(position, size);
+
+                return true;
+            },
+            LMDB::Dir::Forward);
+        // NOTE merge adjacent extents which share a file
+        auto merged = FreeIndex{};
+
+        for (const auto& [position, size] : stored) {
+            if (0_uz == size) { continue; }
+
+            if (false == merged.empty()) {
+                auto& [lastPosition, lastSize] = *merged.rbegin();
+                const auto lastEnd = lastPosition + lastSize;
+                const auto sameFile = get_offset(lastPosition).first ==
+                                      get_offset(position + size - 1_uz).first;
+
+                if (sameFile && (lastEnd >= position)) {
+                    lastSize =
+                        std::max(lastEnd, position + size) - lastPosition;
+
+                    continue;
+                }
+            }
+
+            merged.emplace_hint(merged.end(), position, size);
+        }
+
+        const auto original = next;
+
+        // NOTE free extents at the end of the storage are returned to the
+        // unallocated region
+        while (false == merged.empty()) {
+            const auto last = std::prev(merged.end());
+            const auto& [position, size] = *last;
+
+            if ((position + size) != next) { break; }
+
+            next = position;
+            merged.erase(last);
+        }
+
+        if ((merged != stored) || (original != next)) {
+            LogVerbose()(OT_PRETTY_CLASS())("reclaiming ")(original - next)(
+                " bytes at end of storage and merging ")(stored.size())(
+                " free extents into ")(merged.size())
+                .Flush();
+            auto tx = lmdb_.TransactionRW();
+            auto success = lmdb_.Delete(free_table_, tx);
+
+            for (const auto& [position, size] : merged) {
+                if (false == success) { break; }
+
+                success =
+                    lmdb_.Store(free_table_, position, tsv(size), tx).first;
+            }
+
+            success =
+                success && lmdb_.Store(table_, tsv(key_), tsv(next), tx).first;
+
+            if (success && tx.Finalize(true)) {
+                remove_files(get_file_count(next));
+            } else {
+                LogError()(OT_PRETTY_CLASS())("Failed to update free list")
+                    .Flush();
+                next = original;
+
+                return;
+            }
+        }
+
+        for (const auto& [position, size] : merged) {
+            add_free(Extent{size, position});
+        }
+    }
     auto load_position(opentxs::storage::lmdb::LMDB& db) noexcept
         -> IndexData::MemoryPosition
     {
@@ -221,6 +460,112 @@ struct MappedFileStorage::Imp {
 
         return output;
     }
+    auto relocate(
+        LMDB::Transaction& tx,
+        IndexData& index,
+        UpdateCallback&& cb) noexcept -> bool
+    {
+        forward(index);
+
+        if (0_uz == index.size_) { return false; }
+
+        const auto extent = find_extent(index.size_, index.position_);
+
+        if (false == extent.has_value()) { return false; }
+
+        const auto old{index};
+
+        {
+            const auto from = get_offset(old.position_);
+            const auto to = get_offset(extent->second);
+            check_file(from.first);
+            check_file(to.first);
+            std::memcpy(
+                files_.at(to.first).data() + to.second,
+                files_.at(from.first).const_data() + from.second,
+                old.size_);
+        }
+
+        index.position_ = extent->second;
+        // NOTE the in-memory state is only updated once the transaction has
+        // been committed so that a failed relocation leaves nothing to undo
+        const auto success = [&] {
+            if (cb && (false == cb(tx))) { return false; }
+
+            if (false == claim_stored(tx, *extent, old.size_)) { return false; }
+
+            if (false == release(tx, old)) { return false; }
+
+            if (false == tx.Finalize(true)) {
+                LogError()(OT_PRETTY_CLASS())("Database error").Flush();
+
+                return false;
+            }
+
+            return true;
+        }();
+
+        if (false == success) {
+            index = old;
+
+            return false;
+        }
+
+        claimed(*extent, old.size_);
+        moved_.insert_or_assign(old.position_, index);
+        LogTrace()(OT_PRETTY_CLASS())("relocated item from position ")(
+            old.position_)(" to ")(index.position_)
+            .Flush();
+
+        return true;
+    }
+    auto release(LMDB::Transaction& tx, const IndexData& index) noexcept
+        -> bool
+    {
+        if (0_uz == index.size_) { return true; }
+
+        const auto result =
+            lmdb_.Store(free_table_, index.position_, tsv(index.size_), tx);
+
+        if (false == result.first) {
+            LogError()(OT_PRETTY_CLASS())("Failed to release extent").Flush();
+
+            return false;
+        }
+
+        return true;
+    }
+    auto remove_files(const FileCounter first) noexcept -> void
+    {
+        try {
+            for (auto file = first;; ++file) {
+                const auto path = calculate_file_name(path_prefix_, file);
+
+                if (false == fs::exists(path)) { break; }
+
+                LogVerbose()(OT_PRETTY_CLASS())("removing unused file ")(path)
+                    .Flush();
+                fs::remove(path);
+            }
+        } catch (const std::exception& e) {
+            LogError()(OT_PRETTY_CLASS())(e.what()).Flush();
+        }
+    }
+    auto remove_free(const Extent& extent) noexcept -> void
+    {
+        const auto& [size, position] = extent;
+        free_.at(get_size_class(size)).erase(extent);
+        free_index_.erase(position);
+    }
+    auto should_relocate(const IndexData& in) const noexcept -> bool
+    {
+        if (free_index_.empty()) { return false; }
+
+        auto index{in};
+        forward(index);
+
+        return free_index_.begin()->first < index.position_;
+    }
     auto update_next_position(
         IndexData::MemoryPosition position,
         LMDB::Transaction& tx) noexcept -> bool
@@ -243,13 +588,23 @@ struct MappedFileStorage::Imp {
         const std::filesystem::path& basePath,
         const std::filesystem::path filenamePrefix,
         int table,
-        std::size_t key) noexcept(false)
+        std::size_t key,
+        int freeTable) noexcept(false)
         : lmdb_(lmdb)
         , path_prefix_(basePath)
         , filename_prefix_(filenamePrefix)
         , table_(table)
         , key_(key)
-        , next_position_(load_position(lmdb_))
+        , free_table_(freeTable)
+        , free_()
+        , free_index_()
+        , moved_()
+        , next_position_([&] {
+            auto output = load_position(lmdb_);
+            load_free_space(output);
+
+            return output;
+        }())
         , files_(init_files(path_prefix_, next_position_))
     {
         static_assert(1 == get_file_count(0));
@@ -284,9 +639,16 @@ MappedFileStorage::MappedFileStorage(
     const std::filesystem::path& basePath,
     const std::filesystem::path filenamePrefix,
     int table,
-    std::size_t key) noexcept(false)
+    std::size_t key,
+    int freeTable) noexcept(false)
     : lmdb_(lmdb)
-    , imp_p_(std::make_unique<Imp>(lmdb, basePath, filenamePrefix, table, key))
+    , imp_p_(std::make_unique<Imp>(
+          lmdb,
+          basePath,
+          filenamePrefix,
+          table,
+          key,
+          freeTable))
     , imp_(*imp_p_)
 {
     OT_ASSERT(imp_p_);
@@ -315,5 +677,26 @@ auto MappedFileStorage::get_write_view(
     return imp_.get_write_view(tx, index, {}, size);
 }
 
+auto MappedFileStorage::relocate(
+    LMDB::Transaction& tx,
+    IndexData& index,
+    UpdateCallback&& cb) const noexcept -> bool
+{
+    return imp_.relocate(tx, index, std::move(cb));
+}
+
+auto MappedFileStorage::release(
+    LMDB::Transaction& tx,
+    const IndexData& index) const noexcept -> bool
+{
+    return imp_.release(tx, index);
+}
+
+auto MappedFileStorage::should_relocate(const IndexData& index) const noexcept
+    -> bool
+{
+    return imp_.should_relocate(index);
+}
+
 MappedFileStorage::~MappedFileStorage() = default;
 }  // namespace opentxs::util
@@ -41,8 +41,9 @@ protected:
     // supply an existing IndexData if you want to (potentially) replace the
     // existing item. An existing item will be overwritten if the size of the
     // old items matches the size of the new item; to do otherwise would be
-    // madness. If the size doesn't match then space will be allocated at the
-    // end of the file and we just forget about the old data.
+    // madness. If the size doesn't match then the old extent is released and
+    // the item is written to a free extent of sufficient size, or to the end
+    // of the file if no such extent exists.
     //
     // Regardless after this function is called the supplied index will be
     // updated to the location at which the return value points so you should
@@ -58,13 +59,31 @@ protected:
         LMDB::Transaction& tx,
         IndexData& index,
         std::size_t size) const noexcept -> WritableView;
+    // Add the extent occupied by a deleted item to the free list.
+    //
+    // Released extents are not reused until the next time the storage is
+    // opened because views obtained from get_read_view may still point to
+    // them.
+    auto release(LMDB::Transaction& tx, const IndexData& index) const noexcept
+        -> bool;
+    // Copy an item into a free extent located before its current position.
+    //
+    // Returns false if no suitable extent exists. On success the supplied
+    // index is updated, the callback is responsible for persisting it, the
+    // old extent is released, and the transaction is committed. Existing
+    // copies of the old index remain valid: they are redirected to the new
+    // location by both get_read_view and get_write_view.
+    auto relocate(LMDB::Transaction& tx, IndexData& index, UpdateCallback&& cb)
+        const noexcept -> bool;
+    auto should_relocate(const IndexData& index) const noexcept -> bool;
 
     MappedFileStorage(
         opentxs::storage::lmdb::LMDB& lmdb,
         const std::filesystem::path& basePath,
         const std::filesystem::path filenamePrefix,
         int table,
-        std::size_t key) noexcept(false);
+        std::size_t key,
+        int freeTable) noexcept(false);
 
     virtual ~MappedFileStorage();
 
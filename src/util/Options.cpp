@@ -19,6 +19,7 @@
 #include <utility>
 
 #include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
 #include "opentxs/api/session/Notary.hpp"
 #include "opentxs/blockchain/Blockchain.hpp"
 #include "opentxs/util/BlockchainProfile.hpp"
@@ -35,6 +36,7 @@ namespace opentxs
 struct Options::Imp::Parser {
     using Multistring = UnallocatedVector<UnallocatedCString>;
 
+    static constexpr auto blockchain_block_cache_{"blockchain_block_cache"};
     static constexpr auto blockchain_disable_{"disable_blockchain"};
     static constexpr auto blockchain_ipv4_bind_{"blockchain_bind_ipv4"};
     static constexpr auto blockchain_ipv6_bind_{"blockchain_bind_ipv6"};
@@ -68,6 +70,11 @@ struct Options::Imp::Parser {
         static const auto out = [] {
             auto out = po::options_description{"libopentxs options"};
 
+            out.add_options()(
+                blockchain_block_cache_,
+                po::value<std::size_t>(),
+                "Memory budget in bytes for recently used blockchain blocks. "
+                "0 selects a default based on the blockchain profile");
             out.add_options()(
                 blockchain_disable_,
                 po::value<Multistring>()->multitoken()->composing(),
@@ -203,7 +210,8 @@ struct Options::Imp::Parser {
 };
 
 Options::Imp::Imp() noexcept
-    : blockchain_disabled_chains_()
+    : blockchain_block_cache_bytes_(std::nullopt)
+    , blockchain_disabled_chains_()
     , blockchain_ipv4_bind_()
     , blockchain_ipv6_bind_()
     , blockchain_profile_(std::nullopt)
@@ -301,7 +309,9 @@ auto Options::Imp::import_value(
     const auto sValue = UnallocatedCString{value};
 
     try {
-        if (0 == key.compare(Parser::blockchain_disable_)) {
+        if (0 == key.compare(Parser::blockchain_block_cache_)) {
+            blockchain_block_cache_bytes_ = std::stoull(sValue);
+        } else if (0 == key.compare(Parser::blockchain_disable_)) {
             blockchain_disabled_chains_.emplace(convert(value));
         } else if (0 == key.compare(Parser::blockchain_ipv4_bind_)) {
             blockchain_ipv4_bind_.emplace(value);
@@ -406,7 +416,12 @@ auto Options::Imp::parse(int argc, char** argv) noexcept(false) -> void
     }
 
     for (const auto& [name, value] : parser.variables_) {
-        if (name == Parser::blockchain_disable_) {
+        if (name == Parser::blockchain_block_cache_) {
+            try {
+                blockchain_block_cache_bytes_ = value.as<std::size_t>();
+            } catch (...) {
+            }
+        } else if (name == Parser::blockchain_disable_) {
             try {
                 const auto& chains = value.as<Parser::Multistring>();
 
@@ -627,6 +642,10 @@ auto operator+(const Options& lhs, const Options& rhs) noexcept -> Options
     auto& l = *out.imp_;
     const auto& r = *rhs.imp_;
 
+    if (const auto& v = r.blockchain_block_cache_bytes_; v.has_value()) {
+        l.blockchain_block_cache_bytes_ = v.value();
+    }
+
     std::copy(
         r.blockchain_disabled_chains_.begin(),
         r.blockchain_disabled_chains_.end(),
@@ -830,6 +849,11 @@ auto Options::BlockchainBindIpv6() const noexcept -> const Set<CString>&
     return imp_->blockchain_ipv6_bind_;
 }
 
+auto Options::BlockchainBlockCacheBytes() const noexcept -> std::size_t
+{
+    return Imp::get(imp_->blockchain_block_cache_bytes_, 0_uz);
+}
+
 auto Options::BlockchainProfile() const noexcept -> opentxs::BlockchainProfile
 {
     return Imp::get(
@@ -982,6 +1006,14 @@ auto Options::RemoteLogEndpoint() const noexcept -> std::string_view
     return Imp::get(imp_->log_endpoint_);
 }
 
+auto Options::SetBlockchainBlockCacheBytes(std::size_t bytes) noexcept
+    -> Options&
+{
+    imp_->blockchain_block_cache_bytes_ = bytes;
+
+    return *this;
+}
+
 auto Options::SetBlockchainProfile(opentxs::BlockchainProfile value) noexcept
     -> Options&
 {
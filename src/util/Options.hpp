@@ -24,6 +24,7 @@ namespace opentxs
 {
 // NOLINTBEGIN(clang-analyzer-optin.performance.Padding)
 struct Options::Imp final {
+    std::optional<std::size_t> blockchain_block_cache_bytes_;
     Set<blockchain::Type> blockchain_disabled_chains_;
     Set<CString> blockchain_ipv4_bind_;
     Set<CString> blockchain_ipv6_bind_;
@@ -0,0 +1,235 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"          // IWYU pragma: associated
+#include "1_Internal.hpp"        // IWYU pragma: associated
+#include "util/SecureArena.hpp"  // IWYU pragma: associated
+
+extern "C" {
+#include <sodium.h>
+}
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include "internal/util/LogMacros.hpp"
+#include "internal/util/P0330.hpp"
+#include "opentxs/util/Log.hpp"
+
+namespace opentxs
+{
+SecureArena::SecureArena() noexcept
+    : data_()
+{
+    static_assert(min_chunk_ >= sizeof(void*));
+    static_assert((min_chunk_ << (size_classes_ - 1u)) == max_chunk_);
+    static_assert(0u == (max_slab_ % max_chunk_));
+}
+
+auto SecureArena::add_slab(Data& data, const std::size_t index) const
+    noexcept(false) -> void
+{
+    const auto bytes = slab_size(data, index);
+    auto* slab = allocate_pages(bytes);
+
+    if (nullptr == slab) { throw std::bad_alloc(); }
+
+    ::sodium_memzero(slab, bytes);
+    data.slabs_.emplace_back(slab, bytes);
+    data.slab_bytes_.at(index) = bytes;
+    ++data.stats_.slabs_;
+    lock(data, slab, bytes);
+    const auto size = chunk_size(index);
+    auto& head = data.free_.at(index);
+
+    // NOTE push in reverse order so chunks are handed out in address order
+    for (auto offset = (bytes / size) * size; offset > 0u;) {
+        offset -= size;
+        auto* chunk = static_cast<std::byte*>(slab) + offset;
+        std::memcpy(chunk, &head, sizeof(head));
+        head = chunk;
+    }
+}
+
+auto SecureArena::Allocate(const std::size_t bytes) noexcept(false) -> void*
+{
+    if (bytes > max_chunk_) {
+        const auto pages = page_round(bytes);
+        auto* out = allocate_pages(pages);
+
+        if (nullptr == out) { throw std::bad_alloc(); }
+
+        auto handle = data_.lock();
+        auto& data = *handle;
+        data.large_.emplace(out, lock(data, out, pages));
+        ++data.stats_.large_in_use_;
+
+        return out;
+    }
+
+    const auto index = size_class(bytes);
+    auto handle = data_.lock();
+    auto& data = *handle;
+    auto& head = data.free_.at(index);
+
+    if (nullptr == head) { add_slab(data, index); }
+
+    auto* out = head;
+    std::memcpy(&head, out, sizeof(head));
+    ::sodium_memzero(out, sizeof(head));
+    ++data.stats_.chunks_in_use_;
+
+    return out;
+}
+
+auto SecureArena::chunk_size(const std::size_t index) noexcept -> std::size_t
+{
+    return min_chunk_ << index;
+}
+
+auto SecureArena::Get() noexcept -> SecureArena&
+{
+    // NOTE never destroyed since objects with static storage duration may
+    // release secrets after a static arena would have been destroyed
+    static auto* arena = new SecureArena{};
+
+    return *arena;
+}
+
+auto SecureArena::lock(Data& data, void* memory, const std::size_t bytes)
+    const noexcept -> bool
+{
+    auto& stats = data.stats_;
+
+    if (0 == ::sodium_mlock(memory, bytes)) {
+        stats.locked_bytes_ += bytes;
+        data.warned_ = false;
+
+        return true;
+    }
+
+    stats.unlocked_bytes_ += bytes;
+
+    if (false == data.warned_) {
+        data.warned_ = true;
+        const auto limit = memlock_limit();
+        const auto& log = LogError();
+        log(OT_PRETTY_CLASS())("unable to lock ")(bytes)(" bytes after ")(
+            stats.locked_bytes_)(" bytes were locked");
+
+        if (limit.has_value()) {
+            log(". The locked memory limit (RLIMIT_MEMLOCK) of ")(
+                limit.value())(" bytes is exhausted");
+        }
+
+        log(". Passwords and/or secret keys may be swapped to disk").Flush();
+    }
+
+    return false;
+}
+
+auto SecureArena::page_round(const std::size_t bytes) noexcept -> std::size_t
+{
+    const auto page = page_size();
+
+    return ((bytes + page - 1u) / page) * page;
+}
+
+auto SecureArena::Release(void* chunk, const std::size_t bytes) noexcept
+    -> void
+{
+    if (nullptr == chunk) { return; }
+
+    if (bytes > max_chunk_) {
+        const auto pages = page_round(bytes);
+        auto locked = false;
+
+        {
+            auto handle = data_.lock();
+            auto& data = *handle;
+            auto i = data.large_.find(chunk);
+
+            OT_ASSERT(data.large_.end() != i);
+
+            locked = i->second;
+            data.large_.erase(i);
+            auto& stats = data.stats_;
+            --stats.large_in_use_;
+
+            if (locked) {
+                stats.locked_bytes_ -= pages;
+            } else {
+                stats.unlocked_bytes_ -= pages;
+            }
+        }
+
+        if (locked) {
+            // NOTE sodium_munlock zeroes the memory before unlocking it
+            ::sodium_munlock(chunk, pages);
+        } else {
+            ::sodium_memzero(chunk, pages);
+        }
+
+        free_pages(chunk, pages);
+
+        return;
+    }
+
+    const auto index = size_class(bytes);
+    ::sodium_memzero(chunk, chunk_size(index));
+    auto handle = data_.lock();
+    auto& data = *handle;
+    auto& head = data.free_.at(index);
+    std::memcpy(chunk, &head, sizeof(head));
+    head = chunk;
+    --data.stats_.chunks_in_use_;
+}
+
+auto SecureArena::size_class(const std::size_t bytes) noexcept -> std::size_t
+{
+    auto index = 0_uz;
+
+    while (chunk_size(index) < bytes) { ++index; }
+
+    return index;
+}
+
+auto SecureArena::slab_size(const Data& data, const std::size_t index) noexcept
+    -> std::size_t
+{
+    const auto page = page_size();
+    const auto minimum = page_round(chunk_size(index));
+    const auto maximum = [&] {
+        auto out = max_slab_;
+
+        if (const auto limit = memlock_limit(); limit.has_value()) {
+            out = std::min(out, limit.value() / size_classes_);
+        }
+
+        return std::max(minimum, (out / page) * page);
+    }();
+    const auto previous = data.slab_bytes_.at(index);
+
+    if (0u == previous) { return minimum; }
+
+    return std::clamp(2u * previous, minimum, maximum);
+}
+
+auto SecureArena::Statistics() const noexcept -> Stats
+{
+    return data_.lock()->stats_;
+}
+
+SecureArena::~SecureArena()
+{
+    auto handle = data_.lock();
+
+    for (const auto& [slab, bytes] : handle->slabs_) {
+        ::sodium_munlock(slab, bytes);
+        free_pages(slab, bytes);
+    }
+}
+}  // namespace opentxs
@@ -0,0 +1,101 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cs_plain_guarded.h>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+#include "opentxs/util/Container.hpp"
+
+namespace opentxs
+{
+// NOTE process wide pool of locked memory which backs SecureAllocator.
+//
+// Requests of up to max_chunk_ bytes are rounded up to a power of two size
+// class and served from slabs which are locked once, when the slab is created.
+// Released chunks are zeroed and kept for reuse, and slabs are never returned
+// to the system. The first slab of each size class is one page and every
+// further slab doubles in size up to max_slab_, but never beyond an equal
+// share of the locked memory limit. Larger requests are rounded up to whole
+// pages and locked and unlocked individually. Every allocation is page aligned
+// so unlocking one never unlocks a page which belongs to another.
+//
+// If the locked memory limit (RLIMIT_MEMLOCK) is exhausted the memory is still
+// handed out, unlocked, and the condition is logged.
+class SecureArena
+{
+public:
+    struct Stats {
+        std::size_t slabs_{};
+        std::size_t locked_bytes_{};
+        std::size_t unlocked_bytes_{};
+        std::size_t chunks_in_use_{};
+        std::size_t large_in_use_{};
+    };
+
+    static constexpr auto min_chunk_ = std::size_t{16};
+    static constexpr auto max_chunk_ = std::size_t{4096};
+    static constexpr auto max_slab_ = std::size_t{65536};
+
+    static auto Get() noexcept -> SecureArena&;
+
+    auto Statistics() const noexcept -> Stats;
+
+    // Throws std::bad_alloc if memory can not be allocated
+    auto Allocate(const std::size_t bytes) noexcept(false) -> void*;
+    // NOTE bytes must match the value passed to the Allocate call which
+    // returned the chunk
+    auto Release(void* chunk, const std::size_t bytes) noexcept -> void;
+
+    SecureArena(const SecureArena&) = delete;
+    SecureArena(SecureArena&&) = delete;
+    auto operator=(const SecureArena&) -> SecureArena& = delete;
+    auto operator=(SecureArena&&) -> SecureArena& = delete;
+
+private:
+    static constexpr auto size_classes_ = std::size_t{9};
+
+    struct Data {
+        // NOTE singly linked lists threaded through the free chunks
+        std::array<void*, size_classes_> free_{};
+        std::array<std::size_t, size_classes_> slab_bytes_{};
+        UnallocatedVector<std::pair<void*, std::size_t>> slabs_{};
+        UnallocatedMap<void*, bool> large_{};
+        Stats stats_{};
+        bool warned_{};
+    };
+
+    mutable libguarded::plain_guarded<Data> data_;
+
+    // NOTE implemented in the platform specific source files. bytes must be
+    // a multiple of page_size(). Returns nullptr on failure.
+    static auto allocate_pages(const std::size_t bytes) noexcept -> void*;
+    static auto free_pages(void* memory, const std::size_t bytes) noexcept
+        -> void;
+    // NOTE implemented in the platform specific source files. Returns
+    // std::nullopt if the limit is unknown or unlimited.
+    static auto memlock_limit() noexcept -> std::optional<std::size_t>;
+    // NOTE implemented in the platform specific source files
+    static auto page_size() noexcept -> std::size_t;
+    static auto page_round(const std::size_t bytes) noexcept -> std::size_t;
+    static auto size_class(const std::size_t bytes) noexcept -> std::size_t;
+    static auto chunk_size(const std::size_t index) noexcept -> std::size_t;
+    static auto slab_size(const Data& data, const std::size_t index) noexcept
+        -> std::size_t;
+
+    auto add_slab(Data& data, const std::size_t index) const noexcept(false)
+        -> void;
+    auto lock(Data& data, void* memory, const std::size_t bytes) const noexcept
+        -> bool;
+
+    SecureArena() noexcept;
+
+    ~SecureArena();
+};
+}  // namespace opentxs
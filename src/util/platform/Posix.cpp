@@ -9,6 +9,7 @@
 #include "api/context/Context.hpp"    // IWYU pragma: associated
 #include "core/String.hpp"            // IWYU pragma: associated
 #include "internal/util/Signals.hpp"  // IWYU pragma: associated
+#include "util/SecureArena.hpp"       // IWYU pragma: associated
 
 extern "C" {
 #include <pwd.h>
@@ -21,6 +22,7 @@ extern "C" {
 
 #include <cerrno>
 #include <csignal>
+#include <cstdlib>
 #include <cstring>
 #include <utility>
 
@@ -30,6 +32,37 @@ extern "C" {
 
 namespace opentxs
 {
+auto SecureArena::allocate_pages(const std::size_t bytes) noexcept -> void*
+{
+    auto* out = static_cast<void*>(nullptr);
+
+    if (0 != ::posix_memalign(&out, page_size(), bytes)) { return nullptr; }
+
+    return out;
+}
+
+auto SecureArena::free_pages(void* memory, const std::size_t) noexcept -> void
+{
+    std::free(memory);
+}
+
+auto SecureArena::memlock_limit() noexcept -> std::optional<std::size_t>
+{
+    auto limit = ::rlimit{};
+
+    if (0 != ::getrlimit(RLIMIT_MEMLOCK, &limit)) { return std::nullopt; }
+
+    if (RLIM_INFINITY == limit.rlim_cur) { return std::nullopt; }
+
+    return static_cast<std::size_t>(limit.rlim_cur);
+}
+
+auto SecureArena::page_size() noexcept -> std::size_t
+{
+    static const auto size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+
+    return size;
+}
 
 auto Signals::Block() -> void
 {
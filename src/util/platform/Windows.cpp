@@ -9,6 +9,7 @@
 #include "api/context/Context.hpp"    // IWYU pragma: associated
 #include "core/String.hpp"            // IWYU pragma: associated
 #include "internal/util/Signals.hpp"  // IWYU pragma: associated
+#include "util/SecureArena.hpp"       // IWYU pragma: associated
 #include "util/Thread.hpp"            // IWYU pragma: associated
 
 #include <Windows.h>  // IWYU pragma: associated
@@ -53,6 +54,34 @@ auto SetThisThreadsPriority(ThreadPriority priority) noexcept -> void
     }
 }
 
+auto SecureArena::allocate_pages(const std::size_t bytes) noexcept -> void*
+{
+    return ::VirtualAlloc(
+        nullptr, bytes, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+}
+
+auto SecureArena::free_pages(void* memory, const std::size_t) noexcept -> void
+{
+    ::VirtualFree(memory, 0, MEM_RELEASE);
+}
+
+auto SecureArena::memlock_limit() noexcept -> std::optional<std::size_t>
+{
+    return std::nullopt;
+}
+
+auto SecureArena::page_size() noexcept -> std::size_t
+{
+    static const auto size = [] {
+        auto info = SYSTEM_INFO{};
+        ::GetSystemInfo(&info);
+
+        return static_cast<std::size_t>(info.dwPageSize);
+    }();
+
+    return size;
+}
+
 auto Signals::Block() -> void
 {
     std::cout << "Signal handling is not supported on Windows\n";
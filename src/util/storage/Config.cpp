@@ -330,6 +330,54 @@ Config::Config(
 
         return output;
     }())
+    , lmdb_no_sync_([&] {
+        auto output{false};
+        auto notUsed{false};
+        config.CheckSet_bool(
+            String::Factory(STORAGE_CONFIG_KEY),
+            String::Factory("lmdb_nosync"),
+            false,
+            output,
+            notUsed);
+
+        return output;
+    }())
+    , lmdb_no_meta_sync_([&] {
+        auto output{false};
+        auto notUsed{false};
+        config.CheckSet_bool(
+            String::Factory(STORAGE_CONFIG_KEY),
+            String::Factory("lmdb_nometasync"),
+            false,
+            output,
+            notUsed);
+
+        return output;
+    }())
+    , lmdb_write_map_([&] {
+        auto output{false};
+        auto notUsed{false};
+        config.CheckSet_bool(
+            String::Factory(STORAGE_CONFIG_KEY),
+            String::Factory("lmdb_writemap"),
+            false,
+            output,
+            notUsed);
+
+        return output;
+    }())
+    , lmdb_no_read_ahead_([&] {
+        auto output{false};
+        auto notUsed{false};
+        config.CheckSet_bool(
+            String::Factory(STORAGE_CONFIG_KEY),
+            String::Factory("lmdb_nordahead"),
+            false,
+            output,
+            notUsed);
+
+        return output;
+    }())
 {
     OT_ASSERT(false == dataFolder.empty());
 
@@ -71,6 +71,10 @@ public:
     UnallocatedCString lmdb_secondary_bucket_;
     UnallocatedCString lmdb_control_table_;
     UnallocatedCString lmdb_root_key_;
+    bool lmdb_no_sync_;
+    bool lmdb_no_meta_sync_;
+    bool lmdb_write_map_;
+    bool lmdb_no_read_ahead_;
 
     Config(
         const api::Legacy& legacy,
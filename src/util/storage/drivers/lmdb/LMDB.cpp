@@ -53,7 +53,13 @@ LMDB::LMDB(
               {Table::Control, 0},
               {Table::A, 0},
               {Table::B, 0},
-          })
+          },
+          lmdb::EnvironmentOptions{
+              config.lmdb_no_sync_,
+              config.lmdb_no_meta_sync_,
+              config.lmdb_write_map_,
+              config.lmdb_no_read_ahead_}
+              .Flags())
 {
     LogVerbose()(OT_PRETTY_CLASS())("Using ")(config_.path_).Flush();
     Init_LMDB();
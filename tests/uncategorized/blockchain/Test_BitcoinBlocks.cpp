@@ -13,10 +13,13 @@
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/bitcoin/Bitcoin.hpp"
+#include "internal/blockchain/bitcoin/block/Block.hpp"
+#include "internal/blockchain/bitcoin/block/Transaction.hpp"
 #include "internal/blockchain/block/Block.hpp"
 #include "internal/util/P0330.hpp"
 #include "ottest/data/blockchain/Bip158.hpp"
@@ -467,6 +470,87 @@ TEST_F(Test_BitcoinBlock, serialization)
     }
 }
 
+TEST_F(Test_BitcoinBlock, compact_block_reconstruction)
+{
+    namespace bb = ot::blockchain::bitcoin;
+    using namespace opentxs::literals;
+    constexpr auto chain = ot::blockchain::Type::Bitcoin_testnet3;
+    auto witnessBlocks = 0_uz;
+
+    for (const auto& vector : GetBip158Vectors()) {
+        const auto raw = vector.Block(api_);
+        const auto pBlock = api_.Factory().BitcoinBlock(chain, raw.Bytes());
+
+        ASSERT_TRUE(pBlock);
+
+        const auto& block = *pBlock;
+
+        EXPECT_TRUE(bb::block::internal::CheckWitnessCommitment(api_, block));
+
+        // NOTE reassemble the block the same way a peer does after filling a
+        // cmpctblock from the mempool, but substitute a transaction whose
+        // witness differs from the one committed to by the coinbase
+        auto tampered = std::optional<std::size_t>{};
+        auto txs = ot::UnallocatedVector<ot::Space>{};
+
+        for (auto i = 0_uz; i < block.size(); ++i) {
+            const auto& tx = block.at(i);
+
+            ASSERT_TRUE(tx);
+
+            auto& bytes = txs.emplace_back();
+
+            ASSERT_TRUE(tx->Internal().Serialize(ot::writer(bytes)));
+
+            if ((0_uz == i) || tampered.has_value()) { continue; }
+
+            for (const auto& input : tx->Inputs()) {
+                const auto& witness = input.Witness();
+
+                if (witness.empty() || witness.back().empty()) { continue; }
+
+                const auto& item = witness.back();
+                auto it = std::search(
+                    bytes.begin(), bytes.end(), item.begin(), item.end());
+
+                ASSERT_NE(it, bytes.end());
+
+                std::advance(it, item.size() / 2_uz);
+                *it ^= std::byte{0x01};
+                tampered = i;
+
+                break;
+            }
+        }
+
+        const auto reconstruct = [&] {
+            const auto count = bb::CompactSize{txs.size()}.Encode();
+            const auto header = raw.Bytes().substr(0_uz, 80_uz);
+            const auto* h = reinterpret_cast<const std::byte*>(header.data());
+            auto out = ot::Space{h, std::next(h, header.size())};
+            out.insert(out.end(), count.begin(), count.end());
+
+            for (const auto& tx : txs) {
+                out.insert(out.end(), tx.begin(), tx.end());
+            }
+
+            return api_.Factory().BitcoinBlock(chain, ot::reader(out));
+        }();
+
+        if (false == tampered.has_value()) { continue; }
+
+        ++witnessBlocks;
+
+        // NOTE the txid merkle root does not cover witness data
+        ASSERT_TRUE(reconstruct);
+        EXPECT_EQ(reconstruct->ID(), block.ID());
+        EXPECT_FALSE(
+            bb::block::internal::CheckWitnessCommitment(api_, *reconstruct));
+    }
+
+    EXPECT_LT(0_uz, witnessBlocks);
+}
+
 TEST_F(Test_BitcoinBlock, bch_filter_1307544)
 {
     const auto& filter = GetBchCfilter1307544();
@@ -0,0 +1,193 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <cstddef>
+#include <future>
+#include <memory>
+
+#include "blockchain/node/blockoracle/MemDB.hpp"
+#include "internal/blockchain/Params.hpp"
+#include "internal/blockchain/block/Block.hpp"
+#include "internal/blockchain/node/Config.hpp"
+#include "internal/util/P0330.hpp"
+
+namespace ot = opentxs;
+namespace bb = ot::blockchain::block;
+namespace bc = ot::blockchain::node;
+
+namespace ottest
+{
+using namespace opentxs::literals;
+
+class Test_BlockCache : public ::testing::Test
+{
+public:
+    using Block = std::shared_ptr<const ot::blockchain::bitcoin::block::Block>;
+    using MemDB = bc::blockoracle::MemDB;
+
+    const ot::api::session::Client& api_;
+    const Block block_;
+    const std::size_t size_;
+    bc::internal::BlockCacheMetrics metrics_;
+
+    // NOTE the cache does not verify that the id matches the block so every
+    // entry can share the same block, which keeps the size of each entry equal
+    static auto make_id(const unsigned char n) noexcept -> bb::Hash
+    {
+        auto bytes = ot::UnallocatedCString(32_uz, '\0');
+        bytes.front() = static_cast<char>(n);
+
+        return bb::Hash{bytes};
+    }
+
+    auto cached(MemDB& cache, const unsigned char n) noexcept -> bool
+    {
+        return cache.find(make_id(n).Bytes()).valid();
+    }
+    auto push(MemDB& cache, const unsigned char n) noexcept -> void
+    {
+        auto promise = std::promise<Block>{};
+        promise.set_value(block_);
+        cache.push(make_id(n), promise.get_future().share());
+    }
+
+    Test_BlockCache()
+        : api_(ot::Context().StartClientSession(0))
+        , block_([&] {
+            const auto chain = ot::blockchain::Type::Bitcoin;
+            const auto& hex =
+                ot::blockchain::params::Chains().at(chain).genesis_block_hex_;
+            const auto bytes = api_.Factory().DataFromHex(hex);
+
+            return api_.Factory().BitcoinBlock(chain, bytes.Bytes());
+        }())
+        , size_(block_ ? block_->Internal().CalculateSize() : 0_uz)
+        , metrics_()
+    {
+    }
+};
+
+TEST_F(Test_BlockCache, evicts_least_recently_used)
+{
+    ASSERT_TRUE(block_);
+
+    auto cache = MemDB{3_uz * size_, metrics_, {}};
+    push(cache, 1u);
+    push(cache, 2u);
+    push(cache, 3u);
+
+    EXPECT_EQ(metrics_.blocks_.load(), 3_uz);
+    EXPECT_EQ(metrics_.bytes_.load(), 3_uz * size_);
+    EXPECT_EQ(metrics_.evictions_.load(), 0_uz);
+
+    // NOTE a hit makes the oldest block the most recently used one
+    EXPECT_TRUE(cached(cache, 1u));
+
+    push(cache, 4u);
+
+    EXPECT_EQ(metrics_.evictions_.load(), 1_uz);
+    EXPECT_EQ(metrics_.blocks_.load(), 3_uz);
+    EXPECT_EQ(metrics_.bytes_.load(), 3_uz * size_);
+    EXPECT_FALSE(cached(cache, 2u));
+    EXPECT_TRUE(cached(cache, 1u));
+    EXPECT_TRUE(cached(cache, 3u));
+    EXPECT_TRUE(cached(cache, 4u));
+}
+
+TEST_F(Test_BlockCache, rejects_oversized_blocks)
+{
+    ASSERT_TRUE(block_);
+    ASSERT_LT(0_uz, size_);
+
+    auto cache = MemDB{size_ - 1_uz, metrics_, {}};
+    push(cache, 1u);
+
+    EXPECT_FALSE(cached(cache, 1u));
+    EXPECT_EQ(metrics_.blocks_.load(), 0_uz);
+    EXPECT_EQ(metrics_.bytes_.load(), 0_uz);
+    EXPECT_EQ(metrics_.evictions_.load(), 0_uz);
+
+    // NOTE a pinned block is needed by the caller so it is kept regardless
+    cache.pin(make_id(2u));
+    push(cache, 2u);
+
+    EXPECT_TRUE(cached(cache, 2u));
+    EXPECT_EQ(metrics_.blocks_.load(), 1_uz);
+}
+
+TEST_F(Test_BlockCache, pinned_blocks_are_not_evicted)
+{
+    ASSERT_TRUE(block_);
+
+    auto cache = MemDB{2_uz * size_, metrics_, {}};
+    cache.pin(make_id(1u));
+    cache.pin(make_id(1u));
+    push(cache, 1u);
+    push(cache, 2u);
+    push(cache, 3u);
+
+    // NOTE the pinned block counts toward the budget so only one unpinned
+    // block fits beside it
+    EXPECT_TRUE(cached(cache, 1u));
+    EXPECT_FALSE(cached(cache, 2u));
+    EXPECT_TRUE(cached(cache, 3u));
+    EXPECT_EQ(metrics_.bytes_.load(), 2_uz * size_);
+
+    push(cache, 4u);
+    push(cache, 5u);
+
+    EXPECT_TRUE(cached(cache, 1u));
+    EXPECT_TRUE(cached(cache, 5u));
+
+    // NOTE pins are reference counted
+    cache.unpin(make_id(1u));
+    push(cache, 6u);
+
+    EXPECT_TRUE(cached(cache, 1u));
+    EXPECT_TRUE(cached(cache, 6u));
+
+    cache.unpin(make_id(1u));
+
+    // NOTE an unpinned block rejoins the eviction order as the most recently
+    // used one
+    EXPECT_TRUE(cached(cache, 6u));
+
+    push(cache, 7u);
+
+    EXPECT_FALSE(cached(cache, 1u));
+    EXPECT_TRUE(cached(cache, 7u));
+}
+
+TEST_F(Test_BlockCache, counters)
+{
+    ASSERT_TRUE(block_);
+
+    auto cache = MemDB{size_, metrics_, {}};
+
+    EXPECT_FALSE(cached(cache, 1u));
+    EXPECT_EQ(metrics_.misses_.load(), 1_uz);
+    EXPECT_EQ(metrics_.hits_.load(), 0_uz);
+
+    push(cache, 1u);
+
+    EXPECT_TRUE(cached(cache, 1u));
+    EXPECT_TRUE(cached(cache, 1u));
+    EXPECT_EQ(metrics_.hits_.load(), 2_uz);
+    EXPECT_EQ(metrics_.misses_.load(), 1_uz);
+
+    push(cache, 2u);
+
+    EXPECT_EQ(metrics_.evictions_.load(), 1_uz);
+    EXPECT_FALSE(cached(cache, 1u));
+    EXPECT_EQ(metrics_.misses_.load(), 2_uz);
+
+    cache.clear();
+
+    EXPECT_EQ(metrics_.blocks_.load(), 0_uz);
+    EXPECT_EQ(metrics_.bytes_.load(), 0_uz);
+}
+}  // namespace ottest
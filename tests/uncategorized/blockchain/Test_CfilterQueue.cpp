@@ -0,0 +1,204 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+#include "blockchain/node/filteroracle/CfilterQueue.hpp"
+#include "internal/blockchain/Blockchain.hpp"
+#include "internal/blockchain/bitcoin/cfilter/GCS.hpp"
+#include "internal/util/P0330.hpp"
+
+namespace ot = opentxs;
+namespace bb = ot::blockchain::block;
+
+namespace ottest
+{
+using namespace opentxs::literals;
+
+class Test_CfilterQueue : public ::testing::Test
+{
+public:
+    using Queue = ot::blockchain::node::filteroracle::CfilterQueue;
+
+    static constexpr auto count_ = bb::Height{6};
+
+    const ot::api::session::Client& api_;
+    const ot::blockchain::cfilter::Header genesis_;
+    Queue queue_;
+    std::size_t generation_;
+
+    static auto make_position(const bb::Height height) noexcept
+        -> bb::Position
+    {
+        auto bytes = ot::UnallocatedCString(32_uz, '\0');
+        bytes.front() = static_cast<char>(height);
+
+        return {height, bb::Hash{bytes}};
+    }
+
+    auto add(const bb::Height height) noexcept -> bool
+    {
+        return add(generation_, height);
+    }
+    auto add(const std::size_t generation, const bb::Height height) noexcept
+        -> bool
+    {
+        return queue_.Add(generation, make_position(height), make_gcs(height));
+    }
+    auto make_gcs(const bb::Height height) const noexcept -> ot::blockchain::GCS
+    {
+        const auto params = ot::blockchain::internal::GetFilterParams(
+            ot::blockchain::cfilter::Type::Basic_BIP158);
+        const auto position = make_position(height);
+        const auto element = ot::UnallocatedCString(8_uz, 'a' + height);
+        auto elements =
+            ot::Vector<ot::ByteArray>{ot::ByteArray{element.data(), 8_uz}};
+
+        return ot::factory::GCS(
+            api_,
+            params.first,
+            params.second,
+            ot::blockchain::internal::BlockHashToFilterKey(
+                position.hash_.Bytes()),
+            elements,
+            {});
+    }
+    auto next(
+        const bb::Height tip,
+        const ot::blockchain::cfilter::Header& header,
+        const std::size_t minimum) noexcept -> std::optional<Queue::Batch>
+    {
+        return queue_.Next(make_position(tip), header, count_, minimum, {});
+    }
+    // NOTE checks that the batch holds every height after tip up to and
+    // including last, in order, with each cfheader committing to the one
+    // before it
+    auto verify(
+        const Queue::Batch& batch,
+        const bb::Height tip,
+        const ot::blockchain::cfilter::Header& header,
+        const bb::Height last) const noexcept -> void
+    {
+        const auto expected = static_cast<std::size_t>(last - tip);
+
+        ASSERT_EQ(batch.headers_.size(), expected);
+        ASSERT_EQ(batch.filters_.size(), expected);
+        EXPECT_EQ(batch.tip_, make_position(last));
+
+        auto previous = header;
+        auto current = header;
+
+        for (auto i = 0_uz; i < expected; ++i) {
+            const auto height = tip + 1 + static_cast<bb::Height>(i);
+            const auto position = make_position(height);
+            const auto gcs = make_gcs(height);
+            const auto cfheader = gcs.Header(current);
+            const auto& [hash, storedHeader, filterHash] = batch.headers_.at(i);
+
+            EXPECT_EQ(hash, position.hash_);
+            EXPECT_EQ(storedHeader, cfheader);
+            EXPECT_EQ(filterHash, gcs.Hash());
+            EXPECT_EQ(batch.filters_.at(i).first, position.hash_);
+            previous = current;
+            current = cfheader;
+        }
+
+        EXPECT_EQ(batch.previous_, previous);
+        EXPECT_EQ(batch.current_, current);
+    }
+
+    Test_CfilterQueue()
+        : api_(ot::Context().StartClientSession(0))
+        , genesis_()
+        , queue_()
+        , generation_(queue_.Reset())
+    {
+    }
+};
+
+TEST_F(Test_CfilterQueue, out_of_order_results_commit_in_height_order)
+{
+    static constexpr auto batch = 250_uz;
+
+    EXPECT_TRUE(add(3));
+    EXPECT_TRUE(add(6));
+    EXPECT_TRUE(add(2));
+    EXPECT_FALSE(next(0, genesis_, batch).has_value());
+
+    EXPECT_TRUE(add(1));
+    EXPECT_TRUE(add(5));
+
+    // NOTE three contiguous results are ready but they are held back until
+    // either a full batch is available or the pipeline has drained
+    EXPECT_FALSE(next(0, genesis_, batch).has_value());
+
+    EXPECT_TRUE(add(4));
+
+    const auto result = next(0, genesis_, batch);
+
+    ASSERT_TRUE(result.has_value());
+
+    verify(*result, 0, genesis_, count_);
+    EXPECT_FALSE(next(count_, result->current_, batch).has_value());
+}
+
+TEST_F(Test_CfilterQueue, partial_batches_chain_from_previous_commit)
+{
+    static constexpr auto batch = 2_uz;
+
+    EXPECT_TRUE(add(2));
+    EXPECT_FALSE(next(0, genesis_, batch).has_value());
+    EXPECT_TRUE(add(4));
+    EXPECT_TRUE(add(1));
+
+    const auto first = next(0, genesis_, batch);
+
+    ASSERT_TRUE(first.has_value());
+
+    verify(*first, 0, genesis_, 2);
+    EXPECT_FALSE(next(2, first->current_, batch).has_value());
+    EXPECT_TRUE(add(3));
+
+    const auto second = next(2, first->current_, batch);
+
+    ASSERT_TRUE(second.has_value());
+
+    verify(*second, 2, first->current_, 4);
+}
+
+TEST_F(Test_CfilterQueue, reset_discards_in_flight_results)
+{
+    static constexpr auto batch = 1_uz;
+    const auto old = generation_;
+
+    EXPECT_TRUE(add(2));
+    EXPECT_TRUE(add(3));
+
+    // NOTE a reorg restarts the pipeline under a new generation
+    generation_ = queue_.Reset();
+
+    EXPECT_NE(generation_, old);
+
+    // NOTE jobs which were posted before the reorg finish afterwards
+    EXPECT_FALSE(add(old, 1));
+    EXPECT_FALSE(next(0, genesis_, batch).has_value());
+
+    EXPECT_TRUE(add(1));
+
+    const auto result = next(0, genesis_, batch);
+
+    ASSERT_TRUE(result.has_value());
+
+    // NOTE results stored under the old generation before the reorg were
+    // cleared so heights 2 and 3 must be calculated again
+    verify(*result, 0, genesis_, 1);
+    EXPECT_FALSE(next(1, result->current_, batch).has_value());
+}
+}  // namespace ottest
@@ -343,6 +343,70 @@ TEST_F(Test_Filters, golomb_coding)
     }
 }
 
+TEST_F(Test_Filters, golomb_decode_paths)
+{
+    const auto P = params_.first;
+
+    for (const auto& [height, vector] : gcs_) {
+        const auto filter = api_.Factory().DataFromHex(vector.filter_);
+        const auto [N, bytes] =
+            ot::blockchain::internal::DecodeSerializedCfilter(filter.Bytes());
+        const auto encoded = ot::space(bytes, {});
+        const auto scalar = ot::gcs::GolombDecodeScalar(N, P, encoded, {});
+        const auto fast = ot::gcs::GolombDecode(N, P, encoded, {});
+
+        EXPECT_EQ(scalar.size(), N);
+        EXPECT_EQ(scalar, fast);
+
+        auto targets = ot::Vector<std::uint64_t>{};
+
+        for (auto i = 0_uz; i < scalar.size(); i += 2u) {
+            targets.emplace_back(scalar.at(i));
+            targets.emplace_back(scalar.at(i) + 1u);
+        }
+
+        std::sort(targets.begin(), targets.end());
+        targets.erase(
+            std::unique(targets.begin(), targets.end()), targets.end());
+        auto expected = ot::Vector<std::uint64_t>{};
+        std::set_intersection(
+            targets.begin(),
+            targets.end(),
+            scalar.begin(),
+            scalar.end(),
+            std::back_inserter(expected));
+        const auto matched =
+            ot::gcs::GolombMatch(N, P, ot::reader(encoded), targets, {});
+
+        EXPECT_EQ(expected, matched);
+    }
+}
+
+TEST_F(Test_Filters, siphash_batch)
+{
+    const auto key = ot::UnallocatedCString{"0123456789abcdef"};
+    const auto data = [] {
+        auto out = ot::UnallocatedCString{};
+
+        for (auto i = 0; i < 128; ++i) { out.push_back(static_cast<char>(i)); }
+
+        return out;
+    }();
+    auto targets = ot::blockchain::GCS::Targets{};
+
+    for (auto i = 0_uz; i < 66u; ++i) {
+        targets.emplace_back(data.data() + (i % 7u), i);
+    }
+
+    const auto batch = ot::gcs::Siphash(key, targets, {});
+
+    ASSERT_EQ(batch.size(), targets.size());
+
+    for (auto i = 0_uz; i < targets.size(); ++i) {
+        EXPECT_EQ(batch.at(i), ot::gcs::Siphash(api_, key, targets.at(i)));
+    }
+}
+
 TEST_F(Test_Filters, gcs)
 {
     const auto s1 = ot::UnallocatedCString{"blah"};
@@ -389,6 +453,45 @@ TEST_F(Test_Filters, gcs)
     }
 }
 
+TEST_F(Test_Filters, serialized_cfilter)
+{
+    const auto type = ot::blockchain::cfilter::Type::Basic_BIP158;
+
+    for (const auto& [height, vector] : gcs_) {
+        const auto block = api_.Factory().DataFromHex(vector.block_hash_);
+        const auto filter = api_.Factory().DataFromHex(vector.filter_);
+        const auto gcs = ot::factory::GCS(
+            api_,
+            type,
+            ot::blockchain::internal::BlockHashToFilterKey(block.Bytes()),
+            filter.Bytes(),
+            {});
+
+        ASSERT_TRUE(gcs.IsValid());
+
+        auto record = ot::Space{};
+        record.resize(gcs.Internal().SerializedCfilterSize());
+
+        ASSERT_TRUE(gcs.Internal().SerializeCfilter(
+            ot::WritableView{record.data(), record.size()}));
+        EXPECT_TRUE(ot::blockchain::internal::IsSerializedCfilter(
+            ot::reader(record)));
+
+        for (const auto view : {true, false}) {
+            const auto loaded = ot::factory::GCSFromStorage(
+                api_, ot::reader(record), view, {});
+
+            ASSERT_TRUE(loaded.IsValid());
+            EXPECT_EQ(gcs.ElementCount(), loaded.ElementCount());
+            EXPECT_EQ(gcs.Hash().asHex(), loaded.Hash().asHex());
+
+            const auto copy = ot::blockchain::GCS{loaded};
+
+            EXPECT_EQ(gcs.Hash().asHex(), copy.Hash().asHex());
+        }
+    }
+}
+
 TEST_F(Test_Filters, bip158_case_0) { EXPECT_TRUE(TestGCSBlock(0)); }
 
 TEST_F(Test_Filters, bip158_case_49291) { EXPECT_TRUE(TestGCSBlock(49291)); }
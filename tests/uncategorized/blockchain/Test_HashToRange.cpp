@@ -0,0 +1,143 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+
+#include "internal/blockchain/Blockchain.hpp"
+#include "internal/blockchain/bitcoin/cfilter/GCS.hpp"
+#include "internal/util/P0330.hpp"
+
+namespace bmp = boost::multiprecision;
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace opentxs::literals;
+
+class Test_HashToRange : public ::testing::Test
+{
+public:
+    static constexpr auto sample_size_ = 65536_uz;
+    static constexpr auto benchmark_rounds_ = 16_uz;
+
+    const ot::gcs::Range range_;
+    const ot::gcs::Hashes hashes_;
+
+    // NOTE this is the implementation HashToRange used before native 128 bit
+    // arithmetic
+    static auto reference(const ot::gcs::Range range, const ot::gcs::Hash hash)
+        -> ot::gcs::Element
+    {
+        return ((bmp::uint128_t{hash} * bmp::uint128_t{range}) >> 64u)
+            .convert_to<ot::gcs::Element>();
+    }
+
+    Test_HashToRange()
+        : range_([] {
+            const auto params = ot::blockchain::internal::GetFilterParams(
+                ot::blockchain::cfilter::Type::Basic_BIP158);
+
+            return ot::gcs::Range{1000u} * ot::gcs::Range{params.second};
+        }())
+        , hashes_([] {
+            auto out = ot::gcs::Hashes{};
+            out.reserve(sample_size_);
+            auto rng = std::mt19937_64{158u};
+            constexpr auto max = std::numeric_limits<ot::gcs::Hash>::max();
+            out.emplace_back(0u);
+            out.emplace_back(1u);
+            out.emplace_back(max);
+            out.emplace_back(max - 1u);
+
+            while (out.size() < sample_size_) { out.emplace_back(rng()); }
+
+            return out;
+        }())
+    {
+    }
+};
+
+TEST_F(Test_HashToRange, bip158_compatibility)
+{
+    constexpr auto max = std::numeric_limits<ot::gcs::Range>::max();
+
+    for (const auto range :
+         {ot::gcs::Range{0u}, ot::gcs::Range{1u}, range_, max}) {
+        auto batch = ot::gcs::Elements{};
+        batch.resize(hashes_.size());
+        ot::gcs::HashToRange(
+            range, hashes_.data(), hashes_.size(), batch.data());
+
+        for (auto i = 0_uz; i < hashes_.size(); ++i) {
+            const auto& hash = hashes_.at(i);
+            const auto expected = reference(range, hash);
+
+            EXPECT_EQ(ot::gcs::HashToRange(range, hash), expected);
+            EXPECT_EQ(batch.at(i), expected);
+        }
+    }
+}
+
+// NOTE run with --gtest_also_run_disabled_tests to compare the native
+// implementation against the multiprecision version it replaced
+TEST_F(Test_HashToRange, DISABLED_benchmark)
+{
+    using Clock = std::chrono::steady_clock;
+    using Nanoseconds = std::chrono::nanoseconds;
+    const auto count = hashes_.size() * benchmark_rounds_;
+    auto expected = ot::gcs::Elements{};
+    auto single = ot::gcs::Elements{};
+    auto batch = ot::gcs::Elements{};
+    expected.reserve(count);
+    single.reserve(count);
+    batch.resize(count);
+    const auto start = Clock::now();
+
+    for (auto n = 0_uz; n < benchmark_rounds_; ++n) {
+        for (const auto& hash : hashes_) {
+            expected.emplace_back(reference(range_, hash));
+        }
+    }
+
+    const auto haveReference = Clock::now();
+
+    for (auto n = 0_uz; n < benchmark_rounds_; ++n) {
+        for (const auto& hash : hashes_) {
+            single.emplace_back(ot::gcs::HashToRange(range_, hash));
+        }
+    }
+
+    const auto haveSingle = Clock::now();
+
+    for (auto n = 0_uz; n < benchmark_rounds_; ++n) {
+        ot::gcs::HashToRange(
+            range_,
+            hashes_.data(),
+            hashes_.size(),
+            batch.data() + (n * hashes_.size()));
+    }
+
+    const auto haveBatch = Clock::now();
+    const auto report = [&](const auto* label, const auto elapsed) {
+        const auto ns = std::chrono::duration_cast<Nanoseconds>(elapsed);
+        std::cout << label << ": " << ns.count() << " ns for " << count
+                  << " hashes\n";
+    };
+    report("boost::multiprecision", haveReference - start);
+    report("native", haveSingle - haveReference);
+    report("native batch", haveBatch - haveSingle);
+
+    EXPECT_EQ(expected, single);
+    EXPECT_EQ(expected, batch);
+}
+}  // namespace ottest
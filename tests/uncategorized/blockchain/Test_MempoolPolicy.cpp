@@ -0,0 +1,197 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "blockchain/node/MempoolPolicy.hpp"
+#include "internal/util/P0330.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace opentxs::literals;
+
+class Test_MempoolPolicy : public ::testing::Test
+{
+public:
+    using Policy = ot::blockchain::node::MempoolPolicy;
+    using Txid = Policy::Txid;
+
+    static constexpr auto tx_bytes_ = 100_uz;
+    static constexpr auto max_bytes_ = 4_uz * tx_bytes_;
+
+    Policy policy_;
+
+    static auto ID(const std::uint8_t value) -> Txid
+    {
+        auto bytes = ot::Space(32_uz, std::byte{0x00});
+        bytes.front() = std::byte{value};
+
+        return Txid{ot::reader(bytes)};
+    }
+
+    auto Add(
+        const std::uint8_t id,
+        const std::optional<std::uint64_t> rate,
+        const bool local = false) -> std::optional<Policy::Evicted>
+    {
+        return policy_.Add(ID(id), tx_bytes_, tx_bytes_, rate, local);
+    }
+
+    Test_MempoolPolicy()
+        : policy_(max_bytes_)
+    {
+    }
+};
+
+TEST_F(Test_MempoolPolicy, eviction_order)
+{
+    ASSERT_TRUE(Add(1, 5u));
+    ASSERT_TRUE(Add(2, 1u));
+    ASSERT_TRUE(Add(3, 3u));
+    ASSERT_TRUE(Add(4, std::nullopt));
+    EXPECT_EQ(policy_.Bytes(), max_bytes_);
+
+    // NOTE the lowest known fee rate is evicted, not the unknown one
+    const auto first = Add(5, 4u);
+
+    ASSERT_TRUE(first);
+    ASSERT_EQ(first->size(), 1_uz);
+    EXPECT_EQ(first->front(), ID(2));
+    EXPECT_EQ(policy_.MinimumFeeRate(), 1u);
+
+    const auto second = Add(6, 4u);
+
+    ASSERT_TRUE(second);
+    ASSERT_EQ(second->size(), 1_uz);
+    EXPECT_EQ(second->front(), ID(3));
+    EXPECT_EQ(policy_.MinimumFeeRate(), 3u);
+
+    // NOTE nothing cheaper remains so the pool is left unchanged
+    EXPECT_FALSE(Add(7, 4u));
+    EXPECT_EQ(policy_.Bytes(), max_bytes_);
+}
+
+TEST_F(Test_MempoolPolicy, unknown_fee_rate)
+{
+    ASSERT_TRUE(Add(1, std::nullopt));
+    ASSERT_TRUE(Add(2, 7u));
+    ASSERT_TRUE(Add(3, std::nullopt));
+    ASSERT_TRUE(Add(4, 9u));
+
+    // NOTE unknown fee rates only displace each other, oldest first
+    const auto evicted = Add(5, std::nullopt);
+
+    ASSERT_TRUE(evicted);
+    ASSERT_EQ(evicted->size(), 1_uz);
+    EXPECT_EQ(evicted->front(), ID(1));
+    EXPECT_EQ(policy_.MinimumFeeRate(), 0u);
+
+    policy_.Remove(ID(3));
+    policy_.Remove(ID(5));
+    ASSERT_TRUE(Add(6, 8u));
+    ASSERT_TRUE(Add(7, 8u));
+
+    EXPECT_FALSE(Add(8, std::nullopt));
+}
+
+TEST_F(Test_MempoolPolicy, local)
+{
+    ASSERT_TRUE(Add(1, 2u, true));
+    ASSERT_TRUE(Add(2, std::nullopt));
+    ASSERT_TRUE(Add(3, 6u));
+    ASSERT_TRUE(Add(4, 5u));
+
+    const auto evicted = Add(5, std::nullopt, true);
+
+    ASSERT_TRUE(evicted);
+    ASSERT_EQ(evicted->size(), 1_uz);
+    EXPECT_EQ(evicted->front(), ID(4));
+
+    const auto known = Add(6, std::nullopt, true);
+
+    ASSERT_TRUE(known);
+    ASSERT_EQ(known->size(), 1_uz);
+    EXPECT_EQ(known->front(), ID(3));
+
+    const auto unknown = Add(7, std::nullopt, true);
+
+    ASSERT_TRUE(unknown);
+    ASSERT_EQ(unknown->size(), 1_uz);
+    EXPECT_EQ(unknown->front(), ID(2));
+    EXPECT_EQ(policy_.Bytes(), max_bytes_);
+
+    // NOTE local transactions are never evicted and are always admitted
+    const auto full = Add(8, 1u, true);
+
+    ASSERT_TRUE(full);
+    EXPECT_TRUE(full->empty());
+    EXPECT_EQ(policy_.Bytes(), max_bytes_ + tx_bytes_);
+}
+
+TEST_F(Test_MempoolPolicy, fee_filter)
+{
+    EXPECT_FALSE(Policy::BelowFeeFilter(std::nullopt, 0u));
+    EXPECT_FALSE(Policy::BelowFeeFilter(std::nullopt, 1000u));
+    EXPECT_FALSE(Policy::BelowFeeFilter(999u, 0u));
+    EXPECT_TRUE(Policy::BelowFeeFilter(999u, 1000u));
+    EXPECT_FALSE(Policy::BelowFeeFilter(1000u, 1000u));
+    EXPECT_FALSE(Policy::BelowFeeFilter(1001u, 1000u));
+}
+
+TEST_F(Test_MempoolPolicy, minimum_fee_rate)
+{
+    for (auto i = std::uint8_t{1}; i <= 4u; ++i) { ASSERT_TRUE(Add(i, i)); }
+
+    ASSERT_TRUE(Add(5, 10u));
+    ASSERT_EQ(policy_.MinimumFeeRate(), 1u);
+    ASSERT_TRUE(Add(6, 10u));
+    ASSERT_EQ(policy_.MinimumFeeRate(), 2u);
+
+    // NOTE the advertised feefilter rejects transactions below the minimum
+    EXPECT_FALSE(Add(7, 1u));
+    EXPECT_TRUE(Policy::BelowFeeFilter(1u, policy_.MinimumFeeRate()));
+
+    policy_.Decay();
+
+    EXPECT_EQ(policy_.MinimumFeeRate(), 2u);
+
+    for (auto i = std::uint8_t{3}; i <= 6u; ++i) { policy_.Remove(ID(i)); }
+
+    ASSERT_EQ(policy_.Bytes(), 0_uz);
+
+    policy_.Decay();
+
+    EXPECT_EQ(policy_.MinimumFeeRate(), 1u);
+    EXPECT_TRUE(Add(8, 1u));
+}
+
+TEST_F(Test_MempoolPolicy, estimate)
+{
+    EXPECT_FALSE(policy_.EstimateFeeRate());
+
+    auto policy = Policy{Policy::estimate_min_samples_ * 2_uz * tx_bytes_};
+
+    for (auto i = 0_uz; i < Policy::estimate_min_samples_; ++i) {
+        const auto id = static_cast<std::uint8_t>(i);
+        ASSERT_TRUE(policy.Add(ID(id), tx_bytes_, tx_bytes_, i + 1u, false));
+    }
+
+    // NOTE transactions with an unknown fee rate are not sampled
+    auto unknown = ot::Space(32_uz, std::byte{0xff});
+    ASSERT_TRUE(policy.Add(
+        Txid{ot::reader(unknown)}, tx_bytes_, tx_bytes_, std::nullopt, false));
+
+    const auto estimate = policy.EstimateFeeRate();
+
+    ASSERT_TRUE(estimate);
+    EXPECT_EQ(*estimate, 1u);
+}
+}  // namespace ottest
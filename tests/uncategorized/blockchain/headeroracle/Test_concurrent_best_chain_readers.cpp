@@ -0,0 +1,117 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <string>
+
+#include "internal/util/P0330.hpp"
+#include "ottest/fixtures/blockchain/HeaderOracle.hpp"
+
+namespace ottest
+{
+using namespace opentxs::literals;
+
+// NOTE readers never take the oracle lock so every BestHashes result must be a
+// complete chain from genesis even while AddHeaders publishes new tips and
+// reorgs in another thread
+TEST_F(Test_HeaderOracle, concurrent_best_chain_readers)
+{
+    static constexpr auto trunk_ = 200_uz;
+    static constexpr auto fork_height_ = 100_uz;
+    static constexpr auto branch_length_ = 150_uz;
+    static constexpr auto batch_ = 10_uz;
+    const auto name = [](const char* prefix, const std::size_t n) {
+        auto out = ot::UnallocatedCString{prefix} + std::to_string(n) + '_';
+        out.resize(32_uz, 'X');
+
+        return out;
+    };
+    const auto genesis = bc::HeaderOracle::GenesisBlockHash(type_);
+    auto parents = ot::UnallocatedMap<bb::Hash, bb::Hash>{};
+    auto trunk = ot::UnallocatedVector<ot::UnallocatedCString>{};
+    auto branch = ot::UnallocatedVector<ot::UnallocatedCString>{};
+
+    for (auto n = 1_uz; n <= trunk_; ++n) {
+        const auto parent =
+            trunk.empty() ? genesis : get_block_hash(trunk.back());
+        const auto& child = trunk.emplace_back(name("trunk ", n));
+
+        ASSERT_TRUE(make_test_block(child, parent));
+
+        parents.emplace(get_block_hash(child), parent);
+    }
+
+    for (auto n = fork_height_ + 1_uz; n <= fork_height_ + branch_length_;
+         ++n) {
+        const auto parent = branch.empty()
+                                ? get_block_hash(trunk.at(fork_height_ - 1_uz))
+                                : get_block_hash(branch.back());
+        const auto& child = branch.emplace_back(name("branch ", n));
+
+        ASSERT_TRUE(make_test_block(child, parent));
+
+        parents.emplace(get_block_hash(child), parent);
+    }
+
+    auto done = std::atomic<bool>{false};
+    auto reader = std::async(std::launch::async, [&] {
+        auto failures = 0_uz;
+
+        while (false == done.load()) {
+            const auto hashes = header_oracle_.BestHashes(0);
+
+            if (hashes.empty() || (hashes.front() != genesis)) {
+                ++failures;
+
+                continue;
+            }
+
+            for (auto i = 1_uz; i < hashes.size(); ++i) {
+                const auto it = parents.find(hashes.at(i));
+
+                if ((parents.end() == it) || (it->second != hashes.at(i - 1))) {
+                    ++failures;
+
+                    break;
+                }
+            }
+        }
+
+        return failures;
+    });
+    const auto add = [&](const auto& names) {
+        for (auto i = 0_uz; i < names.size(); i += batch_) {
+            auto headers = ot::UnallocatedVector<std::unique_ptr<bb::Header>>{};
+
+            for (auto j = i; (j < names.size()) && (j < (i + batch_)); ++j) {
+                headers.emplace_back(get_test_block(names.at(j)));
+            }
+
+            EXPECT_TRUE(header_oracle_.AddHeaders(headers));
+        }
+    };
+    add(trunk);
+
+    EXPECT_EQ(
+        header_oracle_.BestChain().height_, static_cast<bb::Height>(trunk_));
+
+    add(branch);
+    done.store(true);
+
+    EXPECT_EQ(reader.get(), 0_uz);
+
+    const auto tip = header_oracle_.BestChain();
+
+    EXPECT_EQ(
+        tip.height_, static_cast<bb::Height>(fork_height_ + branch_length_));
+    EXPECT_EQ(tip.hash_, get_block_hash(branch.back()));
+    EXPECT_FALSE(header_oracle_.IsInBestChain(get_block_hash(trunk.back())));
+}
+}  // namespace ottest
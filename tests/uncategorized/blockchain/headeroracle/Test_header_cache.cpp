@@ -0,0 +1,170 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+
+#include "blockchain/node/HeaderCache.hpp"
+#include "blockchain/node/UpdateTransaction.hpp"
+#include "internal/blockchain/database/Header.hpp"
+#include "internal/util/P0330.hpp"
+
+namespace ot = opentxs;
+namespace b = ot::blockchain;
+namespace bb = b::block;
+namespace bc = b::node;
+
+namespace ottest
+{
+using namespace opentxs::literals;
+
+// NOTE stands in for the header database and counts every existence check
+// which reaches it, so the test can verify which lookups the cache answers
+class FakeHeaderDB final : public b::database::Header
+{
+public:
+    mutable std::atomic<std::size_t> exists_{0};
+    ot::UnallocatedMap<bb::Hash, std::unique_ptr<bb::Header>> headers_{};
+
+    auto BestBlock(const bb::Height) const noexcept(false) -> bb::Hash final
+    {
+        throw std::out_of_range("no best chain");
+    }
+    auto CurrentBest() const noexcept -> std::unique_ptr<bb::Header> final
+    {
+        return {};
+    }
+    auto CurrentCheckpoint() const noexcept -> bb::Position final
+    {
+        return {};
+    }
+    auto DisconnectedHashes() const noexcept
+        -> b::database::DisconnectedList final
+    {
+        return {};
+    }
+    auto HasDisconnectedChildren(const bb::Hash&) const noexcept -> bool final
+    {
+        return false;
+    }
+    auto HaveCheckpoint() const noexcept -> bool final { return false; }
+    auto HeaderExists(const bb::Hash& hash) const noexcept -> bool final
+    {
+        ++exists_;
+
+        return 0_uz < headers_.count(hash);
+    }
+    auto IsSibling(const bb::Hash&) const noexcept -> bool final
+    {
+        return false;
+    }
+    auto LoadHeader(const bb::Hash& hash) const noexcept(false)
+        -> std::unique_ptr<bb::Header> final
+    {
+        return headers_.at(hash)->clone();
+    }
+    auto RecentHashes(ot::alloc::Default) const noexcept
+        -> b::database::HashVector final
+    {
+        return {};
+    }
+    auto SiblingHashes() const noexcept -> b::database::Hashes final
+    {
+        return {};
+    }
+    auto TryLoadBitcoinHeader(const bb::Hash&) const noexcept
+        -> std::unique_ptr<b::bitcoin::block::Header> final
+    {
+        return {};
+    }
+    auto TryLoadHeader(const bb::Hash& hash) const noexcept
+        -> std::unique_ptr<bb::Header> final
+    {
+        if (auto i = headers_.find(hash); headers_.end() != i) {
+
+            return i->second->clone();
+        }
+
+        return {};
+    }
+
+    auto ApplyUpdate(
+        const bc::UpdateTransaction&,
+        const std::function<void()>& committed) noexcept -> bool final
+    {
+        committed();
+
+        return true;
+    }
+};
+
+class Test_HeaderCache : public ::testing::Test
+{
+public:
+    const ot::api::session::Client& api_;
+    FakeHeaderDB db_;
+
+    auto make_header(const char* hash, const bb::Hash& parent) const
+        -> std::unique_ptr<bb::Header>
+    {
+        return api_.Factory().BlockHeaderForUnitTests(
+            bb::Hash{hash}, parent, -1);
+    }
+
+    Test_HeaderCache()
+        : api_(ot::Context().StartClientSession(0))
+        , db_()
+    {
+    }
+};
+
+TEST_F(Test_HeaderCache, out_of_order_batch)
+{
+    // NOTE the child hash sorts before its parent so a single pass over
+    // UpdatedHeaders would visit the child first
+    auto parent = make_header("block 02_XXXXXXXXXXXXXXXXXXXXXXX", bb::Hash{});
+
+    ASSERT_TRUE(parent);
+
+    auto child =
+        make_header("block 01_XXXXXXXXXXXXXXXXXXXXXXX", parent->Hash());
+    auto other = make_header("block 03_XXXXXXXXXXXXXXXXXXXXXXX", bb::Hash{});
+
+    ASSERT_TRUE(child);
+    ASSERT_TRUE(other);
+    ASSERT_LT(child->Hash(), parent->Hash());
+
+    const auto parentHash = parent->Hash();
+    const auto childHash = child->Hash();
+    const auto missing = bb::Hash{"block 04_XXXXXXXXXXXXXXXXXXXXXXX"};
+    db_.headers_.emplace(other->Hash(), other->clone());
+    auto cache = bc::HeaderCache{
+        db_, [](const bb::Height) { return std::optional<bb::Hash>{}; }, 2_uz};
+    auto update = bc::UpdateTransaction{api_, cache};
+    update.Stage(std::move(parent));
+    update.Stage(std::move(child));
+
+    ASSERT_EQ(update.UpdatedHeaders().begin()->first, childHash);
+
+    cache.Apply(update);
+
+    // NOTE loading an unrelated header evicts the least recently used entry,
+    // which is the child since linking it touched the parent last
+    EXPECT_TRUE(cache.TryLoadHeader(other->Hash()));
+    EXPECT_TRUE(cache.TryLoadHeader(parentHash));
+
+    const auto before = db_.exists_.load();
+
+    EXPECT_TRUE(cache.HeaderExists(childHash, parentHash));
+    EXPECT_FALSE(cache.HeaderExists(missing, parentHash));
+    EXPECT_EQ(db_.exists_.load(), before);
+}
+}  // namespace ottest
@@ -0,0 +1,49 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <memory>
+
+#include "ottest/fixtures/blockchain/HeaderOracle.hpp"
+
+namespace ottest
+{
+TEST_F(Test_HeaderOracle, reorg_shortens_best_chain)
+{
+    EXPECT_TRUE(create_blocks(create_7_));
+    EXPECT_TRUE(apply_blocks(sequence_7_));
+    EXPECT_TRUE(verify_best_chain(best_chain_2_));
+    EXPECT_EQ(header_oracle_.BestChain().height_, 5);
+    EXPECT_EQ(header_oracle_.BestHashes(0).size(), 6u);
+
+    // NOTE the checkpoint moves the tip from height 5 to height 3
+    EXPECT_TRUE(header_oracle_.AddCheckpoint(3, get_block_hash(BLOCK_4)));
+    EXPECT_TRUE(verify_best_chain(best_chain_7_));
+
+    const auto blank = bb::Hash{};
+    const auto tip = header_oracle_.BestChain();
+
+    EXPECT_EQ(tip.height_, 3);
+    EXPECT_EQ(tip.hash_, get_block_hash(BLOCK_4));
+    EXPECT_EQ(header_oracle_.BestHash(4), blank);
+    EXPECT_EQ(header_oracle_.BestHash(5), blank);
+    EXPECT_EQ(header_oracle_.BestHash(6), blank);
+    EXPECT_FALSE(header_oracle_.IsInBestChain(get_block_hash(BLOCK_7)));
+    EXPECT_FALSE(header_oracle_.IsInBestChain(get_block_hash(BLOCK_8)));
+
+    const auto all = header_oracle_.BestHashes(0);
+
+    ASSERT_EQ(all.size(), 4u);
+    EXPECT_EQ(all.back(), get_block_hash(BLOCK_4));
+
+    const auto last = header_oracle_.BestHashes(3, 10);
+
+    ASSERT_EQ(last.size(), 1u);
+    EXPECT_EQ(last.front(), get_block_hash(BLOCK_4));
+    EXPECT_TRUE(header_oracle_.BestHashes(4).empty());
+    EXPECT_TRUE(header_oracle_.BestHashes(5, 10).empty());
+}
+}  // namespace ottest
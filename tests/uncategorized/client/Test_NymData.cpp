@@ -435,6 +435,45 @@ TEST_F(Test_NymData, PrintContactData)
     EXPECT_STREQ(expected.c_str(), text.c_str());
 }
 
+TEST_F(Test_NymData, Reverify)
+{
+    const auto id = nymData_.Nym().ID();
+    const auto revision = nymData_.Nym().Revision();
+    const auto before = client_.Wallet().Nym(id);
+
+    ASSERT_TRUE(before);
+    EXPECT_TRUE(nymData_.AddEmail("reverify1", false, false, reason_));
+
+    nymData_.Release();
+
+    // NOTE the edit modified the cached instance in place so the wallet must
+    // verify it again before returning it
+    const auto first = client_.Wallet().Nym(id);
+
+    ASSERT_TRUE(first);
+    EXPECT_EQ(first.get(), before.get());
+    EXPECT_GT(first->Revision(), revision);
+    EXPECT_TRUE(first->VerifyPseudonym());
+    EXPECT_NE(
+        first->EmailAddresses(false).find("reverify1"),
+        ot::UnallocatedCString::npos);
+
+    {
+        auto editor = client_.Wallet().mutable_Nym(id, reason_);
+
+        EXPECT_TRUE(editor.AddEmail("reverify2", false, false, reason_));
+    }
+
+    const auto second = client_.Wallet().Nym(id);
+
+    ASSERT_TRUE(second);
+    EXPECT_GT(second->Revision(), first->Revision());
+    EXPECT_TRUE(second->VerifyPseudonym());
+    EXPECT_NE(
+        second->EmailAddresses(false).find("reverify2"),
+        ot::UnallocatedCString::npos);
+}
+
 TEST_F(Test_NymData, SetContactData)
 {
     const ot::identity::wot::claim::Data contactData(
@@ -5,7 +5,9 @@
 
 #include <gtest/gtest.h>
 #include <opentxs/opentxs.hpp>
+#include <cstddef>
 #include <filesystem>
+#include <string>
 
 #include "ottest/fixtures/common/Options.hpp"
 
@@ -13,6 +15,8 @@ constexpr auto bind_ipv4_1_{"127.0.0.1"};
 constexpr auto bind_ipv4_2_{"0.0.0.0"};
 constexpr auto bind_ipv6_1_{"::1"};
 constexpr auto bind_ipv6_2_{"::"};
+constexpr auto block_cache_bytes_1_{std::size_t{64u * 1024u * 1024u}};
+constexpr auto block_cache_bytes_2_{std::size_t{512u * 1024u * 1024u}};
 constexpr auto blockchain_1_{opentxs::blockchain::Type::Bitcoin};
 constexpr auto blockchain_2_{opentxs::blockchain::Type::Litecoin};
 constexpr auto blockchain_profile_1_{opentxs::BlockchainProfile::mobile};
@@ -365,4 +369,21 @@ TEST(Options, merge)
     EXPECT_TRUE(check_options(test1 + test2, expected2));
     EXPECT_TRUE(check_options(test2 + test3, expected3));
 }
+
+TEST(Options, blockchain_block_cache)
+{
+    const auto blank = opentxs::Options{};
+    const auto test1 =
+        opentxs::Options{}.SetBlockchainBlockCacheBytes(block_cache_bytes_1_);
+    const auto test2 = opentxs::Options{}.ImportOption(
+        "blockchain_block_cache", std::to_string(block_cache_bytes_2_));
+
+    EXPECT_EQ(blank.BlockchainBlockCacheBytes(), 0u);
+    EXPECT_EQ(test1.BlockchainBlockCacheBytes(), block_cache_bytes_1_);
+    EXPECT_EQ(test2.BlockchainBlockCacheBytes(), block_cache_bytes_2_);
+    EXPECT_EQ(
+        (test1 + blank).BlockchainBlockCacheBytes(), block_cache_bytes_1_);
+    EXPECT_EQ(
+        (test1 + test2).BlockchainBlockCacheBytes(), block_cache_bytes_2_);
+}
 }  // namespace ottest
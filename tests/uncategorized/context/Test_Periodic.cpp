@@ -0,0 +1,138 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+
+#include "api/Periodic.hpp"
+#include "internal/util/Flag.hpp"
+#include "internal/util/Mutex.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace std::literals::chrono_literals;
+
+class Scheduler final : public ot::api::imp::Periodic
+{
+public:
+    using Periodic::Shutdown;
+    using Periodic::Start;
+
+    Scheduler(ot::Flag& running)
+        : Periodic(running)
+    {
+    }
+
+    ~Scheduler() final = default;
+};
+
+class Test_Periodic : public ::testing::Test
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    ot::OTFlag running_;
+    Scheduler scheduler_;
+
+    Test_Periodic()
+        : running_(ot::Flag::Factory(true))
+        , scheduler_(running_.get())
+    {
+        scheduler_.Start(ot::Context().Asio());
+    }
+
+    ~Test_Periodic() override { scheduler_.Shutdown(); }
+};
+
+TEST_F(Test_Periodic, slow_task_never_overlaps)
+{
+    auto active = std::atomic<int>{0};
+    auto overlap = std::atomic<int>{0};
+    const auto id = scheduler_.Schedule(
+        1s,
+        [&] {
+            const auto count = ++active;
+            overlap.store(std::max(overlap.load(), count));
+            std::this_thread::sleep_for(1500ms);
+            --active;
+        },
+        0s);
+
+    std::this_thread::sleep_for(4s);
+    scheduler_.Shutdown();
+    const auto stats = scheduler_.Stats(id);
+
+    ASSERT_TRUE(stats.has_value());
+    EXPECT_EQ(overlap.load(), 1);
+    EXPECT_GE(stats->runs_, 2u);
+    EXPECT_GE(stats->max_duration_, 1500ms);
+    // NOTE each run after the first was due while the previous run was still
+    // in progress so it started late
+    EXPECT_GE(stats->max_lateness_, 400ms);
+}
+
+TEST_F(Test_Periodic, deadline)
+{
+    auto lock = std::mutex{};
+    auto starts = ot::UnallocatedVector<Clock::time_point>{};
+    const auto id = scheduler_.Schedule(
+        2s,
+        [&] {
+            ot::Lock guard(lock);
+            starts.emplace_back(Clock::now());
+        },
+        0s);
+
+    std::this_thread::sleep_for(3s);
+    scheduler_.Shutdown();
+    const auto stats = scheduler_.Stats(id);
+
+    ASSERT_TRUE(stats.has_value());
+    ASSERT_EQ(stats->runs_, 2u);
+    ASSERT_EQ(starts.size(), 2u);
+    // NOTE the second run must not start early, and should not start
+    // significantly late
+    EXPECT_GE(starts.at(1) - starts.at(0), 2s - 50ms);
+    EXPECT_LT(starts.at(1) - starts.at(0), 2s + 500ms);
+    EXPECT_LT(stats->max_lateness_, 500ms);
+}
+
+TEST_F(Test_Periodic, shutdown_waits_for_running_tasks)
+{
+    auto started = std::promise<void>{};
+    auto finished = std::atomic<bool>{false};
+    scheduler_.Schedule(
+        60s,
+        [&] {
+            started.set_value();
+            std::this_thread::sleep_for(500ms);
+            finished.store(true);
+        },
+        0s);
+
+    ASSERT_EQ(started.get_future().wait_for(10s), std::future_status::ready);
+
+    scheduler_.Shutdown();
+
+    EXPECT_TRUE(finished.load());
+}
+
+TEST_F(Test_Periodic, cancelled_task_has_no_stats)
+{
+    const auto id = scheduler_.Schedule(60s, [] {}, 0s);
+
+    EXPECT_TRUE(scheduler_.Stats(id).has_value());
+    EXPECT_TRUE(scheduler_.Cancel(id));
+    EXPECT_FALSE(scheduler_.Stats(id).has_value());
+}
+}  // namespace ottest
@@ -7,19 +7,27 @@
 #include <boost/multiprecision/cpp_int.hpp>
 #include <gtest/gtest.h>
 #include <opentxs/opentxs.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
 #include <limits>
 #include <memory>
+#include <random>
 #include <stdexcept>
 #include <utility>
 
 #include "internal/core/Amount.hpp"
 #include "internal/core/Factory.hpp"
+#include "internal/util/P0330.hpp"
 
 namespace ot = opentxs;
 namespace bmp = boost::multiprecision;
 
 namespace ottest
 {
+using namespace opentxs::literals;
+
 constexpr auto int_max = std::numeric_limits<int>::max();
 constexpr auto int_min = std::numeric_limits<int>::min();
 constexpr auto long_max = std::numeric_limits<long int>::max();
@@ -779,4 +787,88 @@ TEST(Amount, modulo)
 
     ASSERT_TRUE(ulonglong_amount % ot::Amount{2} == 1);
 }
+
+TEST(Amount, overflow_fallback)
+{
+    const auto serialize = [](const ot::Amount& amount) {
+        auto out = ot::UnallocatedCString{};
+        amount.Serialize(ot::writer(out));
+
+        return out;
+    };
+    const auto max = ot::Amount{longlong_max};
+    const auto min = ot::Amount{longlong_min};
+    const auto one = ot::Amount{1};
+
+    EXPECT_EQ(serialize(max), "170141183460469231713240559642174554112");
+    EXPECT_EQ(serialize(max + one), "170141183460469231731687303715884105728");
+    EXPECT_EQ(serialize(min), "-170141183460469231731687303715884105728");
+    EXPECT_EQ(
+        serialize(-ot::Amount{min}), "170141183460469231731687303715884105728");
+    EXPECT_TRUE(max + one - one == max);
+    EXPECT_TRUE(min - one + one == min);
+    EXPECT_EQ((max + one).Internal().ExtractUInt64(), 9223372036854775808u);
+    EXPECT_TRUE((max * 4) / 4 == max);
+    EXPECT_TRUE((max * max) / max == max);
+    EXPECT_EQ(serialize((max * max) / max), serialize(max));
+    EXPECT_TRUE(max < max + one);
+    EXPECT_TRUE(max < -ot::Amount{min});
+    EXPECT_TRUE(ot::Amount{ulonglong_max} == ulonglong_max);
+    EXPECT_TRUE(ot::Amount{ulonglong_max} - ot::Amount{ulonglong_max} == 0);
+
+    const auto fraction = ot::factory::Amount("-1", false);
+
+    EXPECT_EQ(serialize(fraction), "-1");
+    EXPECT_EQ(serialize(fraction * ot::Amount{3}), "-3");
+    EXPECT_EQ(serialize(fraction * fraction), "0");
+}
+
+// NOTE run with --gtest_also_run_disabled_tests to compare the inline 128 bit
+// representation against the amount::Integer arithmetic it falls back to
+TEST(Amount, DISABLED_benchmark)
+{
+    using Clock = std::chrono::steady_clock;
+    using Nanoseconds = std::chrono::nanoseconds;
+    using Integer = ot::amount::Integer;
+    static constexpr auto count = 1000000_uz;
+    static constexpr auto max_supply = 2100000000000000ull;
+    auto rng = std::mt19937_64{21u};
+    auto values = ot::UnallocatedVector<std::int64_t>{};
+    values.reserve(count);
+
+    while (values.size() < count) {
+        values.emplace_back(static_cast<std::int64_t>(rng() % max_supply));
+    }
+
+    const auto start = Clock::now();
+    auto amount = ot::Amount{};
+
+    for (const auto& value : values) {
+        const auto output = ot::Amount{value};
+        amount += output;
+        amount -= output / 1000;
+    }
+
+    const auto haveInline = Clock::now();
+    auto reference = Integer{};
+
+    for (const auto& value : values) {
+        const auto output = Integer{value} << ot::amount::fractional_bits_;
+        reference += output;
+        reference -= output / 1000;
+    }
+
+    const auto haveInteger = Clock::now();
+    const auto report = [&](const auto* label, const auto elapsed) {
+        const auto ns = std::chrono::duration_cast<Nanoseconds>(elapsed);
+        std::cout << label << ": " << ns.count() << " ns for " << count
+                  << " operations\n";
+    };
+    report("inline 128 bit", haveInline - start);
+    report("amount::Integer", haveInteger - haveInline);
+    auto serialized = ot::UnallocatedCString{};
+    amount.Serialize(ot::writer(serialized));
+
+    EXPECT_EQ(serialized, reference.str());
+}
 }  // namespace ottest
@@ -0,0 +1,107 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <filesystem>
+#include <memory>
+#include <string_view>
+
+#include "util/LMDB.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace std::literals;
+
+class Test_LMDB : public ::testing::Test
+{
+public:
+    static constexpr auto table_ = ot::storage::lmdb::Table{0};
+
+    const ot::storage::lmdb::TableNames names_;
+    const std::filesystem::path folder_;
+    std::unique_ptr<ot::storage::lmdb::LMDB> lmdb_;
+
+    auto Open(const bool writeMap) -> const ot::storage::lmdb::LMDB&
+    {
+        auto options = ot::storage::lmdb::EnvironmentOptions{};
+        options.write_map_ = writeMap;
+        lmdb_.reset();
+        std::filesystem::remove_all(folder_);
+        std::filesystem::create_directories(folder_);
+        lmdb_ = std::make_unique<ot::storage::lmdb::LMDB>(
+            names_,
+            folder_,
+            ot::storage::lmdb::TablesToInit{{table_, 0u}},
+            options.Flags());
+
+        return *lmdb_;
+    }
+
+    Test_LMDB()
+        : names_({{table_, "test"}})
+        , folder_(
+              std::filesystem::temp_directory_path() / "opentxs_test_lmdb")
+        , lmdb_()
+    {
+    }
+
+    ~Test_LMDB() override
+    {
+        lmdb_.reset();
+        std::filesystem::remove_all(folder_);
+    }
+};
+
+TEST_F(Test_LMDB, parent_transaction)
+{
+    for (const auto writeMap : {false, true}) {
+        const auto& lmdb = Open(writeMap);
+
+        {
+            auto tx = lmdb.TransactionRW();
+
+            EXPECT_TRUE(lmdb.Store(table_, "a"sv, "1"sv, tx).first);
+            EXPECT_TRUE(lmdb.Store(table_, "b"sv, "2"sv, tx).first);
+            EXPECT_TRUE(lmdb.Delete(table_, "a"sv, tx));
+            EXPECT_TRUE(tx.Finalize(true));
+        }
+
+        EXPECT_FALSE(lmdb.Exists(table_, "a"sv));
+        EXPECT_TRUE(lmdb.Exists(table_, "b"sv));
+
+        {
+            auto tx = lmdb.TransactionRW();
+
+            EXPECT_TRUE(lmdb.Store(table_, "c"sv, "3"sv, tx).first);
+            EXPECT_TRUE(lmdb.Delete(table_, "b"sv, tx));
+            EXPECT_TRUE(tx.Finalize(false));
+        }
+
+        EXPECT_TRUE(lmdb.Exists(table_, "b"sv));
+        EXPECT_FALSE(lmdb.Exists(table_, "c"sv));
+    }
+}
+
+TEST_F(Test_LMDB, batch)
+{
+    for (const auto writeMap : {false, true}) {
+        const auto& lmdb = Open(writeMap);
+        auto stored = lmdb.Batch([&](auto& tx) {
+            return lmdb.Store(table_, "a"sv, "1"sv, tx).first &&
+                   lmdb.Store(table_, "b"sv, "2"sv, tx).first;
+        });
+        auto deleted = lmdb.Batch(
+            [&](auto& tx) { return lmdb.Delete(table_, "a"sv, tx); });
+
+        EXPECT_TRUE(stored.get());
+        EXPECT_TRUE(deleted.get());
+        EXPECT_FALSE(lmdb.Exists(table_, "a"sv));
+        EXPECT_TRUE(lmdb.Exists(table_, "b"sv));
+    }
+}
+}  // namespace ottest
@@ -5,12 +5,15 @@
 
 #include <gtest/gtest.h>
 #include <opentxs/opentxs.hpp>
+#include <cstdint>
 #include <memory>
+#include <utility>
 
 #include "internal/api/FactoryAPI.hpp"
 #include "internal/api/session/FactoryAPI.hpp"
 #include "internal/otx/Types.hpp"
 #include "internal/otx/common/Ledger.hpp"
+#include "internal/otx/common/OTTransaction.hpp"
 
 namespace ot = opentxs;
 
@@ -76,4 +79,194 @@ TEST_F(Ledger, load_nymbox)
     ASSERT_TRUE(nymbox);
     EXPECT_TRUE(nymbox->LoadNymbox());
 }
+
+TEST_F(Ledger, lazy_index)
+{
+    auto nymbox = client_.Factory().InternalSession().Ledger(
+        nym_id_, nym_id_, server_id_, ot::ledgerType::nymbox, false);
+
+    ASSERT_TRUE(nymbox);
+    EXPECT_FALSE(nymbox->IsLazy());
+
+    nymbox->EnableLazyReceipts(2);
+
+    EXPECT_TRUE(nymbox->IsLazy());
+
+    for (const auto number : {9, 3, 6}) {
+        auto transaction = client_.Factory().InternalSession().Transaction(
+            *nymbox,
+            ot::transactionType::message,
+            ot::originType::not_applicable,
+            number);
+
+        ASSERT_TRUE(transaction);
+        EXPECT_TRUE(nymbox->AddTransaction(std::move(transaction)));
+    }
+
+    EXPECT_EQ(nymbox->GetTransactionCount(), 3);
+    EXPECT_EQ(nymbox->GetTransactionIndex(3), 0);
+    EXPECT_EQ(nymbox->GetTransactionIndex(6), 1);
+    EXPECT_EQ(nymbox->GetTransactionIndex(9), 2);
+    EXPECT_EQ(nymbox->GetTransactionIndex(4), -1);
+    ASSERT_TRUE(nymbox->GetTransactionByIndex(1));
+    EXPECT_EQ(nymbox->GetTransactionByIndex(1)->GetTransactionNum(), 6);
+    EXPECT_FALSE(nymbox->GetTransactionByIndex(3));
+    ASSERT_TRUE(nymbox->GetTransaction(9));
+    EXPECT_EQ(nymbox->GetTransaction(9)->GetTransactionNum(), 9);
+    EXPECT_FALSE(nymbox->GetTransaction(4));
+    EXPECT_TRUE(nymbox->LoadBoxReceipts());
+    EXPECT_TRUE(nymbox->RemoveTransaction(6));
+    EXPECT_EQ(nymbox->GetTransactionIndex(9), 1);
+    EXPECT_FALSE(nymbox->GetTransaction(6));
+    ASSERT_TRUE(nymbox->GetTransactionByIndex(1));
+    EXPECT_EQ(nymbox->GetTransactionByIndex(1)->GetTransactionNum(), 9);
+
+    nymbox->ReleaseTransactions();
+
+    EXPECT_EQ(nymbox->GetTransactionIndex(3), -1);
+    EXPECT_FALSE(nymbox->GetTransactionByIndex(0));
+}
+
+TEST_F(Ledger, lazy_receipts)
+{
+    const auto nym = client_.Wallet().Nym(nym_id_);
+
+    ASSERT_TRUE(nym);
+
+    {
+        auto nymbox = client_.Factory().InternalSession().Ledger(
+            nym_id_, nym_id_, server_id_, ot::ledgerType::nymbox, false);
+
+        ASSERT_TRUE(nymbox);
+        ASSERT_TRUE(nymbox->LoadNymbox());
+
+        for (const auto number : {11, 12, 13}) {
+            auto transaction = client_.Factory().InternalSession().Transaction(
+                *nymbox,
+                ot::transactionType::message,
+                ot::originType::not_applicable,
+                number);
+
+            ASSERT_TRUE(transaction);
+            EXPECT_TRUE(transaction->SignContract(*nym, reason_c_));
+            EXPECT_TRUE(transaction->SaveContract());
+            EXPECT_TRUE(transaction->SaveBoxReceipt(*nymbox));
+            EXPECT_TRUE(nymbox->AddTransaction(std::move(transaction)));
+        }
+
+        nymbox->ReleaseSignatures();
+
+        EXPECT_TRUE(nymbox->SignContract(*nym, reason_c_));
+        EXPECT_TRUE(nymbox->SaveContract());
+        EXPECT_TRUE(nymbox->SaveNymbox());
+    }
+
+    auto nymbox = client_.Factory().InternalSession().Ledger(
+        nym_id_, nym_id_, server_id_, ot::ledgerType::nymbox, false);
+
+    ASSERT_TRUE(nymbox);
+
+    nymbox->EnableLazyReceipts(2);
+
+    ASSERT_TRUE(nymbox->LoadNymbox());
+    ASSERT_TRUE(nymbox->VerifyAccount(*nym));
+    ASSERT_EQ(nymbox->GetTransactionCount(), 3);
+
+    for (const auto& [number, transaction] : nymbox->GetTransactionMap()) {
+        ASSERT_TRUE(transaction);
+        EXPECT_TRUE(transaction->IsAbbreviated());
+    }
+
+    const auto first = nymbox->GetTransaction(11);
+
+    ASSERT_TRUE(first);
+    EXPECT_FALSE(first->IsAbbreviated());
+    EXPECT_EQ(first->GetTransactionNum(), 11);
+    EXPECT_EQ(nymbox->GetTransaction(11), first);
+    EXPECT_TRUE(nymbox->GetTransactionMap().at(11)->IsAbbreviated());
+
+    const auto second = nymbox->GetTransactionByIndex(1);
+
+    ASSERT_TRUE(second);
+    EXPECT_FALSE(second->IsAbbreviated());
+    EXPECT_EQ(second->GetTransactionNum(), 12);
+    EXPECT_EQ(nymbox->GetTransaction(12), second);
+    EXPECT_EQ(nymbox->GetTransaction(11), first);
+
+    // NOTE the least recently used receipt, 12, is evicted to make room
+    const auto third = nymbox->GetTransaction(13);
+
+    ASSERT_TRUE(third);
+    EXPECT_FALSE(third->IsAbbreviated());
+    EXPECT_EQ(nymbox->GetTransaction(11), first);
+    EXPECT_EQ(nymbox->GetTransaction(13), third);
+
+    const auto reloaded = nymbox->GetTransaction(12);
+
+    ASSERT_TRUE(reloaded);
+    EXPECT_FALSE(reloaded->IsAbbreviated());
+    EXPECT_NE(reloaded, second);
+    EXPECT_EQ(reloaded->GetTransactionNum(), 12);
+    EXPECT_NE(nymbox->GetTransaction(11), first);
+}
+
+TEST_F(Ledger, lazy_missing_receipts)
+{
+    const auto nym = client_.Wallet().Nym(nym_id_);
+
+    ASSERT_TRUE(nym);
+
+    {
+        auto nymbox = client_.Factory().InternalSession().Ledger(
+            nym_id_, nym_id_, server_id_, ot::ledgerType::nymbox, false);
+
+        ASSERT_TRUE(nymbox);
+        ASSERT_TRUE(nymbox->LoadNymbox());
+
+        // NOTE the nymbox records this transaction but no box receipt is saved
+        auto transaction = client_.Factory().InternalSession().Transaction(
+            *nymbox,
+            ot::transactionType::message,
+            ot::originType::not_applicable,
+            14);
+
+        ASSERT_TRUE(transaction);
+        EXPECT_TRUE(nymbox->AddTransaction(std::move(transaction)));
+
+        nymbox->ReleaseSignatures();
+
+        EXPECT_TRUE(nymbox->SignContract(*nym, reason_c_));
+        EXPECT_TRUE(nymbox->SaveContract());
+        EXPECT_TRUE(nymbox->SaveNymbox());
+    }
+
+    auto nymbox = client_.Factory().InternalSession().Ledger(
+        nym_id_, nym_id_, server_id_, ot::ledgerType::nymbox, false);
+
+    ASSERT_TRUE(nymbox);
+
+    nymbox->EnableLazyReceipts();
+
+    ASSERT_TRUE(nymbox->LoadNymbox());
+    ASSERT_EQ(nymbox->GetTransactionCount(), 4);
+
+    auto unloaded = ot::UnallocatedSet<std::int64_t>{};
+
+    EXPECT_FALSE(nymbox->LoadBoxReceipts(&unloaded));
+    EXPECT_EQ(unloaded, ot::UnallocatedSet<std::int64_t>{14});
+    EXPECT_FALSE(nymbox->LoadBoxReceipts());
+
+    // NOTE checking for receipts does not load them
+    for (const auto& [number, transaction] : nymbox->GetTransactionMap()) {
+        ASSERT_TRUE(transaction);
+        EXPECT_TRUE(transaction->IsAbbreviated());
+    }
+
+    EXPECT_TRUE(nymbox->RemoveTransaction(14));
+
+    unloaded.clear();
+
+    EXPECT_TRUE(nymbox->LoadBoxReceipts(&unloaded));
+    EXPECT_TRUE(unloaded.empty());
+}
 }  // namespace ottest
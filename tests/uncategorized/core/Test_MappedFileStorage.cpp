@@ -0,0 +1,247 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <lmdb.h>
+#include <opentxs/opentxs.hpp>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string_view>
+
+#include "internal/util/P0330.hpp"
+#include "internal/util/TSV.hpp"
+#include "util/LMDB.hpp"
+#include "util/MappedFileStorage.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace opentxs::literals;
+
+class Storage final : public ot::util::MappedFileStorage
+{
+public:
+    using Index = ot::util::IndexData;
+
+    auto Read(const Index& index) const noexcept -> ot::ReadView
+    {
+        return get_read_view(index);
+    }
+    auto Relocate(Index& index) const noexcept -> bool
+    {
+        auto tx = lmdb_.TransactionRW();
+
+        return relocate(tx, index, {});
+    }
+    auto Release(const Index& index) const noexcept -> bool
+    {
+        auto tx = lmdb_.TransactionRW();
+
+        return release(tx, index) && tx.Finalize(true);
+    }
+    auto ShouldRelocate(const Index& index) const noexcept -> bool
+    {
+        return should_relocate(index);
+    }
+    auto Write(Index& index, const std::string_view data) const noexcept
+        -> bool
+    {
+        auto tx = lmdb_.TransactionRW();
+        auto view = get_write_view(tx, index, data.size());
+
+        if (false == view.valid(data.size())) { return false; }
+
+        std::memcpy(view.data(), data.data(), data.size());
+
+        return tx.Finalize(true);
+    }
+
+    Storage(
+        ot::storage::lmdb::LMDB& lmdb,
+        const std::filesystem::path& folder,
+        const int table,
+        const std::size_t key,
+        const int freeTable) noexcept(false)
+        : MappedFileStorage(lmdb, folder, "test", table, key, freeTable)
+    {
+    }
+
+    ~Storage() final = default;
+};
+
+class Test_MappedFileStorage : public ::testing::Test
+{
+public:
+    using Index = Storage::Index;
+
+    static constexpr auto config_ = ot::storage::lmdb::Table{0};
+    static constexpr auto free_ = ot::storage::lmdb::Table{1};
+    static constexpr auto key_ = 0_uz;
+
+    const std::filesystem::path folder_;
+    std::unique_ptr<ot::storage::lmdb::LMDB> lmdb_;
+    std::unique_ptr<Storage> storage_;
+
+    static auto make_item(const char c, const std::size_t size)
+        -> ot::UnallocatedCString
+    {
+        return ot::UnallocatedCString(size, c);
+    }
+
+    auto NextPosition() const -> std::size_t
+    {
+        auto out = 0_uz;
+        lmdb_->Load(config_, ot::tsv(key_), [&](const auto view) {
+            if (sizeof(out) == view.size()) {
+                std::memcpy(&out, view.data(), view.size());
+            }
+        });
+
+        return out;
+    }
+    // NOTE released extents only become reusable in the next session
+    auto Reopen() -> Storage&
+    {
+        storage_.reset();
+        storage_ = std::make_unique<Storage>(
+            *lmdb_, folder_, config_, key_, free_);
+
+        return *storage_;
+    }
+
+    Test_MappedFileStorage()
+        : folder_(
+              std::filesystem::temp_directory_path() /
+              "opentxs_test_mapped_file_storage")
+        , lmdb_([&] {
+            std::filesystem::remove_all(folder_);
+            std::filesystem::create_directories(folder_);
+
+            return std::make_unique<ot::storage::lmdb::LMDB>(
+                ot::storage::lmdb::TableNames{
+                    {config_, "config"}, {free_, "free"}},
+                folder_,
+                ot::storage::lmdb::TablesToInit{
+                    {config_, MDB_INTEGERKEY}, {free_, MDB_INTEGERKEY}});
+        }())
+        , storage_()
+    {
+        Reopen();
+    }
+
+    ~Test_MappedFileStorage() override
+    {
+        storage_.reset();
+        lmdb_.reset();
+        std::filesystem::remove_all(folder_);
+    }
+};
+
+TEST_F(Test_MappedFileStorage, rewrite_reuses_freed_extent)
+{
+    const auto first = make_item('a', 256_uz);
+    const auto second = make_item('b', 256_uz);
+    const auto grown = make_item('c', 512_uz);
+    const auto shrunk = make_item('d', 200_uz);
+    auto item = Index{};
+    auto other = Index{};
+
+    ASSERT_TRUE(storage_->Write(item, first));
+    ASSERT_TRUE(storage_->Write(other, second));
+    EXPECT_EQ(item.position_, 0_uz);
+    EXPECT_EQ(other.position_, 256_uz);
+
+    ASSERT_TRUE(storage_->Write(item, grown));
+    EXPECT_EQ(item.position_, 512_uz);
+    EXPECT_EQ(storage_->Read(item), grown);
+    EXPECT_EQ(NextPosition(), 1024_uz);
+
+    auto& storage = Reopen();
+
+    ASSERT_TRUE(storage.Write(item, shrunk));
+    EXPECT_EQ(item.position_, 0_uz);
+    EXPECT_EQ(item.size_, shrunk.size());
+    EXPECT_EQ(storage.Read(item), shrunk);
+    EXPECT_EQ(storage.Read(other), second);
+    EXPECT_EQ(NextPosition(), 1024_uz);
+}
+
+TEST_F(Test_MappedFileStorage, compaction_truncates)
+{
+    const auto first = make_item('a', 256_uz);
+    const auto second = make_item('b', 256_uz);
+    const auto third = make_item('c', 256_uz);
+    const auto fourth = make_item('d', 256_uz);
+    auto deleted = Index{};
+    auto live = Index{};
+    auto last = Index{};
+
+    ASSERT_TRUE(storage_->Write(deleted, first));
+    ASSERT_TRUE(storage_->Write(live, second));
+    ASSERT_TRUE(storage_->Write(last, third));
+    ASSERT_TRUE(storage_->Release(deleted));
+    EXPECT_EQ(NextPosition(), 768_uz);
+
+    {
+        auto& storage = Reopen();
+
+        EXPECT_FALSE(storage.ShouldRelocate(deleted));
+        EXPECT_TRUE(storage.ShouldRelocate(last));
+        ASSERT_TRUE(storage.Relocate(last));
+        EXPECT_EQ(last.position_, 0_uz);
+        EXPECT_EQ(storage.Read(last), third);
+        EXPECT_FALSE(storage.ShouldRelocate(live));
+    }
+
+    // NOTE the extent vacated at the end of the storage is reclaimed when the
+    // storage is next opened
+    auto& storage = Reopen();
+
+    EXPECT_EQ(NextPosition(), 512_uz);
+    EXPECT_EQ(storage.Read(live), second);
+    EXPECT_EQ(storage.Read(last), third);
+
+    auto next = Index{};
+
+    ASSERT_TRUE(storage.Write(next, fourth));
+    EXPECT_EQ(next.position_, 512_uz);
+    EXPECT_EQ(NextPosition(), 768_uz);
+}
+
+TEST_F(Test_MappedFileStorage, stale_index_survives_compaction)
+{
+    const auto first = make_item('a', 256_uz);
+    const auto second = make_item('b', 256_uz);
+    const auto updated = make_item('c', 256_uz);
+    auto deleted = Index{};
+    auto moved = Index{};
+
+    ASSERT_TRUE(storage_->Write(deleted, first));
+    ASSERT_TRUE(storage_->Write(moved, second));
+    ASSERT_TRUE(storage_->Release(deleted));
+
+    auto& storage = Reopen();
+    const auto stale = moved;
+
+    ASSERT_TRUE(storage.Relocate(moved));
+    ASSERT_NE(moved.position_, stale.position_);
+
+    const auto view = storage.Read(stale);
+
+    EXPECT_EQ(view, second);
+    EXPECT_EQ(view.data(), storage.Read(moved).data());
+
+    // NOTE a writer holding the old index must update the relocated copy
+    auto writer = stale;
+
+    ASSERT_TRUE(storage.Write(writer, updated));
+    EXPECT_EQ(writer.position_, moved.position_);
+    EXPECT_EQ(storage.Read(moved), updated);
+    EXPECT_EQ(storage.Read(stale), updated);
+}
+}  // namespace ottest
@@ -0,0 +1,87 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "internal/util/P0330.hpp"
+#include "util/Allocator.hpp"
+#include "util/SecureArena.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace opentxs::literals;
+
+TEST(SecureArena, chunks_are_reused_and_zeroed)
+{
+    auto& arena = ot::SecureArena::Get();
+    auto* first = static_cast<std::byte*>(arena.Allocate(40_uz));
+
+    ASSERT_NE(first, nullptr);
+
+    std::memset(first, 0xff, 40_uz);
+    arena.Release(first, 40_uz);
+    auto* second = static_cast<std::byte*>(arena.Allocate(64_uz));
+
+    ASSERT_EQ(first, second);
+    EXPECT_TRUE(std::all_of(second, second + 64_uz, [](const auto& byte) {
+        return std::byte{0} == byte;
+    }));
+
+    arena.Release(second, 64_uz);
+}
+
+TEST(SecureArena, large_allocations)
+{
+    auto& arena = ot::SecureArena::Get();
+    constexpr auto bytes = ot::SecureArena::max_chunk_ + 1_uz;
+    const auto before = arena.Statistics();
+    auto* chunk = static_cast<std::byte*>(arena.Allocate(bytes));
+
+    ASSERT_NE(chunk, nullptr);
+    EXPECT_EQ(arena.Statistics().large_in_use_, before.large_in_use_ + 1_uz);
+    // NOTE no supported platform uses pages smaller than 4 KiB
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(chunk) % 4096_uz, 0_uz);
+
+    std::memset(chunk, 0xff, bytes);
+    arena.Release(chunk, bytes);
+
+    EXPECT_EQ(arena.Statistics().large_in_use_, before.large_in_use_);
+}
+
+TEST(SecureArena, allocator)
+{
+    using Vector = std::vector<std::byte, ot::SecureAllocator<std::byte>>;
+    auto& arena = ot::SecureArena::Get();
+    const auto before = arena.Statistics().chunks_in_use_;
+
+    {
+        auto secrets = std::vector<Vector>{};
+
+        for (auto i = 1_uz; i <= ot::SecureArena::max_chunk_; i *= 2_uz) {
+            secrets.emplace_back(i, std::byte{0x5a});
+        }
+
+        for (const auto& secret : secrets) {
+            EXPECT_TRUE(std::all_of(
+                secret.begin(), secret.end(), [](const auto& byte) {
+                    return std::byte{0x5a} == byte;
+                }));
+        }
+
+        EXPECT_GT(arena.Statistics().chunks_in_use_, before);
+        EXPECT_GT(arena.Statistics().slabs_, 0_uz);
+    }
+
+    EXPECT_EQ(arena.Statistics().chunks_in_use_, before);
+}
+}  // namespace ottest
@@ -5,7 +5,10 @@
 
 #include <gtest/gtest.h>
 #include <opentxs/opentxs.hpp>
+#include <chrono>
+#include <future>
 #include <memory>
+#include <thread>
 #include <utility>
 
 #include "2_Factory.hpp"
@@ -231,6 +234,66 @@ TEST_F(Test_Nym, default_params)
     EXPECT_FALSE(pSection);
 }
 
+TEST_F(Test_Nym, batch_lookup)
+{
+    const auto pNym = client_.Wallet().Nym(reason_, "Batch");
+
+    ASSERT_TRUE(pNym);
+
+    const auto unknown = client_.Factory().NymIDFromRandom();
+    const auto nyms = client_.Wallet().Nyms({pNym->ID(), unknown});
+
+    ASSERT_EQ(nyms.size(), 2);
+    ASSERT_TRUE(nyms.at(0));
+    EXPECT_EQ(nyms.at(0)->ID(), pNym->ID());
+    EXPECT_FALSE(nyms.at(1));
+}
+
+TEST_F(Test_Nym, batch_lookup_wait)
+{
+    using namespace std::literals;
+    static constexpr auto timeout = 30s;
+    const auto pKnown = client_.Wallet().Nym(reason_, "Known");
+
+    ASSERT_TRUE(pKnown);
+
+    // NOTE the nym is created outside of the wallet so the lookup below can
+    // not find it until the other thread publishes it
+    const auto pRemote =
+        std::unique_ptr<ot::identity::internal::Nym>{ot::Factory::Nym(
+            client_, {}, ot::identity::Type::individual, "", reason_)};
+
+    ASSERT_TRUE(pRemote);
+
+    const auto remote = ot::identifier::Nym{pRemote->ID()};
+    const auto serialized = [&] {
+        auto out = ot::Space{};
+
+        EXPECT_TRUE(pRemote->Serialize(ot::writer(out)));
+
+        return out;
+    }();
+
+    ASSERT_FALSE(client_.Wallet().Nym(remote));
+
+    auto publish = std::async(std::launch::async, [&] {
+        std::this_thread::sleep_for(250ms);
+
+        return client_.Wallet().Nym(ot::reader(serialized));
+    });
+    const auto start = std::chrono::steady_clock::now();
+    const auto nyms = client_.Wallet().Nyms({pKnown->ID(), remote}, timeout);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_TRUE(publish.get());
+    ASSERT_EQ(nyms.size(), 2);
+    ASSERT_TRUE(nyms.at(0));
+    EXPECT_EQ(nyms.at(0)->ID(), pKnown->ID());
+    ASSERT_TRUE(nyms.at(1));
+    EXPECT_EQ(nyms.at(1)->ID(), remote);
+    EXPECT_LT(elapsed, timeout);
+}
+
 TEST_F(Test_Nym, secp256k1_hd_bip47)
 {
     if (have_secp256k1_ && have_hd_) {
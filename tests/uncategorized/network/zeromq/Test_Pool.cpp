@@ -0,0 +1,172 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "internal/network/zeromq/Batch.hpp"
+#include "internal/network/zeromq/Context.hpp"
+#include "internal/network/zeromq/Handle.hpp"
+#include "internal/network/zeromq/Types.hpp"
+#include "internal/network/zeromq/socket/Raw.hpp"
+#include "internal/util/P0330.hpp"
+
+namespace ot = opentxs;
+namespace zmq = ot::network::zeromq;
+
+namespace ottest
+{
+using namespace opentxs::literals;
+using namespace std::literals::chrono_literals;
+
+class Load
+{
+public:
+    auto ID() const noexcept -> zmq::BatchID { return handle_.batch_.id_; }
+    auto Received() const noexcept -> std::size_t { return received_.load(); }
+    auto Sent() const noexcept -> std::size_t { return sent_; }
+    auto Thread() const noexcept -> std::thread::id
+    {
+        auto lock = std::lock_guard<std::mutex>{lock_};
+
+        return thread_;
+    }
+
+    auto SetCost(const std::chrono::milliseconds cost) noexcept -> void
+    {
+        cost_.store(cost);
+    }
+    auto Send(const std::size_t count) noexcept -> void
+    {
+        for (auto n = 0_uz; n < count; ++n) {
+            auto message = zmq::Message{};
+            message.AddFrame(ot::UnallocatedCString{"load"});
+
+            if (push_.Send(std::move(message))) { ++sent_; }
+        }
+    }
+
+    Load(const zmq::internal::Context& zmq, const std::size_t index) noexcept
+        : handle_(zmq.MakeBatch({zmq::socket::Type::Pull}))
+        , push_(zmq.RawSocket(zmq::socket::Type::Push))
+        , cost_(1ms)
+        , lock_()
+        , thread_()
+        , received_(0)
+        , sent_(0)
+    {
+        const auto endpoint =
+            "inproc://opentxs/test/pool_rebalance/" + std::to_string(index);
+        auto& pull = handle_.batch_.sockets_.at(0);
+        EXPECT_TRUE(pull.Bind(endpoint.c_str()));
+        EXPECT_TRUE(push_.Connect(endpoint.c_str()));
+        // NOTE every actor obtains its allocator when it is constructed, which
+        // must not prevent the batch from migrating later
+        EXPECT_NE(zmq.Alloc(ID()), nullptr);
+        EXPECT_NE(
+            zmq.Start(
+                ID(),
+                {{pull.ID(),
+                  std::addressof(pull),
+                  [this](auto&&) {
+                      std::this_thread::sleep_for(cost_.load());
+                      {
+                          auto lock = std::lock_guard<std::mutex>{lock_};
+                          thread_ = std::this_thread::get_id();
+                      }
+                      ++received_;
+                  }}},
+                "pool test"),
+            nullptr);
+    }
+
+private:
+    zmq::internal::Handle handle_;
+    zmq::socket::Raw push_;
+    std::atomic<std::chrono::milliseconds> cost_;
+    mutable std::mutex lock_;
+    std::thread::id thread_;
+    std::atomic<std::size_t> received_;
+    std::size_t sent_;
+};
+
+TEST(Pool, rebalance)
+{
+    const auto& zmq = ot::Context().ZMQ().Internal();
+    const auto threads = zmq.Statistics().size();
+
+    if (2_uz > threads) { GTEST_SKIP() << "at least two threads required"; }
+
+    // NOTE an idle pool spreads new batches evenly so two of the first
+    // threads + 1 batches must share a thread
+    auto loads = ot::UnallocatedVector<std::unique_ptr<Load>>{};
+    auto pair = std::optional<std::pair<Load*, Load*>>{};
+
+    for (auto i = 0_uz; (i <= threads) && (false == pair.has_value()); ++i) {
+        auto& load = loads.emplace_back(std::make_unique<Load>(zmq, i));
+        const auto thread = zmq.ThreadID(load->ID());
+
+        for (auto j = 0_uz; j < i; ++j) {
+            if (zmq.ThreadID(loads[j]->ID()) == thread) {
+                pair.emplace(loads[j].get(), load.get());
+
+                break;
+            }
+        }
+    }
+
+    ASSERT_TRUE(pair.has_value());
+
+    // NOTE the busy batch accounts for more than half of the load of the
+    // shared thread, so only the light batch may move
+    auto& light = *pair->first;
+    auto& busy = *pair->second;
+    busy.SetCost(2ms);
+    const auto original = zmq.ThreadID(light.ID());
+    const auto moved = [&] { return zmq.ThreadID(light.ID()) != original; };
+    const auto feed = [&](Load& load, const std::size_t count) {
+        if ((load.Sent() - load.Received()) < 20_uz) { load.Send(count); }
+    };
+    const auto deadline = ot::Clock::now() + 60s;
+
+    while ((false == moved()) && (ot::Clock::now() < deadline)) {
+        feed(light, 5_uz);
+        feed(busy, 5_uz);
+        std::this_thread::sleep_for(20ms);
+        zmq.Rebalance();
+    }
+
+    ASSERT_TRUE(moved());
+
+    const auto destination = zmq.ThreadID(light.ID());
+    auto migrations = 0_uz;
+
+    for (const auto& stats : zmq.Statistics()) {
+        migrations += stats.migrations_;
+    }
+
+    EXPECT_GT(migrations, 0_uz);
+
+    const auto target = light.Received() + 10_uz;
+    light.Send(10_uz);
+
+    while ((light.Received() < target) && (ot::Clock::now() < deadline)) {
+        std::this_thread::sleep_for(10ms);
+    }
+
+    EXPECT_GE(light.Received(), target);
+    EXPECT_EQ(light.Thread(), destination);
+    EXPECT_NE(light.Thread(), original);
+}
+}  // namespace ottest
@@ -0,0 +1,152 @@
+// Copyright (c) 2010-2022 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest.h>
+#include <opentxs/opentxs.hpp>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "internal/otx/Types.hpp"
+#include "internal/util/P0330.hpp"
+#include "otx/server/RequestLocks.hpp"
+
+namespace ot = opentxs;
+
+namespace ottest
+{
+using namespace opentxs::literals;
+using namespace std::literals::chrono_literals;
+using RequestLocks = ot::server::RequestLocks;
+
+class Test_RequestLocks : public ::testing::Test
+{
+public:
+    static constexpr auto timeout_ = 10s;
+
+    RequestLocks locks_;
+
+    // NOTE returns two resource names which hash to different stripes
+    static auto distinct() noexcept
+        -> std::pair<ot::UnallocatedCString, ot::UnallocatedCString>
+    {
+        const auto first = ot::UnallocatedCString{"resource 0"};
+
+        for (auto i = 1_uz; i < RequestLocks::stripes_ + 1_uz; ++i) {
+            auto second = "resource " + std::to_string(i);
+
+            if (RequestLocks::Stripe(first) != RequestLocks::Stripe(second)) {
+
+                return std::make_pair(first, std::move(second));
+            }
+        }
+
+        return {};
+    }
+
+    Test_RequestLocks()
+        : locks_()
+    {
+    }
+};
+
+TEST_F(Test_RequestLocks, classification)
+{
+    using Type = ot::MessageType;
+
+    EXPECT_TRUE(RequestLocks::IsParallel(Type::getNymbox));
+    EXPECT_TRUE(RequestLocks::IsParallel(Type::sendNymMessage));
+    EXPECT_FALSE(RequestLocks::IsParallel(Type::notarizeTransaction));
+    EXPECT_FALSE(RequestLocks::IsParallel(Type::processInbox));
+    EXPECT_FALSE(RequestLocks::IsParallel(Type::registerAccount));
+    EXPECT_TRUE(RequestLocks::IsTransaction(Type::notarizeTransaction));
+    EXPECT_TRUE(RequestLocks::IsTransaction(Type::processInbox));
+    EXPECT_FALSE(RequestLocks::IsTransaction(Type::getNymbox));
+    EXPECT_FALSE(RequestLocks::IsTransaction(Type::registerAccount));
+}
+
+TEST_F(Test_RequestLocks, different_nyms_run_concurrently)
+{
+    const auto [alice, bob] = distinct();
+
+    ASSERT_FALSE(alice.empty());
+
+    const auto held = locks_.Shared({alice});
+    auto other = std::async(std::launch::async, [&, nym = bob] {
+        const auto lock = locks_.Shared({nym});
+    });
+
+    EXPECT_EQ(other.wait_for(timeout_), std::future_status::ready);
+}
+
+TEST_F(Test_RequestLocks, same_nym_is_serialized)
+{
+    const auto nym = ot::UnallocatedCString{"resource 0"};
+    auto held = std::make_optional(locks_.Shared({nym}));
+    auto other = std::async(
+        std::launch::async, [&] { const auto lock = locks_.Shared({nym}); });
+
+    EXPECT_EQ(other.wait_for(100ms), std::future_status::timeout);
+
+    held.reset();
+
+    EXPECT_EQ(other.wait_for(timeout_), std::future_status::ready);
+}
+
+TEST_F(Test_RequestLocks, opposite_order_transfers_do_not_deadlock)
+{
+    static constexpr auto rounds = 10000_uz;
+    const auto [from, to] = distinct();
+
+    ASSERT_FALSE(from.empty());
+
+    const auto transfer = [&](const ot::UnallocatedCString& source,
+                              const ot::UnallocatedCString& destination) {
+        for (auto n = 0_uz; n < rounds; ++n) {
+            const auto lock = locks_.Shared({source, destination});
+        }
+    };
+    auto first = std::async(std::launch::async, transfer, from, to);
+    auto second = std::async(std::launch::async, transfer, to, from);
+
+    EXPECT_EQ(first.wait_for(timeout_), std::future_status::ready);
+    EXPECT_EQ(second.wait_for(timeout_), std::future_status::ready);
+}
+
+TEST_F(Test_RequestLocks, exclusive_waits_for_shared)
+{
+    // NOTE non-parallel requests and cron both use the exclusive lock
+    auto held = std::make_optional(locks_.Shared({"resource 0"}));
+    auto exclusive = std::async(
+        std::launch::async, [&] { const auto lock = locks_.Exclusive(); });
+
+    EXPECT_EQ(exclusive.wait_for(100ms), std::future_status::timeout);
+
+    held.reset();
+
+    EXPECT_EQ(exclusive.wait_for(timeout_), std::future_status::ready);
+}
+
+TEST_F(Test_RequestLocks, exclusive_blocks_shared)
+{
+    auto held = std::make_optional(locks_.Exclusive());
+    auto shared = std::async(std::launch::async, [&] {
+        const auto lock = locks_.Shared({"resource 0"});
+    });
+    auto processing = std::async(
+        std::launch::async, [&] { const auto lock = locks_.Processing(); });
+
+    EXPECT_EQ(shared.wait_for(100ms), std::future_status::timeout);
+    EXPECT_EQ(processing.wait_for(100ms), std::future_status::timeout);
+
+    held.reset();
+
+    EXPECT_EQ(shared.wait_for(timeout_), std::future_status::ready);
+    EXPECT_EQ(processing.wait_for(timeout_), std::future_status::ready);
+}
+}  // namespace ottest